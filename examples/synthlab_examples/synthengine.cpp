@@ -1,6 +1,9 @@
 // --- Synth Core v1.0
 //
 #include "synthengine.h"
+#include "../../source/synthtrace.h"
+
+#include <chrono>
 
 // -----------------------------
 //	--- SynthLab SDK File --- //
@@ -24,16 +27,22 @@ namespace SynthLab
 	- constructs the array of MAX_VOICES synth voice objects
 	- constructs the (un-shared) audio delay object
 
-	\param blockSize the block size to be used for the lifetime of operation; OK if arriving blocks are smaller than this value, NOT OK if larger
+	\param blockSize the block size to be used for the lifetime of operation; this is the internal render slice size
+	and arriving blocks of any size are OK, see render()
 	\param config OPTIONAL argument for DM synth configuration; can be safely ignored for non DM products
 
 	\returns the newly constructed object
 	*/
-	SynthEngine::SynthEngine(uint32_t blockSize, DMConfig* config)
+	SynthEngine::SynthEngine(uint32_t _blockSize, DMConfig* config)
+		: blockSize(_blockSize)
 	{
 		// --- DM config file; OK if this is NULL for non-DM products
 		initDMConfig(midiInputData, config);
 
+		// --- detect the CPU and bind the fastest block kernels; the config (or the
+		//     SYNTHLAB_KERNELS environment variable) may force an ISA for testing
+		initSynthKernels(config ? config->kernelISA : nullptr);
+
 		// --- initialize to non-zero values for volume and pan
 		initMIDIInputData(midiInputData);
 
@@ -53,7 +62,9 @@ namespace SynthLab
 			// --- reset is the constructor for this kind of smartpointer
 			//
 			//     Pass our this pointer for the IMIDIData interface - safe
-			synthVoices[i].reset(new SynthVoice(midiInputData, midiOutputData, parameters->voiceParameters, wavetableDatabase, sampleDatabase, blockSize));
+			//     every voice is fully constructed; the others copy voice 0's render graph and core set
+			synthVoices[i].reset(new SynthVoice(midiInputData, midiOutputData, parameters->voiceParameters, wavetableDatabase, sampleDatabase, blockSize,
+				i > 0 ? synthVoices[0].get() : nullptr));
 		}
 
 		// --- voice object
@@ -62,6 +73,12 @@ namespace SynthLab
 		// --- delay FX
 		pingPongDelay.reset(new AudioDelay(midiInputData, parameters->audioDelayParameters, blockSize));
 
+		// --- convolver FX
+		cabinetConvolver.reset(new Convolver(midiInputData, parameters->convolverParameters, blockSize));
+
+		// --- telemetry bus; disabled until the GUI turns it on
+		telemetry.reset(new SynthTelemetry);
+
 	}
 
 	/**
@@ -75,10 +92,464 @@ namespace SynthLab
 	*/
 	SynthEngine::~SynthEngine()
 	{
+		// --- patches that were never switched to, or not yet collected
+		delete pendingPatch.exchange(nullptr);
+		delete retiredPatch.exchange(nullptr);
+
+		// --- unlock before the samples are deleted
+		residencyManager.releaseAll();
+
 		if (sampleDatabase)
 			sampleDatabase->clearSampleSources();
 	}
 
+	/**
+	\brief
+	Memory accounting for the whole engine
+	- owned: the engine object, the voice process buffers and the shared MIDI data
+	- children: each voice, the delay and convolver FX, the two shared databases and the imported wavetables
+	- NOT real-time safe; the report allocates and the databases are iterated
+	- print with report.getTreeString( )
+
+	\param report the root node, named "SynthEngine" if empty
+	*/
+	void SynthEngine::getMemoryReport(MemoryReport& report)
+	{
+		if (report.name.empty())
+			report.name = "SynthEngine";
+
+		uint64_t bytes = sizeof(SynthEngine) + voiceProcessInfo.getAllocatedBytes()
+			+ sizeof(SynthEngineParameters) + sizeof(MidiInputData) + sizeof(MidiOutputData) + sizeof(SynthTelemetry);
+		report.ownedBytes += bytes;
+		report.residentBytes += estimateResidentBytes(bytes);
+
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			if (synthVoices[i])
+				synthVoices[i]->getMemoryReport(report.addChild("Voice " + std::to_string(i + 1)));
+		}
+
+		if (pingPongDelay)
+			pingPongDelay->getMemoryReport(report.addChild("Ping Pong Delay"));
+
+		if (cabinetConvolver)
+			cabinetConvolver->getMemoryReport(report.addChild("Convolver"));
+
+		if (wavetableDatabase)
+			wavetableDatabase->getMemoryReport(report.addChild("Wavetable Database"));
+
+		if (sampleDatabase)
+			sampleDatabase->getMemoryReport(report.addChild("PCM Sample Database"));
+
+		std::lock_guard<std::mutex> lock(importMutex);
+		for (std::shared_ptr<ImportedWavetable>& importedWavetable : importedWavetables)
+		{
+			MemoryReport& child = report.addChild("Imported Wavetable " + importedWavetable->getName());
+			child.ownedBytes += importedWavetable->getAllocatedBytes();
+			child.residentBytes += estimateResidentBytes(importedWavetable->getAllocatedBytes());
+		}
+	}
+
+	/**
+	\brief
+	Change detection statistics of the cores and modules of all voices
+	- the counts are written by the audio thread; read them between render calls
+	or treat them as approximate
+
+	\return the summed counters
+	*/
+	UpdateCounters SynthEngine::getUpdateCounters()
+	{
+		UpdateCounters counters;
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			if (synthVoices[i])
+				synthVoices[i]->addUpdateCounters(counters);
+		}
+		return counters;
+	}
+
+	/**
+	\brief
+	Makes the tables and samples of the active patch resident
+	- every voice adds the sources its oscillators' selected cores can read; they usually
+	match, the list holds each source once
+	- the databases are filled when the cores are reset so this must follow reset( )
+	- NOT real-time safe
+
+	\return true if sucessful, false if locking is enabled and some pages could not be locked
+	*/
+	bool SynthEngine::updateResidency()
+	{
+		ReachableSources sources;
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			if (synthVoices[i])
+				synthVoices[i]->addReachableSources(sources);
+		}
+		return residencyManager.updateResidency(sources);
+	}
+
+	// --- patch chunks
+	//
+	/** voice-level settings; APPEND new fields only */
+	template <class Archive>
+	void serializePatch(Archive& archive, SynthVoiceParameters& params)
+	{
+		archive.value(params.synthModeIndex);
+		archive.value(params.filterModeIndex);
+		archive.value(params.enablePortamento);
+		archive.value(params.glideTime_mSec);
+		archive.value(params.legatoMode);
+		archive.value(params.freeRunOscMode);
+		archive.value(params.unisonDetuneCents);
+		archive.value(params.unisonStartPhase);
+		archive.value(params.unisonPan);
+#ifdef SYNTHLAB_DX
+		archive.value(params.fmAlgorithmIndex);
+#endif
+	}
+
+	/** engine-level settings; the voice and FX parameters have their own chunks; APPEND new fields only */
+	template <class Archive>
+	void serializePatch(Archive& archive, SynthEngineParameters& params)
+	{
+		archive.value(params.enableMIDINoteEvents);
+		archive.value(params.synthModeIndex);
+		archive.value(params.globalVolume_dB);
+		archive.value(params.globalPitchBendSensCoarse);
+		archive.value(params.globalPitchBendSensFine);
+		archive.value(params.globalTuningCoarse);
+		archive.value(params.globalTuningFine);
+		archive.value(params.globalUnisonDetune_Cents);
+		archive.value(params.enableDelayFX);
+		archive.value(params.enableConvolverFX);
+	}
+
+	/**
+	\brief
+	Writes (archive is a PatchWriter) or reads (a PatchReader) every chunk of the engine's patch
+	- the chunk tags are the same for every variant; the variant ID in the header keeps
+	one synth from loading another's patches
+
+	\param archive the patch writer or reader
+	\param params the parameter tree to write or fill in
+	*/
+	template <class Archive>
+	void serializePatchChunks(Archive& archive, SynthEngineParameters& params)
+	{
+		SynthVoiceParameters& voiceParams = *params.voiceParameters;
+
+		serializePatchChunk(archive, makePatchTag('E', 'N', 'G', 'N'), params);
+		serializePatchChunk(archive, makePatchTag('V', 'O', 'I', 'C'), voiceParams);
+
+#ifdef SYNTHLAB_WS
+		serializePatchChunk(archive, makePatchTag('W', 'S', 'E', 'Q'), *voiceParams.waveSequencerParameters);
+		serializePatchChunk(archive, makePatchTag('W', 'S', 'O', '1'), *voiceParams.wsOsc1Parameters);
+		serializePatchChunk(archive, makePatchTag('W', 'S', 'O', '2'), *voiceParams.wsOsc2Parameters);
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			serializePatchChunk(archive, makePatchTag('O', 'S', 'C', (char)('1' + i)), *voiceParams.getOscParameters(i));
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			serializePatchChunk(archive, makePatchTag('L', 'F', 'O', (char)('1' + i)), *voiceParams.getLFOParameters(i));
+
+		serializePatchChunk(archive, makePatchTag('A', 'E', 'G', ' '), *voiceParams.ampEGParameters);
+		serializePatchChunk(archive, makePatchTag('F', 'E', 'G', ' '), *voiceParams.filterEGParameters);
+		serializePatchChunk(archive, makePatchTag('X', 'E', 'G', ' '), *voiceParams.auxEGParameters);
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			serializePatchChunk(archive, makePatchTag('F', 'L', 'T', (char)('1' + i)), *voiceParams.getFilterParameters(i));
+
+		serializePatchChunk(archive, makePatchTag('D', 'C', 'A', ' '), *voiceParams.dcaParameters);
+		serializePatchChunk(archive, makePatchTag('M', 'M', 'T', 'X'), *voiceParams.modMatrixParameters);
+		serializePatchChunk(archive, makePatchTag('D', 'L', 'Y', ' '), *params.audioDelayParameters);
+		serializePatchChunk(archive, makePatchTag('C', 'O', 'N', 'V'), *params.convolverParameters);
+	}
+
+	/**
+	\brief
+	Bounds every index field of a parameter tree read from a patch to its legal range (see
+	validatePatch( ) in synthpatch.h); the same structures as serializePatchChunks( )
+	- a truncated, corrupted or hostile patch file only has its values checked here, and the 
+	waveform, core and mode indexes are used as array indexes on the audio thread
+	- NOT real-time safe; for the loader thread, before the patch is posted
+
+	\param params the parameter tree that was read
+	*/
+	static void validatePatchChunks(SynthEngineParameters& params)
+	{
+		SynthVoiceParameters& voiceParams = *params.voiceParameters;
+		const uint32_t synthModes = enumToInt(SynthMode::kPoly) + 1;
+
+		boundPatchIndex(params.synthModeIndex, synthModes);
+		boundPatchIndex(voiceParams.synthModeIndex, synthModes);
+		boundPatchIndex(voiceParams.filterModeIndex, enumToInt(FilterMode::kParallel) + 1);
+#ifdef SYNTHLAB_DX
+		boundPatchIndex(voiceParams.fmAlgorithmIndex, enumToInt(DX100Algo::kFM8) + 1);
+#endif
+
+#ifdef SYNTHLAB_WS
+		validatePatch(*voiceParams.waveSequencerParameters);
+		validatePatch(*voiceParams.wsOsc1Parameters);
+		validatePatch(*voiceParams.wsOsc2Parameters);
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			validatePatch(*voiceParams.getOscParameters(i));
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			validatePatch(*voiceParams.getLFOParameters(i));
+
+		validatePatch(*voiceParams.ampEGParameters);
+		validatePatch(*voiceParams.filterEGParameters);
+		validatePatch(*voiceParams.auxEGParameters);
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			validatePatch(*voiceParams.getFilterParameters(i));
+
+		validatePatch(*voiceParams.dcaParameters);
+	}
+
+	/**
+	\brief
+	Copies the values of a parameter tree into another, leaving the shared structures in place
+	- the engine, voices and modules hold pointers into the destination tree, so only its
+	values may change
+	- real-time safe: no allocations
+
+	\param source the prepared patch's tree
+	\param dest the engine's tree
+	*/
+	static void copyPatchParameters(SynthEngineParameters& source, SynthEngineParameters& dest)
+	{
+		dest.enableMIDINoteEvents = source.enableMIDINoteEvents;
+		dest.synthModeIndex = source.synthModeIndex;
+		dest.globalVolume_dB = source.globalVolume_dB;
+		dest.globalPitchBendSensCoarse = source.globalPitchBendSensCoarse;
+		dest.globalPitchBendSensFine = source.globalPitchBendSensFine;
+		dest.globalTuningCoarse = source.globalTuningCoarse;
+		dest.globalTuningFine = source.globalTuningFine;
+		dest.globalUnisonDetune_Cents = source.globalUnisonDetune_Cents;
+		dest.enableDelayFX = source.enableDelayFX;
+		*dest.audioDelayParameters = *source.audioDelayParameters;
+		dest.enableConvolverFX = source.enableConvolverFX;
+		*dest.convolverParameters = *source.convolverParameters;
+
+		SynthVoiceParameters& sourceVoice = *source.voiceParameters;
+		SynthVoiceParameters& destVoice = *dest.voiceParameters;
+		destVoice.synthModeIndex = sourceVoice.synthModeIndex;
+		destVoice.filterModeIndex = sourceVoice.filterModeIndex;
+		destVoice.enablePortamento = sourceVoice.enablePortamento;
+		destVoice.glideTime_mSec = sourceVoice.glideTime_mSec;
+		destVoice.legatoMode = sourceVoice.legatoMode;
+		destVoice.freeRunOscMode = sourceVoice.freeRunOscMode;
+		destVoice.unisonDetuneCents = sourceVoice.unisonDetuneCents;
+		destVoice.unisonStartPhase = sourceVoice.unisonStartPhase;
+		destVoice.unisonPan = sourceVoice.unisonPan;
+
+#ifdef SYNTHLAB_WS
+		// --- keep the outbound meters
+		WaveSequencerStatusMeters statusMeters = destVoice.waveSequencerParameters->statusMeters;
+		*destVoice.waveSequencerParameters = *sourceVoice.waveSequencerParameters;
+		destVoice.waveSequencerParameters->statusMeters = statusMeters;
+		*destVoice.wsOsc1Parameters = *sourceVoice.wsOsc1Parameters;
+		*destVoice.wsOsc2Parameters = *sourceVoice.wsOsc2Parameters;
+#else
+	#ifdef SYNTHLAB_DX
+		destVoice.fmAlgorithmIndex = sourceVoice.fmAlgorithmIndex;
+	#endif
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			*destVoice.getOscParameters(i) = *sourceVoice.getOscParameters(i);
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			*destVoice.getLFOParameters(i) = *sourceVoice.getLFOParameters(i);
+
+		*destVoice.ampEGParameters = *sourceVoice.ampEGParameters;
+		*destVoice.filterEGParameters = *sourceVoice.filterEGParameters;
+		*destVoice.auxEGParameters = *sourceVoice.auxEGParameters;
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			*destVoice.getFilterParameters(i) = *sourceVoice.getFilterParameters(i);
+
+		*destVoice.dcaParameters = *sourceVoice.dcaParameters;
+
+		// --- element-wise: ModMatrixParameters::operator= would share the source's arrays
+		*destVoice.modMatrixParameters->modSourceRows = *sourceVoice.modMatrixParameters->modSourceRows;
+		*destVoice.modMatrixParameters->modDestinationColumns = *sourceVoice.modMatrixParameters->modDestinationColumns;
+	}
+
+	/**
+	\return the patch header's variant ID for this synth; patches only load in the same variant
+	*/
+	uint32_t SynthEngine::getPatchVariantID()
+	{
+#if defined SYNTHLAB_WT
+		return makePatchTag('S', 'L', 'W', 'T');
+#elif defined SYNTHLAB_VA
+		return makePatchTag('S', 'L', 'V', 'A');
+#elif defined SYNTHLAB_PCM
+		return makePatchTag('S', 'L', 'P', 'C');
+#elif defined SYNTHLAB_KS
+		return makePatchTag('S', 'L', 'K', 'S');
+#elif defined SYNTHLAB_DX
+		return makePatchTag('S', 'L', 'D', 'X');
+#elif defined SYNTHLAB_WS
+		return makePatchTag('S', 'L', 'W', 'S');
+#else
+		return makePatchTag('S', 'L', '?', '?');
+#endif
+	}
+
+	/**
+	\brief
+	Writes the current parameters as a binary patch
+	- NOT real-time safe; call from the GUI thread, which owns the parameter values
+
+	\param patchData receives the patch
+	\return true if sucessful
+	*/
+	bool SynthEngine::savePatch(std::vector<uint8_t>& patchData)
+	{
+		PatchWriter writer(getPatchVariantID());
+		serializePatchChunks(writer, *parameters);
+		patchData = writer.getData();
+		return true;
+	}
+
+	/**
+	\brief
+	Prepares a patch on the calling (background) thread for a glitch-free program change:
+	- reads the patch into a new parameter tree; missing chunks and fields take their defaults
+	- bounds the index fields of the patch to their legal ranges, so that a corrupted or 
+	hostile patch file cannot make the cores index out of bounds
+	- builds and resets the cores the patch selects that are not instantiated yet, which
+	registers and resolves their tables and samples in the databases
+	- prefaults (and locks, if enabled) those tables and samples
+	- hands the result to the audio thread, which switches at the top of the next render( ):
+	it installs the cores, copies the values and runs the normal update, which selects the 
+	cores and re-analyzes the mod matrix routing, without allocating
+	- call updateResidency( ) afterwards to release what the old patch used
+	- NOT real-time safe; do not run two at once
+
+	\param patchData the patch
+	\param patchSize size of the patch in bytes
+
+	\return true if the patch is pending; false if it is not a patch for this synth or a 
+	previous patch is still pending
+	*/
+	bool SynthEngine::preparePatch(const uint8_t* patchData, uint32_t patchSize)
+	{
+		// --- pending first: the audio thread retires a patch before it clears the pending slot,
+		//     so once the slot reads empty the last switched patch is in the retired slot
+		if (pendingPatch.load(std::memory_order_acquire))
+			return false;
+
+		// --- free the patch the audio thread switched to last time
+		delete retiredPatch.exchange(nullptr, std::memory_order_acq_rel);
+
+		PatchReader reader;
+		if (!reader.open(patchData, patchSize, getPatchVariantID()))
+			return false;
+
+		std::unique_ptr<PreparedPatch> patch(new PreparedPatch);
+		serializePatchChunks(reader, *patch->parameters);
+		validatePatchChunks(*patch->parameters);
+
+		// --- build the cores
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			if (synthVoices[i])
+				synthVoices[i]->prepareModuleCores(*patch->parameters->voiceParameters, patch->cores);
+		}
+
+		postPreparedPatch(patch.release());
+		return true;
+	}
+
+	/**
+	\brief
+	Builds the cores that the current parameters select but that are not built yet and hands 
+	them to the audio thread, which installs and selects them at the top of the next render( )
+	- the voices only switch to cores that are already built (SynthModule::selectModuleCore( )),
+	so call this from the GUI or a loader thread after a moduleIndex parameter changes
+	- NOT real-time safe; shares the single pending slot with preparePatch( )
+
+	\return true if the cores are built (or there was nothing to build), false if a patch is 
+	still pending
+	*/
+	bool SynthEngine::prepareModuleCores()
+	{
+		// --- pending first: the audio thread retires a patch before it clears the pending slot,
+		//     so once the slot reads empty the last switched patch is in the retired slot
+		if (pendingPatch.load(std::memory_order_acquire))
+			return false;
+
+		// --- free the patch the audio thread switched to last time
+		delete retiredPatch.exchange(nullptr, std::memory_order_acq_rel);
+
+		// --- cores only: the engine keeps its own parameters
+		std::unique_ptr<PreparedPatch> patch(new PreparedPatch);
+		patch->parameters = nullptr;
+
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			if (synthVoices[i])
+				synthVoices[i]->prepareModuleCores(*parameters->voiceParameters, patch->cores);
+		}
+
+		if (!patch->cores.empty())
+			postPreparedPatch(patch.release());
+
+		return true;
+	}
+
+	/**
+	\brief
+	Makes the tables and samples of a prepared patch's cores resident and hands it to the
+	audio thread through the pending slot
+	- NOT real-time safe
+
+	\param patch the patch, owned by the engine from here on
+	*/
+	void SynthEngine::postPreparedPatch(PreparedPatch* patch)
+	{
+		CoreProcData processData;
+		processData.wavetableDatabase = wavetableDatabase.get();
+		processData.sampleDatabase = sampleDatabase.get();
+
+		ReachableSources sources;
+		for (PreparedCore& prepared : patch->cores)
+			prepared.core->addReachableSources(sources, processData);
+		residencyManager.addResidency(sources);
+
+		pendingPatch.store(patch, std::memory_order_release);
+	}
+
+	/**
+	\brief
+	Audio thread: switches to a prepared patch
+	- real-time safe: the cores are only referenced and the values copied; the patch object
+	is retired for preparePatch( ) to free
+
+	\param patch the patch taken from the pending slot
+	*/
+	void SynthEngine::applyPreparedPatch(PreparedPatch* patch)
+	{
+		for (PreparedCore& prepared : patch->cores)
+			prepared.module->installModuleCore(prepared.index, prepared.core);
+
+		if (patch->parameters)
+			copyPatchParameters(*patch->parameters, *parameters);
+
+		// --- normal update: selects the cores and re-analyzes the routing
+		setParameters(parameters);
+
+		// --- the retired slot is always empty here: preparePatch( ) and prepareModuleCores( ) 
+		//     collect it before they post, and they cannot post until render( ) clears the 
+		//     pending slot after this, so nothing is freed on the audio thread
+		retiredPatch.store(patch, std::memory_order_release);
+	}
+
 	/**
 	\brief
 	Forwards custom code settings to first voice (since all voices share the same architecture)
@@ -152,7 +623,12 @@ namespace SynthLab
 
 	/**
 	\brief
-	Resets all voices and the audio delay object
+	Resets all voices and the FX objects
+	- voice 0 resets first, alone: its cores do the work that is shared by all voices
+	(registering tables and samples with the databases, building shared tables for a new
+	sample rate), so the other voices find it done
+	- the other voices and the FX then reset in parallel on the reset pool; each only
+	touches its own objects and the (locked) databases
 
 	\param _sampleRate the initial or newly changed sample rate
 
@@ -160,19 +636,96 @@ namespace SynthLab
 	*/
 	bool SynthEngine::reset(double _sampleRate)
 	{
-		// --- reset array of voices
-		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		// --- needed for slice timestamps
+		sampleRate = _sampleRate;
+		telemetry->reset(_sampleRate);
+
+		// --- imported wavetables first, so that the cores find them; under the import lock, so
+		//     that an import on a loader thread finishes first and a later one builds at the new rate
 		{
-			// --- smart poitner access looks normal (->)
-			synthVoices[i]->reset(_sampleRate); // this calls reset() on the smart-pointers underlying naked pointer
+			std::lock_guard<std::mutex> lock(importMutex);
+			importSampleRate = _sampleRate;
+			for (std::shared_ptr<ImportedWavetable>& importedWavetable : importedWavetables)
+				importedWavetable->build(_sampleRate, getResetPool());
 		}
 
-		// --- FX
-		pingPongDelay->reset(_sampleRate);
+		// --- voice 0 does the shared work
+		synthVoices[0]->reset(_sampleRate);
+
+		// --- the rest of the voices, plus the FX as the last jobs
+		getResetPool()->parallelFor(MAX_VOICES + 1, [&](uint32_t job)
+		{
+			if (job < MAX_VOICES - 1)
+				synthVoices[job + 1]->reset(_sampleRate);
+			else if (job == MAX_VOICES - 1)
+				pingPongDelay->reset(_sampleRate);
+			else
+				cabinetConvolver->reset(_sampleRate);
+		});
+
+		// --- the cores have filled the databases; make the patch's share resident
+		updateResidency();
 
 		return true;
 	}
 
+	/**
+	\brief
+	Returns the worker pool that splits reset( ) across the CPU cores, creating it on the
+	first call; imports have their own pool, so they never share it with a reset( ) on another thread
+
+	\return the pool
+	*/
+	WorkerPool* SynthEngine::getResetPool()
+	{
+		if (!resetPool)
+			resetPool.reset(new WorkerPool(std::min(WorkerPool::getDefaultThreadCount(), (uint32_t)MAX_VOICES)));
+		return resetPool.get();
+	}
+
+	/**
+	\brief
+	Imports a wavetable from a WAV file and adds its frames to the wavetable database
+	- builds at the rate of the last reset( ) (the default rate before the first one) on the
+	import pool; reset( ) rebuilds at a new rate
+	- holds the import lock throughout: imports run one at a time, and a reset( ) on another
+	thread waits for the import (and the import for the reset)
+	- a frame name that a built-in waveform has is taken over with replaceTableSource( ), so the
+	cores play the imported frame from their next update, also after reset( )
+	- a waveform that was already imported under the same name is refused
+
+	\param wavFilePath fully qualified WAV file path
+	\param waveformName name of the waveform, used for the frame names
+	\param frameLength samples per frame, or 0 to detect
+
+	\return true if sucessful
+	*/
+	bool SynthEngine::importWavetable(const char* wavFilePath, const char* waveformName, uint32_t frameLength)
+	{
+		if (!wavFilePath || !waveformName || !wavetableDatabase)
+			return false;
+
+		std::lock_guard<std::mutex> lock(importMutex);
+		for (std::shared_ptr<ImportedWavetable>& importedWavetable : importedWavetables)
+		{
+			if (importedWavetable->getName() == waveformName)
+				return false;
+		}
+
+		if (!importPool)
+			importPool.reset(new WorkerPool(WorkerPool::getDefaultThreadCount()));
+
+		std::shared_ptr<ImportedWavetable> importedWavetable = std::make_shared<ImportedWavetable>(waveformName);
+		if (!importedWavetable->load(wavFilePath, frameLength) || !importedWavetable->build(importSampleRate, importPool.get()))
+			return false;
+
+		// --- nothing to unregister on failure: the database only holds the names that were added,
+		//     so the object must live on with them
+		bool registered = importedWavetable->registerSources(wavetableDatabase.get(), true);
+		importedWavetables.push_back(importedWavetable);
+		return registered;
+	}
+
 	/**
 	\brief
 	Initializes all voices with the DLL path
@@ -197,10 +750,11 @@ namespace SynthLab
 	/**
 	\brief
 	Render a buffer of output audio samples
-	- process all MIDI events at top of block
-	- then renders the active voices one at a time
-	- accumulates voices and applies delay FX
-	- applies global gain control to final audio output stream
+	- the arriving block may be any size; it is rendered in slices that are no larger than the 
+	  engine's blockSize, so the voices and FX never see more than they were built for
+	- slices are also split at each MIDI event's sample offset so that events are sample-accurate
+	- parameter automation events split the slices the same way, see applyParameterEvent( )
+	- DAW aux data (absolute buffer time) is adjusted for each slice
 
 	\param synthProcessInfo structure containing all information needed
 	about the current block to process including:
@@ -214,18 +768,114 @@ namespace SynthLab
 	{
 		// --- mau do thie before?
 		synthProcessInfo.flushBuffers();
+		synthProcessInfo.setOutputSilenceFlags(ALL_CHANNELS_SILENT);
 
-		// --- issue MIDI events for this block
-		uint32_t midiEvents = synthProcessInfo.getMidiEventCount();
-		for (uint32_t i = 0; i < midiEvents; i++)
+		// --- these do not change across the block
+		midiInputData->setAuxDAWDataFloat(kBPM, synthProcessInfo.BPM);
+		midiInputData->setAuxDAWDataFloat(kTSNumerator, synthProcessInfo.timeSigNumerator);
+		midiInputData->setAuxDAWDataUINT(kTSDenominator, synthProcessInfo.timeSigDenomintor);
+
+		// --- this is important
+		uint32_t samplesToProcess = synthProcessInfo.getSamplesInBlock();
+		SYNTHLAB_TRACE_EVENT(TraceEventType::kBlockBegin, samplesToProcess, 0);
+		residencyManager.beginRenderFaultCount();
+
+		// --- the render time is only measured for the telemetry bus
+		bool telemetryEnabled = telemetry->isEnabled();
+		std::chrono::steady_clock::time_point renderStart;
+		if (telemetryEnabled)
+			renderStart = std::chrono::steady_clock::now();
+
+		// --- switch to a prepared patch at the block boundary; the patch is retired before
+		//     the pending slot is cleared, see preparePatch( )
+		PreparedPatch* patch = pendingPatch.load(std::memory_order_acquire);
+		if (patch)
 		{
-			// --- get the event
-			midiEvent event = *synthProcessInfo.getMidiEvent(i);
+			applyPreparedPatch(patch);
+			pendingPatch.store(nullptr, std::memory_order_release);
+		}
 
-			// --- process it
+		uint32_t midiEvents = (uint32_t)synthProcessInfo.getMidiEventCount();
+		uint32_t eventIndex = 0;
+		uint32_t parameterEvents = (uint32_t)synthProcessInfo.getParameterEventCount();
+		uint32_t parameterIndex = 0;
+		uint32_t sampleOffset = 0;
+
+		while (sampleOffset < samplesToProcess)
+		{
+			// --- issue MIDI events that fall on (or before) the top of this slice
+			//     NOTE: events are expected in time order, as delivered by all hosts
+			while (eventIndex < midiEvents &&
+				   synthProcessInfo.getMidiEvent(eventIndex)->midiSampleOffset <= sampleOffset)
+			{
+				// --- get the event; offset is now relative to the slice
+				midiEvent event = *synthProcessInfo.getMidiEvent(eventIndex++);
+				event.midiSampleOffset = 0;
+
+				// --- process it
+				processMIDIEvent(event);
+			}
+
+			// --- apply automation that falls on (or before) the top of this slice
+			while (parameterIndex < parameterEvents &&
+				   synthProcessInfo.getParameterEvent(parameterIndex)->sampleOffset <= sampleOffset)
+				applyParameterEvent(*synthProcessInfo.getParameterEvent(parameterIndex++));
+
+			// --- slice ends at blockSize, end of buffer, or next event, whichever is first
+			uint32_t sliceEnd = std::min(sampleOffset + blockSize, samplesToProcess);
+			if (eventIndex < midiEvents)
+				sliceEnd = std::min(sliceEnd, synthProcessInfo.getMidiEvent(eventIndex)->midiSampleOffset);
+			if (parameterIndex < parameterEvents)
+				sliceEnd = std::min(sliceEnd, synthProcessInfo.getParameterEvent(parameterIndex)->sampleOffset);
+
+			// --- time at top of slice
+			midiInputData->setAuxDAWDataFloat(kAbsBufferTime, synthProcessInfo.absoluteBufferTime_Sec + (double)sampleOffset / sampleRate);
+
+			// --- render
+			renderSlice(synthProcessInfo, sampleOffset, sliceEnd - sampleOffset);
+			sampleOffset = sliceEnd;
+		}
+
+		// --- events stamped past the end of the buffer are not dropped
+		while (eventIndex < midiEvents)
+		{
+			midiEvent event = *synthProcessInfo.getMidiEvent(eventIndex++);
+			event.midiSampleOffset = 0;
 			processMIDIEvent(event);
 		}
+		while (parameterIndex < parameterEvents)
+			applyParameterEvent(*synthProcessInfo.getParameterEvent(parameterIndex++));
 
+		if (telemetryEnabled)
+			writeTelemetry(synthProcessInfo, samplesToProcess,
+				std::chrono::duration<double>(std::chrono::steady_clock::now() - renderStart).count());
+
+		residencyManager.endRenderFaultCount();
+		SYNTHLAB_TRACE_EVENT(TraceEventType::kBlockEnd, samplesToProcess, 0);
+
+		// --- note that this is const, and therefore read-only
+		return true;
+	}
+
+	/**
+	\brief
+	Render one slice of the output buffer
+	- renders the active voices one at a time, or stage by stage across the voices in
+	module-major mode (SynthEngineParameters::moduleMajorRendering): every voice's LFOs, then
+	every voice's EGs, mod matrix, oscillators and filters, so that each module type's code and
+	tables are reused across the voices while they are in the caches; the voices are then
+	accumulated in the same order as voice by voice, so both modes give the same output
+	- accumulates voices and applies the convolver and delay FX
+	- applies global gain control to final audio output stream
+
+	\param synthProcessInfo the block being rendered
+	\param sampleOffset location of the top of the slice in the output buffers
+	\param samplesToProcess slice length, must be <= blockSize
+
+	\return true if sucessful
+	*/
+	bool SynthEngine::renderSlice(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess)
+	{
 		// --- -6dB per active channel to avoid clipping; I left some logic here if you want to experiment
 		//     with the different synth modes
 		double gainFactor = 0.5;
@@ -236,53 +886,156 @@ namespace SynthLab
 		//	     parameters->synthModeIndex == enumToInt(SynthMode::kUnisonLegato))
 		//	gainFactor = 0.5;
 
-		// --- this is important
-		uint32_t samplesToProcess = synthProcessInfo.getSamplesInBlock();
-		voiceProcessInfo.setSamplesInBlock(samplesToProcess);
-
-		midiInputData->setAuxDAWDataFloat(kBPM, synthProcessInfo.BPM);
-		midiInputData->setAuxDAWDataFloat(kTSNumerator, synthProcessInfo.timeSigNumerator);
-		midiInputData->setAuxDAWDataUINT(kTSDenominator, synthProcessInfo.timeSigDenomintor);
-		midiInputData->setAuxDAWDataFloat(kAbsBufferTime, synthProcessInfo.absoluteBufferTime_Sec);
+		// --- silence flags describe the whole buffer; track this slice on its own so the 
+		//     FX see whether their input is silent, then merge
+		uint32_t silenceFlags = synthProcessInfo.getOutputSilenceFlags();
+		synthProcessInfo.setOutputSilenceFlags(ALL_CHANNELS_SILENT);
 
-		// --- loop through voices and render/accumulate them
-		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		// --- module-major: stage by stage over the active voices, then the DCAs
+		if (parameters->moduleMajorRendering)
 		{
-			// --- blend active voices
-			if (synthVoices[i]->isVoiceActive())
+			uint32_t activeVoices[MAX_VOICES] = { 0 };
+			uint32_t activeVoiceCount = 0;
+			for (uint32_t i = 0; i < MAX_VOICES; i++)
+			{
+				if (synthVoices[i]->isVoiceActive())
+					activeVoices[activeVoiceCount++] = i;
+			}
+
+			for (uint32_t stage = 0; stage < enumToInt(voiceRenderStage::kNumStages); stage++)
 			{
-				// --- render and accumulate
-				synthVoices[i]->render(voiceProcessInfo);
-				accumulateVoice(synthProcessInfo, gainFactor);
+				for (uint32_t i = 0; i < activeVoiceCount; i++)
+					synthVoices[activeVoices[i]]->renderStage(static_cast<voiceRenderStage>(stage), samplesToProcess);
+			}
+
+			for (uint32_t i = 0; i < activeVoiceCount; i++)
+			{
+				SYNTHLAB_TRACE_EVENT(TraceEventType::kVoiceRenderBegin, activeVoices[i], samplesToProcess);
+				synthVoices[activeVoices[i]]->renderDCAAccumulate(synthProcessInfo, sampleOffset, samplesToProcess, gainFactor);
+				SYNTHLAB_TRACE_EVENT(TraceEventType::kVoiceRenderEnd, activeVoices[i], samplesToProcess);
 			}
 #ifdef SYNTHLAB_WS
 			// --- sequencer status lights for voice 0 only
-			if (i == 0)
-				parameters->wsStatusMeters = parameters->voiceParameters->waveSequencerParameters->statusMeters;
+			parameters->wsStatusMeters = parameters->voiceParameters->waveSequencerParameters->statusMeters;
 #endif
 		}
+		else
+		{
+			// --- loop through voices and render/accumulate them
+			for (uint32_t i = 0; i < MAX_VOICES; i++)
+			{
+				// --- blend active voices
+				if (synthVoices[i]->isVoiceActive())
+				{
+					// --- render and accumulate; the voice DCA adds straight into our output
+					//     with gainFactor folded into its gain, no staging buffer copy
+					SYNTHLAB_TRACE_EVENT(TraceEventType::kVoiceRenderBegin, i, samplesToProcess);
+					synthVoices[i]->renderAccumulate(synthProcessInfo, sampleOffset, samplesToProcess, gainFactor);
+					SYNTHLAB_TRACE_EVENT(TraceEventType::kVoiceRenderEnd, i, samplesToProcess);
+				}
+#ifdef SYNTHLAB_WS
+				// --- sequencer status lights for voice 0 only
+				if (i == 0)
+					parameters->wsStatusMeters = parameters->voiceParameters->waveSequencerParameters->statusMeters;
+#endif
+			}
+		}
 
-		// --- apply delay FX and other master FX here
+		// --- apply convolver and delay FX and other master FX here
 		//
+		if (parameters->enableConvolverFX)
+		{
+			copySynthOutputToAudioBufferInput(synthProcessInfo, cabinetConvolver->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess, sampleOffset);
+			cabinetConvolver->render(samplesToProcess);
+			copyAudioBufferOutputToSynthOutput(cabinetConvolver->getAudioBuffers(), synthProcessInfo, STEREO_TO_STEREO, samplesToProcess, sampleOffset);
+		}
+
 		if (parameters->enableDelayFX)
 		{
 			// --- copy synth output to delay input
-			copySynthOutputToAudioBufferInput(synthProcessInfo, pingPongDelay->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
+			copySynthOutputToAudioBufferInput(synthProcessInfo, pingPongDelay->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess, sampleOffset);
 
 			// --- run the delay
 			pingPongDelay->render(samplesToProcess);
 
 			// --- copy to output
-			copyAudioBufferOutputToSynthOutput(pingPongDelay->getAudioBuffers(), synthProcessInfo, STEREO_TO_STEREO, samplesToProcess);
+			copyAudioBufferOutputToSynthOutput(pingPongDelay->getAudioBuffers(), synthProcessInfo, STEREO_TO_STEREO, samplesToProcess, sampleOffset);
 		}
 
+		// --- buffer is silent only if every slice was
+		synthProcessInfo.setOutputSilenceFlags(silenceFlags & synthProcessInfo.getOutputSilenceFlags());
+
 		// --- add master volume
-		applyGlobalVolume(synthProcessInfo);
+		applyGlobalVolume(synthProcessInfo, sampleOffset, samplesToProcess);
 
-		// --- note that this is const, and therefore read-only
 		return true;
 	}
 
+	/**
+	\brief
+	Publish the telemetry for a rendered block
+	- the scope gets the final output; the render load is accumulated
+	- at the status rate: voice activity with the EG/LFO outputs of the newest voice,
+	  the wave sequencer LEDs (of voice 0, as with the status meters) and the load
+	- runs only while the bus is enabled; never allocates or blocks
+
+	\param synthProcessInfo the rendered block
+	\param samplesToProcess samples in the block
+	\param renderSeconds time spent in render( ) for the block
+	*/
+	void SynthEngine::writeTelemetry(SynthProcessInfo& synthProcessInfo, uint32_t samplesToProcess, double renderSeconds)
+	{
+		uint32_t outputChannels = synthProcessInfo.getOutputChannelCount();
+		if (outputChannels > 0)
+		{
+			float* left = synthProcessInfo.getOutputBuffer(LEFT_CHANNEL);
+			float* right = outputChannels > 1 ? synthProcessInfo.getOutputBuffer(RIGHT_CHANNEL) : left;
+			telemetry->writeScope(left, right, samplesToProcess);
+		}
+		telemetry->addRenderLoad(renderSeconds, samplesToProcess);
+
+		if (!telemetry->isStatusDue())
+			return;
+
+		// --- voice activity; the newest voice has the lowest timestamp
+		VoiceTelemetry voices;
+		uint32_t newestTimestamp = 0;
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			if (!synthVoices[i]->isVoiceActive())
+				continue;
+
+			if (i < 64)
+				voices.activeVoices |= (uint64_t)1 << i;
+			voices.activeVoiceCount++;
+
+			if (voices.newestVoice < 0 || synthVoices[i]->getTimestamp() < newestTimestamp)
+			{
+				voices.newestVoice = i;
+				newestTimestamp = synthVoices[i]->getTimestamp();
+			}
+		}
+		if (voices.newestVoice >= 0)
+			synthVoices[voices.newestVoice]->getModulatorTelemetry(voices);
+		telemetry->writeVoices(voices);
+
+#ifdef SYNTHLAB_WS
+		// --- sequencer step LEDs
+		WaveSequencerStatusMeters& meters = parameters->voiceParameters->waveSequencerParameters->statusMeters;
+		SequencerTelemetry sequencer;
+		for (uint32_t i = 0; i < MAX_SEQ_STEPS; i++)
+		{
+			sequencer.timingLaneLEDs |= (meters.timingLaneMeter[i] ? 1 : 0) << i;
+			sequencer.waveLaneLEDs |= (meters.waveLaneMeter[i] ? 1 : 0) << i;
+			sequencer.pitchLaneLEDs |= (meters.pitchLaneMeter[i] ? 1 : 0) << i;
+			sequencer.stepSeqLaneLEDs |= (meters.stepSeqLaneMeter[i] ? 1 : 0) << i;
+		}
+		telemetry->writeSequencer(sequencer);
+#endif
+
+		telemetry->writeLoad();
+	}
+
 	/**
 	\brief
 	Apply a single global volume control to output mix buffers
@@ -293,9 +1046,10 @@ namespace SynthLab
 	- pointers to the output audio buffers
 	- optional pointers to input audio buffers (not used in SynthLab)
 
-	\return true if sucessful
+	\param sampleOffset location of the top of the slice in the output buffers
+	\param samplesToProcess slice length
 	*/
-	void SynthEngine::applyGlobalVolume(SynthProcessInfo& synthProcessInfo)
+	void SynthEngine::applyGlobalVolume(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess)
 	{
 		// --- apply global volume
 		//     globalMIDIData[kMIDIMasterVolume] = 0 -> 16383
@@ -304,21 +1058,20 @@ namespace SynthLab
 			midiInputData->getGlobalMIDIData(kMIDIMasterVolumeMSB),
 			0.001, 4.0); /* mapping to -60dB(0.001) to +12dB(4.0) */
 
-		float* synthLeft = synthProcessInfo.getOutputBuffer(LEFT_CHANNEL);
-		float* synthRight = synthProcessInfo.getOutputBuffer(RIGHT_CHANNEL);
-		uint32_t samplesInBlock = synthProcessInfo.getSamplesInBlock();
+		float* synthLeft = synthProcessInfo.getOutputBuffer(LEFT_CHANNEL) + sampleOffset;
+		float* synthRight = synthProcessInfo.getOutputBuffer(RIGHT_CHANNEL) + sampleOffset;
 
-		for (uint32_t i = 0; i < samplesInBlock; i++)
-		{
-			// --- stereo
-			synthLeft[i] *= globalVol;
-			synthRight[i] *= globalVol;
-		}
+		// --- stereo
+		const SynthKernelTable& kernels = getSynthKernels();
+		kernels.applyGain(synthLeft, samplesToProcess, (float)globalVol);
+		kernels.applyGain(synthRight, samplesToProcess, (float)globalVol);
 	}
 
 	/**
 	\brief
 	Accumulates voice buffers into a single mix buffer for each channel.
+	- for use with SynthVoice::render() and the voiceProcessInfo staging buffers; the 
+	  engine's render() uses SynthVoice::renderAccumulate() which skips this step
 
 	\param synthProcessInfo structure containing all information needed
 	about the current block to process including:
@@ -327,24 +1080,27 @@ namespace SynthLab
 	- optional pointers to input audio buffers (not used in SynthLab)
 
 	\param scaling a scalar value to apply while accumulating
+	\param sampleOffset location of the voice slice in the output buffers
 
 	\return true if sucessful
 	*/
-	void SynthEngine::accumulateVoice(SynthProcessInfo& synthProcessInfo, double scaling)
+	void SynthEngine::accumulateVoice(SynthProcessInfo& synthProcessInfo, double scaling, uint32_t sampleOffset)
 	{
-		// --- accumulate results
-		uint32_t samplesInBlock = synthProcessInfo.getSamplesInBlock();
-		float* synthLeft = synthProcessInfo.getOutputBuffer(LEFT_CHANNEL);
-		float* synthRight = synthProcessInfo.getOutputBuffer(RIGHT_CHANNEL);
+		// --- skip silent voices
+		if (voiceProcessInfo.allOutputsSilent())
+			return;
+
+		// --- accumulate results; voice buffer holds the current slice
+		uint32_t samplesInBlock = voiceProcessInfo.getSamplesInBlock();
+		float* synthLeft = synthProcessInfo.getOutputBuffer(LEFT_CHANNEL) + sampleOffset;
+		float* synthRight = synthProcessInfo.getOutputBuffer(RIGHT_CHANNEL) + sampleOffset;
 		float* voiceLeft = voiceProcessInfo.getOutputBuffer(LEFT_CHANNEL);
 		float* voiceRight = voiceProcessInfo.getOutputBuffer(RIGHT_CHANNEL);
 
-		for (uint32_t i = 0; i < samplesInBlock; i++)
-		{
-			// --- stereo
-			synthLeft[i] += voiceLeft[i] * scaling;
-			synthRight[i] += voiceRight[i] * scaling;
-		}
+		// --- stereo
+		const SynthKernelTable& kernels = getSynthKernels();
+		kernels.mixAccumulate(synthLeft, voiceLeft, samplesInBlock, (float)scaling);
+		kernels.mixAccumulate(synthRight, voiceRight, samplesInBlock, (float)scaling);
 	}
 
 	/**
@@ -359,6 +1115,8 @@ namespace SynthLab
 	{
 		if (parameters->enableMIDINoteEvents && event.midiMessage == NOTE_ON)
 		{
+			SYNTHLAB_TRACE_EVENT(TraceEventType::kNoteOn, event.midiData1, event.midiData2);
+
 			// --- set current MIDI data
 			midiInputData->setGlobalMIDIData(kCurrentMIDINoteNumber, event.midiData1);
 			midiInputData->setGlobalMIDIData(kCurrentMIDINoteVelocity, event.midiData2);
@@ -389,6 +1147,8 @@ namespace SynthLab
 				if (voiceIndex < 0)
 				{
 					voiceIndex = getVoiceIndexToSteal();
+					if (voiceIndex >= 0)
+						SYNTHLAB_TRACE_EVENT(TraceEventType::kVoiceSteal, (uint32_t)voiceIndex, event.midiData1);
 				}
 
 				// --- trigger next available note
@@ -414,6 +1174,8 @@ namespace SynthLab
 		}
 		else if (parameters->enableMIDINoteEvents && event.midiMessage == NOTE_OFF)
 		{
+			SYNTHLAB_TRACE_EVENT(TraceEventType::kNoteOff, event.midiData1, event.midiData2);
+
 			// --- for mono, we only use one voice, number [0]
 			if (parameters->synthModeIndex == enumToInt(SynthMode::kMono) ||
 				parameters->synthModeIndex == enumToInt(SynthMode::kLegato))
@@ -527,6 +1289,61 @@ namespace SynthLab
 		// --- store parameters
 		parameters = _parameters;
 
+		// --- volume, pitch bend and tuning go to the MIDI tables
+		setGlobalMIDIData();
+
+		// --- engine mode: poly, mono or unison
+		parameters->voiceParameters->synthModeIndex = parameters->synthModeIndex;
+
+		for (uint32_t i = 0; i < MAX_VOICES; i++)
+		{
+			// --- needed for modules YES
+			synthVoices[i]->update();
+
+			if (synthVoices[i]->isVoiceActive())
+			{
+				// -- note the special handling for unison mode - you could probably
+				//    clean this up
+				if (parameters->synthModeIndex == enumToInt(SynthMode::kUnison) ||
+					parameters->synthModeIndex == enumToInt(SynthMode::kUnisonLegato))
+				{
+					if (i == 0)
+					{
+						parameters->voiceParameters->unisonDetuneCents = 0.0;
+						parameters->voiceParameters->unisonStartPhase = 0.0;
+					}
+					else if (i == 1)
+					{
+						parameters->voiceParameters->unisonDetuneCents = parameters->globalUnisonDetune_Cents;
+						parameters->voiceParameters->unisonStartPhase = 13.0;
+					}
+					else if (i == 2)
+					{
+						parameters->voiceParameters->unisonDetuneCents = -parameters->globalUnisonDetune_Cents;
+						parameters->voiceParameters->unisonStartPhase = -13.0;
+					}
+					else if (i == 3)
+					{
+						parameters->voiceParameters->unisonDetuneCents = 0.707*parameters->globalUnisonDetune_Cents;
+						parameters->voiceParameters->unisonStartPhase = 37.0;
+					}
+				}
+				else
+				{
+					parameters->voiceParameters->unisonStartPhase = 0.0;
+					parameters->voiceParameters->unisonDetuneCents = 0.0;
+				}
+			}
+		}
+	}
+
+	/**
+	\brief
+	Convert the global volume, pitch bend sensitivity and tuning parameters into the MIDI
+	global data that the cores read
+	*/
+	void SynthEngine::setGlobalMIDIData()
+	{
 		// --- master volume maps to MIDI RPN see http://www.somascape.org/midi/tech/spec.html#usx7F0401
 		double globalVolumeRaw = dB2Raw(parameters->globalVolume_dB);
 		boundValue(globalVolumeRaw, 0.001, 4.0);
@@ -571,50 +1388,200 @@ namespace SynthLab
 		bipolarIntToMIDI14_bit(mtFine, -8192, 8191, lsb, msb);
 		midiInputData->setGlobalMIDIData(kMIDIMasterTuneFineMSB, msb);
 		midiInputData->setGlobalMIDIData(kMIDIMasterTuneFineLSB, lsb);
+	}
 
-		// --- engine mode: poly, mono or unison
-		parameters->voiceParameters->synthModeIndex = parameters->synthModeIndex;
-
-		for (uint32_t i = 0; i < MAX_VOICES; i++)
+	/**
+	\brief
+	Write one automated parameter into the shared parameter structures
+	- the modules re-read their parameters at the top of each render slice (and their
+	  change detection skips the ones that did not move), so continuous values need no
+	  notification; render( ) splits the slices at the event offsets
+	- only the objects that cache a parameter are notified: the MIDI global data for the
+	  engine values, the module itself for a new core and the voice render graph for an
+	  oscillator gain; the voices are not update( )-ed as they are in setParameters( )
+	- kModuleIndex only selects cores that are already built (see prepareModuleCores( ));
+	  cores are never built on the audio thread, so the event is refused for any other core
+	  and the module keeps its current one
+	- kShape writes the shape knob (mod knob A), which the oscillator cores turn into the shape
+	- the oscillator fields are not supported in the wave sequencing engine
+
+	\param event the parameter ID (see makeAutomationID( )) and its new value
+
+	\return true if the ID names a supported parameter
+	*/
+	bool SynthEngine::applyParameterEvent(const ParameterEvent& event)
+	{
+		automationTarget target = static_cast<automationTarget>(event.parameterID >> 16);
+		uint32_t instance = (event.parameterID >> 8) & 0xFF;
+		automationField field = static_cast<automationField>(event.parameterID & 0xFF);
+		double value = event.value;
+
+		// --- mod knobs and core index are common to all modules but the DCA; a core index is
+		//     tried on voice 0 first, every voice has the same cores built
+		uint32_t knob = enumToInt(field);
+		bool modKnob = field <= automationField::kModKnobD;
+		uint32_t coreIndex = (uint32_t)(value < 0.0 ? 0.0 : value);
+		std::shared_ptr<SynthVoiceParameters>& voiceParameters = parameters->voiceParameters;
+
+		switch (target)
 		{
-			// --- needed for modules YES
-			synthVoices[i]->update();
+			case automationTarget::kEngine:
+			{
+				if (field == automationField::kOutputGain_dB)
+					parameters->globalVolume_dB = value;
+				else if (field == automationField::kCoarseDetune)
+					parameters->globalTuningCoarse = (int32_t)value;
+				else if (field == automationField::kFineDetune)
+					parameters->globalTuningFine = (int32_t)value;
+				else
+					return false;
 
-			if (synthVoices[i]->isVoiceActive())
+				setGlobalMIDIData();
+				return true;
+			}
+			case automationTarget::kOscillator:
 			{
-				// -- note the special handling for unison mode - you could probably
-				//    clean this up
-				if (parameters->synthModeIndex == enumToInt(SynthMode::kUnison) ||
-					parameters->synthModeIndex == enumToInt(SynthMode::kUnisonLegato))
+#ifdef SYNTHLAB_WS
+				return false;
+#else
+				if (instance >= NUM_OSC)
+					return false;
+
+				auto& oscParameters = voiceParameters->getOscParameters(instance);
+				if (modKnob)
+					oscParameters->modKnobValue[knob] = value;
+				else if (field == automationField::kModuleIndex)
 				{
-					if (i == 0)
-					{
-						parameters->voiceParameters->unisonDetuneCents = 0.0;
-						parameters->voiceParameters->unisonStartPhase = 0.0;
-					}
-					else if (i == 1)
-					{
-						parameters->voiceParameters->unisonDetuneCents = parameters->globalUnisonDetune_Cents;
-						parameters->voiceParameters->unisonStartPhase = 13.0;
-					}
-					else if (i == 2)
-					{
-						parameters->voiceParameters->unisonDetuneCents = -parameters->globalUnisonDetune_Cents;
-						parameters->voiceParameters->unisonStartPhase = -13.0;
-					}
-					else if (i == 3)
-					{
-						parameters->voiceParameters->unisonDetuneCents = 0.707*parameters->globalUnisonDetune_Cents;
-						parameters->voiceParameters->unisonStartPhase = 37.0;
-					}
+					if (!synthVoices[0]->loadOscCore(instance + 1, coreIndex))
+						return false;
+
+					oscParameters->moduleIndex = coreIndex;
+					for (uint32_t i = 1; i < MAX_VOICES; i++)
+						synthVoices[i]->loadOscCore(instance + 1, coreIndex);
+				}
+				else if (field == automationField::kOutputGain_dB)
+				{
+					// --- a silent oscillator is skipped by the render graph
+					oscParameters->outputAmplitude_dB = value;
+					for (uint32_t i = 0; i < MAX_VOICES; i++)
+						synthVoices[i]->analyzePatch();
 				}
+				else if (field == automationField::kPan)
+					oscParameters->panValue = value;
+				else if (field == automationField::kOctaveDetune)
+					oscParameters->octaveDetune = value;
+				else if (field == automationField::kCoarseDetune)
+					oscParameters->coarseDetune = value;
+				else if (field == automationField::kFineDetune)
+					oscParameters->fineDetune = value;
+				else if (field == automationField::kShape)
+					oscParameters->modKnobValue[MOD_KNOB_A] = value;
 				else
+					return false;
+
+				return true;
+#endif
+			}
+			case automationTarget::kLFO:
+			{
+				if (instance >= NUM_LFO)
+					return false;
+
+				std::shared_ptr<LFOParameters>& lfoParameters = voiceParameters->getLFOParameters(instance);
+				if (modKnob)
+					lfoParameters->modKnobValue[knob] = value;
+				else if (field == automationField::kModuleIndex)
 				{
-					parameters->voiceParameters->unisonStartPhase = 0.0;
-					parameters->voiceParameters->unisonDetuneCents = 0.0;
+					if (!synthVoices[0]->loadLFOCore(instance + 1, coreIndex))
+						return false;
+
+					lfoParameters->moduleIndex = coreIndex;
+					for (uint32_t i = 1; i < MAX_VOICES; i++)
+						synthVoices[i]->loadLFOCore(instance + 1, coreIndex);
 				}
+				else if (field == automationField::kFrequency_Hz)
+					lfoParameters->frequency_Hz = value;
+				else if (field == automationField::kOutputAmplitude)
+					lfoParameters->outputAmplitude = value;
+				else
+					return false;
+
+				return true;
+			}
+			case automationTarget::kFilter:
+			{
+				if (instance >= NUM_FILTER)
+					return false;
+
+				std::shared_ptr<FilterParameters>& filterParameters = voiceParameters->getFilterParameters(instance);
+				if (modKnob)
+					filterParameters->modKnobValue[knob] = value;
+				else if (field == automationField::kModuleIndex)
+				{
+					if (!synthVoices[0]->loadFilterCore(instance + 1, coreIndex))
+						return false;
+
+					filterParameters->moduleIndex = coreIndex;
+					for (uint32_t i = 1; i < MAX_VOICES; i++)
+						synthVoices[i]->loadFilterCore(instance + 1, coreIndex);
+				}
+				else if (field == automationField::kFc)
+					filterParameters->fc = value;
+				else if (field == automationField::kQ)
+					filterParameters->Q = value;
+				else if (field == automationField::kOutputGain_dB)
+					filterParameters->filterOutputGain_dB = value;
+				else
+					return false;
+
+				return true;
+			}
+			case automationTarget::kAmpEG:
+			case automationTarget::kFilterEG:
+			case automationTarget::kAuxEG:
+			{
+				uint32_t egIndex = enumToInt(target) - enumToInt(automationTarget::kAmpEG);
+				std::shared_ptr<EGParameters>& egParameters = egIndex == 0 ? voiceParameters->ampEGParameters :
+					(egIndex == 1 ? voiceParameters->filterEGParameters : voiceParameters->auxEGParameters);
+
+				if (modKnob)
+					egParameters->modKnobValue[knob] = value;
+				else if (field == automationField::kModuleIndex)
+				{
+					if (!synthVoices[0]->loadEGCore(egIndex + 1, coreIndex))
+						return false;
+
+					egParameters->moduleIndex = coreIndex;
+					for (uint32_t i = 1; i < MAX_VOICES; i++)
+						synthVoices[i]->loadEGCore(egIndex + 1, coreIndex);
+				}
+				else if (field == automationField::kAttackTime_mSec)
+					egParameters->attackTime_mSec = value;
+				else if (field == automationField::kDecayTime_mSec)
+					egParameters->decayTime_mSec = value;
+				else if (field == automationField::kSustainLevel)
+					egParameters->sustainLevel = value;
+				else if (field == automationField::kReleaseTime_mSec)
+					egParameters->releaseTime_mSec = value;
+				else
+					return false;
+
+				return true;
+			}
+			case automationTarget::kDCA:
+			{
+				if (field == automationField::kOutputGain_dB)
+					voiceParameters->dcaParameters->gainValue_dB = value;
+				else if (field == automationField::kPan)
+					voiceParameters->dcaParameters->panValue = value;
+				else
+					return false;
+
+				return true;
 			}
 		}
+
+		return false;
 	}
 
 	/**
@@ -7,6 +7,14 @@
 // --- SynthLab SDK items
 #include "../../source/synthbase.h"
 #include "../../source/audiodelay.h"
+#include "../../source/convolver.h"
+#include "../../source/residencymanager.h"
+#include "../../source/synthpatch.h"
+#include "../../source/synthtelemetry.h"
+#include "../../source/wavetableimporter.h"
+#include "../../source/workerpool.h"
+
+#include <atomic>
 
 // -----------------------------
 //	--- SynthLab SDK File --- // 
@@ -65,6 +73,10 @@ namespace SynthLab
 		// --- unison Detune - this is the max detuning value NOTE a standard (or RPN or NRPN) parameter :/
 		double globalUnisonDetune_Cents = 0.0;
 
+		// --- render order: false = voice by voice; true = stage by stage across the active voices
+		//     (all LFOs, then all EGs, ...); the output is the same, see SynthEngine::renderSlice( )
+		bool moduleMajorRendering = false;
+
 		// --- VOICE layer parameters
 		std::shared_ptr<SynthVoiceParameters> voiceParameters = std::make_shared<SynthVoiceParameters>();
 
@@ -76,8 +88,74 @@ namespace SynthLab
 		// --- FX is unique to engine, not part of voice
 		std::shared_ptr<AudioDelayParameters> audioDelayParameters = std::make_shared<AudioDelayParameters>();
 		bool enableDelayFX = false;
+
+		// --- cabinet/body convolver, ahead of the delay; the impulse response is loaded
+		//     with SynthEngine::loadImpulseResponse( )
+		std::shared_ptr<ConvolverParameters> convolverParameters = std::make_shared<ConvolverParameters>();
+		bool enableConvolverFX = false;
 	};
 
+	/**
+	\struct PreparedPatch
+	\ingroup SynthEngine
+
+	\brief A patch that has been read and prepared on a background thread and is waiting
+	for the audio thread to switch to it
+	- holds its own parameter tree; the values are copied into the engine's tree at the switch
+	  (no tree: cores only, from SynthEngine::prepareModuleCores( ))
+	- holds the cores the patch needs that were not instantiated yet, built and reset
+
+	\author Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2017 / 09 / 24
+	*/
+	struct PreparedPatch
+	{
+		std::shared_ptr<SynthEngineParameters> parameters = std::make_shared<SynthEngineParameters>();
+		PreparedCoreList cores;
+	};
+
+	/**
+	\enum automationTarget
+	\ingroup SynthEngine
+	\brief The object a ParameterEvent writes to; the instance (0-based) picks the oscillator,
+	LFO or filter
+	*/
+	enum class automationTarget : uint32_t { kEngine, kOscillator, kLFO, kFilter, kAmpEG, kFilterEG, kAuxEG, kDCA };
+
+	/**
+	\enum automationField
+	\ingroup SynthEngine
+	\brief The parameter a ParameterEvent writes; each target supports the fields listed next
+	to them, see SynthEngine::applyParameterEvent( )
+	*/
+	enum class automationField : uint32_t
+	{
+		kModKnobA, kModKnobB, kModKnobC, kModKnobD,	// --- oscillators, LFOs, filters, EGs
+		kModuleIndex,								// --- oscillators, LFOs, filters, EGs: core selection, built cores only
+		kOutputGain_dB,								// --- engine (global volume), oscillators, filters, DCA
+		kPan,										// --- oscillators, DCA
+		kOctaveDetune, kCoarseDetune, kFineDetune,	// --- oscillators; coarse/fine are also the engine tuning
+		kShape,										// --- oscillators: the shape knob, same as kModKnobA
+		kFrequency_Hz, kOutputAmplitude,			// --- LFOs
+		kFc, kQ,									// --- filters
+		kAttackTime_mSec, kDecayTime_mSec, kSustainLevel, kReleaseTime_mSec	// --- EGs
+	};
+
+	/**
+	\brief packs a target, instance and field into a ParameterEvent::parameterID
+
+	\param target object to write to
+	\param instance 0-based oscillator, LFO or filter index; 0 for the others
+	\param field parameter to write
+
+	\return the parameter ID
+	*/
+	inline uint32_t makeAutomationID(automationTarget target, uint32_t instance, automationField field)
+	{
+		return (enumToInt(target) << 16) | ((instance & 0xFF) << 8) | (enumToInt(field) & 0xFF);
+	}
+
 
 	/**
 	\class SynthEngine
@@ -86,6 +164,7 @@ namespace SynthLab
 	(e.g. Virtual Analog, Sample Based, FM, etc...) 
 	- contains an array of SynthVoice objects to render audio and also processes MIDI events
 	- contains an audio delay used as a master-buss effect
+	- contains a convolver for cabinet and body impulse responses, ahead of the delay
 	- contains functions to interface with framework to deliver dynamic string lists (advanced GUI)
 	- creates the global MIDI data object and passes shared pointers to all voices
 	- creates the wavetable database object and passes shared pointers to all voices
@@ -98,7 +177,7 @@ namespace SynthLab
 	class SynthEngine
 	{
 	public:
-		SynthEngine(uint32_t blockSize = 64, DMConfig* config = nullptr);
+		SynthEngine(uint32_t _blockSize = 64, DMConfig* config = nullptr);
 		virtual ~SynthEngine();
 		
 		/** main functions, declared as virtual so you can use as as base class if needed*/
@@ -108,8 +187,8 @@ namespace SynthLab
 		virtual bool initialize(const char* dllPath = nullptr);
 
 		/** Functions to help with rendering the final synth output audio stream */
-		void accumulateVoice(SynthProcessInfo& synthProcessInfo, double scaling = 0.707);
-		void applyGlobalVolume(SynthProcessInfo& synthProcessInfo);
+		void accumulateVoice(SynthProcessInfo& synthProcessInfo, double scaling = 0.707, uint32_t sampleOffset = 0);
+		void applyGlobalVolume(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess);
 
 		// --- get parameters
 		void getParameters(std::shared_ptr<SynthEngineParameters>& _parameters) { _parameters = parameters; }
@@ -117,6 +196,10 @@ namespace SynthLab
 		// --- set parameters
 		void setParameters(std::shared_ptr<SynthEngineParameters>& _parameters);
 
+		/** write one automated parameter and notify only the objects that depend on it; render( )
+		    calls this for the SynthProcessInfo parameter events at their sample offsets */
+		bool applyParameterEvent(const ParameterEvent& event);
+
 		/** Voice stealing helper functions */
 		int getFreeVoiceIndex();
 		int getVoiceIndexToSteal();
@@ -136,10 +219,93 @@ namespace SynthLab
 		void setDynamicModules(std::vector<std::shared_ptr<SynthLab::ModuleCore>> modules, uint32_t voiceIndex);
 		std::vector<std::string> getModuleCoreNames(uint32_t moduleType);
 
+		/** OPTIONAL: memory accounting tree for the engine, voices, modules, cores and databases;
+		    NOT real-time safe (allocates the report) - call from a UI or diagnostics thread */
+		void getMemoryReport(MemoryReport& report);
+
+		/** OPTIONAL: update( ) change detection counters summed over the voices; the hit rate is
+		    the fraction of updates that found their inputs unchanged and skipped the recalculation */
+		UpdateCounters getUpdateCounters();
+
+		/** OPTIONAL: prefault (and lock, if enabled on the residency manager) the tables and samples
+		    the voices can read, and release the rest; reset( ) calls this, call it again after
+		    selecting new cores or loading a patch - NOT real-time safe */
+		bool updateResidency();
+
+		/** residency settings, statistics and render page fault counts */
+		ResidencyManager& getResidencyManager() { return residencyManager; }
+
+		/** OPTIONAL: binary patches (see synthpatch.h)
+		    - savePatch( ) writes the current parameters; call from the GUI thread
+		    - preparePatch( ) reads a patch and builds the cores it needs on the calling (background)
+		      thread; the audio thread switches to it at the top of the next render( ) call
+		    - one patch at a time: false if the last one has not been switched to yet, or if the data
+		      is not a patch for this synth */
+		bool savePatch(std::vector<uint8_t>& patchData);
+		bool preparePatch(const uint8_t* patchData, uint32_t patchSize);
+		bool isPatchPending() { return pendingPatch.load(std::memory_order_acquire) != nullptr; }
+
+		/** OPTIONAL: builds the cores that the current parameters select but that are not built
+		    yet, on the calling (GUI or loader) thread; the audio thread installs them at the top
+		    of the next render( ) call and selects them; call after changing a moduleIndex
+		    - until then the voices keep their current cores; cores are never built on the audio thread
+		    - false if a patch is still pending, call again after it was switched to */
+		bool prepareModuleCores();
+		static uint32_t getPatchVariantID();
+
+		/** OPTIONAL: cabinet/body impulse response for the convolver FX, from a WAV file
+		    - NOT real-time safe; call from a loader or GUI thread, the audio thread switches
+		      to it at the top of the next render( ) call
+		    - enable it with SynthEngineParameters::enableConvolverFX */
+		bool loadImpulseResponse(const char* wavFilePath) { return cabinetConvolver->loadImpulseResponse(wavFilePath); }
+
+		/** OPTIONAL: wavetables from single-cycle or multi-frame WAV files (see wavetableimporter.h)
+		    - the band-limited tables are built for the current sample rate on the import's own
+		      worker pool, and rebuilt when reset( ) changes the rate
+		    - the frames are added to the wavetable database as waveformName ("waveformName 1" ...
+		      for multi-frame files); under the name of a built-in waveform it replaces that
+		      waveform, before or after reset( ): the Classic, Fourier and Morph WT cores switch to
+		      it on their next update (the Drum and SFX cores time their one-shots by their own tables)
+		    - NOT real-time safe; call from a loader or GUI thread, while the audio thread renders
+		      if need be; imports are serialized with each other and with reset( )
+		    - a name that was already imported is refused
+		    - call updateResidency( ) afterwards to lock the frames the patch now uses
+		    - frameLength = 0 detects single-cycle vs. 2048 sample frames */
+		bool importWavetable(const char* wavFilePath, const char* waveformName, uint32_t frameLength = 0);
+
+		/** OPTIONAL: telemetry for meters, scopes and sequencer LEDs (see synthtelemetry.h)
+		    - the GUI thread enables the bus and drains its channels; while it is disabled
+		      render( ) does no telemetry work at all */
+		SynthTelemetry& getTelemetry() { return *telemetry; }
+
 	protected:
+		/** render one slice (<= blockSize) of the output at some offset */
+		bool renderSlice(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess);
+
+		/** convert the global volume, pitch bend and tuning parameters into MIDI global data */
+		void setGlobalMIDIData();
+
+		/** audio thread: publish the telemetry for a rendered block */
+		void writeTelemetry(SynthProcessInfo& synthProcessInfo, uint32_t samplesToProcess, double renderSeconds);
+
+		/** hands a prepared patch (or core set) to the audio thread */
+		void postPreparedPatch(PreparedPatch* patch);
+
+		/** audio thread: install a prepared patch's cores and parameters */
+		void applyPreparedPatch(PreparedPatch* patch);
+
+		/** the reset pool, created on first use */
+		WorkerPool* getResetPool();
+
 		// --- only need one for iteration
 		SynthProcessInfo voiceProcessInfo;
 
+		// --- internal render slice size, fixed at construction
+		uint32_t blockSize = 64;
+
+		// --- for slice timestamps
+		double sampleRate = 44100.0;
+
 		// --- our modifiers (parameters)
 		// --- SynthEngineParameters parameters;
 		std::shared_ptr<SynthEngineParameters> parameters = std::make_shared<SynthEngineParameters>();
@@ -149,7 +315,7 @@ namespace SynthLab
 		std::shared_ptr<MidiOutputData> midiOutputData = std::make_shared<MidiOutputData>();
 
 		// --- array of voice object, via pointers
-		std::unique_ptr<SynthVoice> synthVoices[MAX_VOICES] = { 0, 0, 0, 0 };		///< array of voice objects for the engine
+		std::unique_ptr<SynthVoice> synthVoices[MAX_VOICES] = { nullptr };		///< array of voice objects for the engine
 				
 		// --- shared tables, in case they are huge or need a long creation time
 		std::shared_ptr<WavetableDatabase> wavetableDatabase = nullptr;
@@ -157,8 +323,33 @@ namespace SynthLab
 		// --- shared tables, in case they are huge or need a long creation time
 		std::shared_ptr<PCMSampleDatabase> sampleDatabase = nullptr;
 
+		// --- wavetables imported from WAV files; their sources are in the wavetable database
+		//     - the list, the rate and the import pool are guarded by importMutex, which is held
+		//       for a whole import and while reset( ) rebuilds; the audio thread never takes it
+		std::vector<std::shared_ptr<ImportedWavetable>> importedWavetables;
+		double importSampleRate = 44100.0;
+		std::mutex importMutex;
+		std::unique_ptr<WorkerPool> importPool = nullptr;
+
 		// --- ADD FX Here...
 		std::unique_ptr<AudioDelay> pingPongDelay = nullptr;
+		std::unique_ptr<Convolver> cabinetConvolver = nullptr;
+
+		// --- audio thread -> GUI meters, scopes and status
+		std::unique_ptr<SynthTelemetry> telemetry = nullptr;
+
+		// --- keeps the database memory of the active patch resident
+		ResidencyManager residencyManager;
+
+		// --- splits reset( ) across the CPU cores; created on the first reset, only used by reset( )
+		std::unique_ptr<WorkerPool> resetPool = nullptr;
+
+		// --- patch switching: prepared -> pending -> (audio thread) -> retired -> deleted by the
+		//     next preparePatch( ), so the audio thread never allocates or frees a patch
+		//     - the audio thread stores retired before it clears pending, and preparePatch( )
+		//       reads pending before it collects retired
+		std::atomic<PreparedPatch*> pendingPatch{ nullptr };
+		std::atomic<PreparedPatch*> retiredPatch{ nullptr };
 	};
 
 }
@@ -15,6 +15,9 @@
 // -----------------------------------------------------------------------------
 namespace SynthLab
 {
+	// --- the LFO normal output sources are not consecutive (LFO1 has an extra output)
+	static const uint32_t lfoNormalSource[MAX_NUM_LFO] = { kSourceLFO1_Norm, kSourceLFO2_Norm };
+
 	/**
 	\brief
 	Construction:
@@ -32,6 +35,8 @@ namespace SynthLab
 	\param _wavetableDatabase shared pointer to wavetable database; created on SynthEngine
 	\param _sampleDatabase shared pointer to PCM sample database; created on SynthEngine
 	\param blockSize the block size to be used for the lifetime of operation; OK if arriving blocks are smaller than this value, NOT OK if larger
+	\param prototype OPTIONAL fully constructed voice sharing the same parameters; this voice is still
+	fully constructed, only the render graph analysis is copied from it (see copyRenderGraph( ))
 
 	\returns the newly constructed object
 	*/
@@ -40,7 +45,8 @@ namespace SynthLab
 		std::shared_ptr<SynthVoiceParameters> _parameters,
 		std::shared_ptr<WavetableDatabase> _wavetableDatabase,
 		std::shared_ptr<PCMSampleDatabase> _sampleDatabase,
-		uint32_t _blockSize)
+		uint32_t _blockSize,
+		SynthVoice* prototype)
 		: midiInputData(_midiInputData)		//<- set our midi dat interface value
 		, midiOutputData(_midiOutputData)
 		, parameters(_parameters)	//<- set our parameters
@@ -54,6 +60,9 @@ namespace SynthLab
 		if (!midiOutputData)
 			midiOutputData.reset(new (MidiOutputData));
 
+		// --- shared, read-only per-note tables
+		lookupTables = &BasicLookupTables::getSharedTables();
+
 		// --- this happens in stand-alone mode; does not happen otherwise;
 		//     the first initialized SynthLab component creates its own parameters
 		if (!parameters)
@@ -63,12 +72,12 @@ namespace SynthLab
 		//           locally, so they do not need to be checked here.
 
 		// --- LFOs
-		lfo[0].reset(new SynthLFO(midiInputData, parameters->lfo1Parameters, blockSize));
-		lfo[1].reset(new SynthLFO(midiInputData, parameters->lfo2Parameters, blockSize));
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			lfo[i].reset(new SynthLFO(midiInputData, parameters->getLFOParameters(i), blockSize));
 
 		// --- initialize cores; may be overwritten if you use dynamic strings
 		for (uint32_t i = 0; i < NUM_LFO; i++) {
-			lfo[i]->selectModuleCore(enumToInt(lfoCores[i]));
+			lfo[i]->instantiateAndSelectModuleCore(enumToInt(lfoCores[i]));
 		}
 
 		// --- EGs
@@ -77,74 +86,65 @@ namespace SynthLab
 		auxEG.reset(new EnvelopeGenerator(midiInputData, parameters->auxEGParameters, blockSize));
 
 		// --- initialize cores; may be overwritten if you use dynamic strings
-		ampEG->selectModuleCore(enumToInt(ampEGCore));
-		filterEG->selectModuleCore(enumToInt(filterEGCore));
-		auxEG->selectModuleCore(enumToInt(auxEGCore));
+		ampEG->instantiateAndSelectModuleCore(enumToInt(ampEGCore));
+		filterEG->instantiateAndSelectModuleCore(enumToInt(filterEGCore));
+		auxEG->instantiateAndSelectModuleCore(enumToInt(auxEGCore));
 
 		// --- filters
-		filter[0].reset(new SynthFilter(midiInputData, parameters->filter1Parameters, blockSize));
-		filter[1].reset(new SynthFilter(midiInputData, parameters->filter2Parameters, blockSize));
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+		{
+			filter[i].reset(new SynthFilter(midiInputData, parameters->getFilterParameters(i), blockSize));
 
-		// --- setup the Analog FGN if desired
-		parameters->filter1Parameters->analogFGN = midiInputData->getAuxDAWDataUINT(kAnalogFGNFilters) == 1;
-		parameters->filter2Parameters->analogFGN = midiInputData->getAuxDAWDataUINT(kAnalogFGNFilters) == 1;
+			// --- setup the Analog FGN if desired
+			parameters->getFilterParameters(i)->analogFGN = midiInputData->getAuxDAWDataUINT(kAnalogFGNFilters) == 1;
+		}
 
 		// --- initialize cores; may be overwritten if you use dynamic strings
 		for (uint32_t i = 0; i < NUM_FILTER; i++) {
-			filter[i]->selectModuleCore(enumToInt(filterCores[i]));
+			filter[i]->instantiateAndSelectModuleCore(enumToInt(filterCores[i]));
 		}
 
-		// --- SYNTHLAB-WT: 4 wavetable oscillators
+		// --- SYNTHLAB-WT: NUM_OSC wavetable oscillators
 #ifdef SYNTHLAB_WT
-		oscillator[0].reset(new WTOscillator(midiInputData, parameters->osc1Parameters, wavetableDatabase, blockSize));
-		oscillator[1].reset(new WTOscillator(midiInputData, parameters->osc2Parameters, wavetableDatabase, blockSize));
-		oscillator[2].reset(new WTOscillator(midiInputData, parameters->osc3Parameters, wavetableDatabase, blockSize));
-		oscillator[3].reset(new WTOscillator(midiInputData, parameters->osc4Parameters, wavetableDatabase, blockSize));
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			oscillator[i].reset(new WTOscillator(midiInputData, parameters->getOscParameters(i), wavetableDatabase, blockSize));
 
 		// --- initialize cores; may be overwritten if you use dynamic strings
 		for (uint32_t i = 0; i < NUM_OSC; i++) {
-			oscillator[i]->selectModuleCore(enumToInt(wtCores[i]));
+			oscillator[i]->instantiateAndSelectModuleCore(enumToInt(wtCores[i]));
 		}
 #elif SYNTHLAB_VA
-		oscillator[0].reset(new VAOscillator(midiInputData, parameters->osc1Parameters, blockSize));
-		oscillator[1].reset(new VAOscillator(midiInputData, parameters->osc2Parameters, blockSize));
-		oscillator[2].reset(new VAOscillator(midiInputData, parameters->osc3Parameters, blockSize));
-		oscillator[3].reset(new VAOscillator(midiInputData, parameters->osc4Parameters, blockSize));
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			oscillator[i].reset(new VAOscillator(midiInputData, parameters->getOscParameters(i), blockSize));
 
 		// --- initialize cores; for VA there is only one so this is not really needed
 		//     keeping the code in case there are more cores in the future
 		for (uint32_t i = 0; i < NUM_OSC; i++) {
-			oscillator[i]->selectModuleCore(0);
+			oscillator[i]->instantiateAndSelectModuleCore(0);
 		}
 #elif SYNTHLAB_PCM
-		oscillator[0].reset(new PCMOscillator(midiInputData, parameters->osc1Parameters, sampleDatabase, blockSize));
-		oscillator[1].reset(new PCMOscillator(midiInputData, parameters->osc2Parameters, sampleDatabase, blockSize));
-		oscillator[2].reset(new PCMOscillator(midiInputData, parameters->osc3Parameters, sampleDatabase, blockSize));
-		oscillator[3].reset(new PCMOscillator(midiInputData, parameters->osc4Parameters, sampleDatabase, blockSize));
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			oscillator[i].reset(new PCMOscillator(midiInputData, parameters->getOscParameters(i), sampleDatabase, blockSize));
 
 		// --- initialize cores; 
 		for (uint32_t i = 0; i < NUM_OSC; i++) {
-			oscillator[i]->selectModuleCore(enumToInt(pcmCores[i]));// enumToInt(pcmCores[i]));
+			oscillator[i]->instantiateAndSelectModuleCore(enumToInt(pcmCores[i]));// enumToInt(pcmCores[i]));
 		}
 #elif SYNTHLAB_KS
-		oscillator[0].reset(new KSOscillator(midiInputData, parameters->osc1Parameters, blockSize));
-		oscillator[1].reset(new KSOscillator(midiInputData, parameters->osc2Parameters, blockSize));
-		oscillator[2].reset(new KSOscillator(midiInputData, parameters->osc3Parameters, blockSize));
-		oscillator[3].reset(new KSOscillator(midiInputData, parameters->osc4Parameters, blockSize));
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			oscillator[i].reset(new KSOscillator(midiInputData, parameters->getOscParameters(i), blockSize));
 
 		// --- initialize cores; 
 		for (uint32_t i = 0; i < NUM_OSC; i++) {
-			oscillator[i]->selectModuleCore(0);
+			oscillator[i]->instantiateAndSelectModuleCore(0);
 		}
 #elif SYNTHLAB_DX
-		oscillator[0].reset(new FMOperator(midiInputData, parameters->osc1Parameters, wavetableDatabase, blockSize));
-		oscillator[1].reset(new FMOperator(midiInputData, parameters->osc2Parameters, wavetableDatabase, blockSize));
-		oscillator[2].reset(new FMOperator(midiInputData, parameters->osc3Parameters, wavetableDatabase, blockSize));
-		oscillator[3].reset(new FMOperator(midiInputData, parameters->osc4Parameters, wavetableDatabase, blockSize));
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			oscillator[i].reset(new FMOperator(midiInputData, parameters->getOscParameters(i), wavetableDatabase, blockSize));
 
 		// --- initialize cores; 
 		for (uint32_t i = 0; i < NUM_OSC; i++) {
-			oscillator[i]->selectModuleCore(0);
+			oscillator[i]->instantiateAndSelectModuleCore(0);
 		}
 #elif SYNTHLAB_WS
 		// --- two WS oscillators: one main oscillator
@@ -174,8 +174,8 @@ namespace SynthLab
 		// --- (2) setup possible sources and destinations; can also be done on the fly
 		//
 		// --- 8 sources
-		modMatrix->addModSource(kSourceLFO1_Norm, lfo[0]->getModulationOutput()->getModArrayPtr(kLFONormalOutput));
-		modMatrix->addModSource(kSourceLFO2_Norm, lfo[1]->getModulationOutput()->getModArrayPtr(kLFONormalOutput));
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			modMatrix->addModSource(lfoNormalSource[i], lfo[i]->getModulationOutput()->getModArrayPtr(kLFONormalOutput));
 
 		// --- tremolo mod
 		modMatrix->addModSource(kSourceAmpEG_Norm, ampEG->getModulationOutput()->getModArrayPtr(kEGNormalOutput));
@@ -189,29 +189,20 @@ namespace SynthLab
 		// --- 26 destinations
 		// 
 #ifndef SYNTHLAB_WS
-		// --- oscillators
-		modMatrix->addModDestination(kDestOsc1_fo, oscillator[0]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		modMatrix->addModDestination(kDestOsc2_fo, oscillator[1]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		modMatrix->addModDestination(kDestOsc3_fo, oscillator[2]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		modMatrix->addModDestination(kDestOsc4_fo, oscillator[3]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		// --- oscillators (the destinations for oscillators 1 - 4 are consecutive)
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+			modMatrix->addModDestination(kDestOsc1_fo + i, oscillator[i]->getModulationInput()->getModArrayPtr(kBipolarMod));
 
-		// --- kUniqueMod is specific to each oscillator; 
-		modMatrix->addModDestination(kDestOsc1_Mod, oscillator[0]->getModulationInput()->getModArrayPtr(kUniqueMod));
-		modMatrix->addModDestination(kDestOsc2_Mod, oscillator[1]->getModulationInput()->getModArrayPtr(kUniqueMod));
-		modMatrix->addModDestination(kDestOsc3_Mod, oscillator[2]->getModulationInput()->getModArrayPtr(kUniqueMod));
-		modMatrix->addModDestination(kDestOsc4_Mod, oscillator[3]->getModulationInput()->getModArrayPtr(kUniqueMod));
+			// --- kUniqueMod is specific to each oscillator; 
+			modMatrix->addModDestination(kDestOsc1_Mod + i, oscillator[i]->getModulationInput()->getModArrayPtr(kUniqueMod));
 
-		// --- connect to morphing wavetable oscillators
-		modMatrix->addModDestination(kDestOsc1_Morph, oscillator[0]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-		modMatrix->addModDestination(kDestOsc2_Morph, oscillator[1]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-		modMatrix->addModDestination(kDestOsc3_Morph, oscillator[2]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-		modMatrix->addModDestination(kDestOsc4_Morph, oscillator[3]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
+			// --- connect to morphing wavetable oscillators
+			modMatrix->addModDestination(kDestOsc1_Morph + i, oscillator[i]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
 
-		// --- shape mod is no on the mod matrix GUI (homework)
-		modMatrix->addModDestination(kDestOsc1_Shape, oscillator[0]->getModulationInput()->getModArrayPtr(kShapeMod));
-		modMatrix->addModDestination(kDestOsc2_Shape, oscillator[1]->getModulationInput()->getModArrayPtr(kShapeMod));
-		modMatrix->addModDestination(kDestOsc3_Shape, oscillator[2]->getModulationInput()->getModArrayPtr(kShapeMod));
-		modMatrix->addModDestination(kDestOsc4_Shape, oscillator[3]->getModulationInput()->getModArrayPtr(kShapeMod));
+			// --- shape mod is no on the mod matrix GUI (homework)
+			modMatrix->addModDestination(kDestOsc1_Shape + i, oscillator[i]->getModulationInput()->getModArrayPtr(kShapeMod));
+		}
 
 #elif defined SYNTHLAB_WS
 		// --- oscillators
@@ -327,8 +318,8 @@ namespace SynthLab
 
 #endif
 		// --- LFOs
-		modMatrix->addModDestination(kDestLFO1_fo, lfo[0]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		modMatrix->addModDestination(kDestLFO2_fo, lfo[1]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			modMatrix->addModDestination(kDestLFO1_fo + i, lfo[i]->getModulationInput()->getModArrayPtr(kBipolarMod));
 
 		// --- EGs
 		modMatrix->addModDestination(kDestDCA_EGMod, dca->getModulationInput()->getModArrayPtr(kEGMod));
@@ -336,10 +327,11 @@ namespace SynthLab
 		modMatrix->addModDestination(kDestDCA_PanMod, dca->getModulationInput()->getModArrayPtr(kPanMod));
 
 		// --- FILTERS
-		modMatrix->addModDestination(kDestFilter1_fc_EG, filter[0]->getModulationInput()->getModArrayPtr(kEGMod));
-		modMatrix->addModDestination(kDestFilter1_fc_Bipolar, filter[0]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		modMatrix->addModDestination(kDestFilter2_fc_EG, filter[1]->getModulationInput()->getModArrayPtr(kEGMod));
-		modMatrix->addModDestination(kDestFilter2_fc_Bipolar, filter[1]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+		{
+			modMatrix->addModDestination(kDestFilter1_fc_EG + i, filter[i]->getModulationInput()->getModArrayPtr(kEGMod));
+			modMatrix->addModDestination(kDestFilter1_fc_Bipolar + i, filter[i]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		}
 
 		// --- EG Re-triggers
 		modMatrix->addModDestination(kDestAmpEGRetrigger, ampEG->getModulationInput()->getModArrayPtr(kTriggerMod), kMMTransformUnipolar);
@@ -350,11 +342,348 @@ namespace SynthLab
 		parameters->modMatrixParameters->setMM_DestDefaultValue(kDestDCA_AmpMod, 1.0);
 
 		// --- connect AuxEG to morph mod
-		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc1_Morph);
-		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc2_Morph);
-		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc3_Morph);
-		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc4_Morph);
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc1_Morph + i);
+
+		// --- find module owners of mod sources/destinations and run the first patch analysis
+		if (prototype)
+			copyRenderGraph(prototype);
+		else
+			buildRenderGraph();
+	}
+
+	/**
+	\brief
+	Skips the render graph analysis by copying its result from a voice that was constructed with
+	the same parameters
+	- this is NOT a clone: the modules, cores, buffers and mod matrix wiring of this voice were
+	  all built by the constructor; only buildRenderGraph( ) is replaced
+	- the owner tables hold node indexes, not pointers, so they are identical for every voice
+	- instantiates the same lazily-built cores as the prototype and selects the same cores so 
+	  this voice is in the same state without querying any core strings
+	- the analysis is a small part of constructing a voice, so the saving is small
+
+	\param prototype the voice to copy from
+	*/
+	void SynthVoice::copyRenderGraph(SynthVoice* prototype)
+	{
+		memcpy(modSourceOwner, prototype->modSourceOwner, sizeof(modSourceOwner));
+		memcpy(modDestinationOwner, prototype->modDestinationOwner, sizeof(modDestinationOwner));
+		memcpy(moduleLive, prototype->moduleLive, sizeof(moduleLive));
+
+		auto mirrorCores = [](SynthModule* clone, SynthModule* source)
+		{
+			for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
+			{
+				if (source->isModuleCoreInstantiated(i))
+					clone->instantiateModuleCore(i);
+			}
+			clone->selectModuleCore(source->getSelectedCoreIndex());
+		};
+
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			mirrorCores(lfo[i].get(), prototype->lfo[i].get());
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			mirrorCores(filter[i].get(), prototype->filter[i].get());
+
+		mirrorCores(ampEG.get(), prototype->ampEG.get());
+		mirrorCores(filterEG.get(), prototype->filterEG.get());
+		mirrorCores(auxEG.get(), prototype->auxEG.get());
+
+#ifndef SYNTHLAB_WS
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			mirrorCores(oscillator[i].get(), prototype->oscillator[i].get());
+#endif
+	}
+
+	/**
+	\brief
+	Memory accounting for one voice
+	- owned: the voice object (including DC filters and render graph tables), mix buffers and mod matrix
+	- each module adds itself and its cores as a child node
+
+	\param report the node for this voice
+	*/
+	void SynthVoice::getMemoryReport(MemoryReport& report)
+	{
+		uint64_t bytes = sizeof(SynthVoice);
+		if (mixBuffers)
+			bytes += sizeof(AudioBuffer) + mixBuffers->getAllocatedBytes();
+		if (modMatrix)
+			bytes += sizeof(ModMatrix);
+		report.ownedBytes += bytes;
+		report.residentBytes += estimateResidentBytes(bytes);
+
+#ifdef SYNTHLAB_WS
+		if (waveSequencer)
+			waveSequencer->getMemoryReport(report.addChild("Wave Sequencer"));
+		for (uint32_t i = 0; i < NUM_WS_OSC; i++)
+		{
+			if (wsOscillator[i])
+				wsOscillator[i]->getMemoryReport(report.addChild("WS Osc " + std::to_string(i + 1)));
+		}
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+			if (oscillator[i])
+				oscillator[i]->getMemoryReport(report.addChild("Osc " + std::to_string(i + 1)));
+		}
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			lfo[i]->getMemoryReport(report.addChild("LFO " + std::to_string(i + 1)));
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			filter[i]->getMemoryReport(report.addChild("Filter " + std::to_string(i + 1)));
+
+		ampEG->getMemoryReport(report.addChild("Amp EG"));
+		filterEG->getMemoryReport(report.addChild("Filter EG"));
+		auxEG->getMemoryReport(report.addChild("Aux EG"));
+		dca->getMemoryReport(report.addChild("DCA"));
+	}
+
+	/**
+	\brief
+	Residency: adds the wavetable and PCM sample sources the oscillators' selected cores can
+	read; the other modules do not read the databases
+
+	\param sources the list to add to
+	*/
+	void SynthVoice::addReachableSources(ReachableSources& sources)
+	{
+#ifdef SYNTHLAB_WS
+		for (uint32_t i = 0; i < NUM_WS_OSC; i++)
+		{
+			if (wsOscillator[i])
+				wsOscillator[i]->addReachableSources(sources);
+		}
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+			if (oscillator[i])
+				oscillator[i]->addReachableSources(sources);
+		}
+#endif
+	}
+
+	/**
+	\brief
+	Change detection: adds the update( ) counters of every module and its cores
+
+	\param counters the sum to add to
+	*/
+	void SynthVoice::addUpdateCounters(UpdateCounters& counters)
+	{
+#ifdef SYNTHLAB_WS
+		if (waveSequencer)
+			waveSequencer->addUpdateCounters(counters);
+		for (uint32_t i = 0; i < NUM_WS_OSC; i++)
+		{
+			if (wsOscillator[i])
+				wsOscillator[i]->addUpdateCounters(counters);
+		}
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+			if (oscillator[i])
+				oscillator[i]->addUpdateCounters(counters);
+		}
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			lfo[i]->addUpdateCounters(counters);
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			filter[i]->addUpdateCounters(counters);
+
+		ampEG->addUpdateCounters(counters);
+		filterEG->addUpdateCounters(counters);
+		auxEG->addUpdateCounters(counters);
+		dca->addUpdateCounters(counters);
+	}
+
+	/**
+	\brief
+	Telemetry: copies the EG and LFO outputs, as they were at the end of the last render slice
+
+	\param telemetry the voice telemetry item to fill
+	*/
+	void SynthVoice::getModulatorTelemetry(VoiceTelemetry& telemetry)
+	{
+		telemetry.egValue[0] = (float)ampEG->getModulationOutput()->getModValue(kEGNormalOutput);
+		telemetry.egValue[1] = (float)filterEG->getModulationOutput()->getModValue(kEGNormalOutput);
+		telemetry.egValue[2] = (float)auxEG->getModulationOutput()->getModValue(kEGNormalOutput);
+
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			telemetry.lfoValue[i] = (float)lfo[i]->getModulationOutput()->getModValue(kLFONormalOutput);
+	}
+
+	/**
+	\brief
+	Patch preparation: builds (and resets) the cores that a new patch selects but that
+	have not been instantiated yet, without installing them
+	- called on a background thread; the engine installs the cores on the audio thread
+	at the patch switch, so that update( ) only has to select them
+	- the module parameters and the mod matrix are not touched
+
+	\param patchParameters the voice parameters of the new patch
+	\param cores the list to add the built cores to
+	*/
+	void SynthVoice::prepareModuleCores(SynthVoiceParameters& patchParameters, PreparedCoreList& cores)
+	{
+		auto prepare = [&cores](SynthModule* module, uint32_t index)
+		{
+			PreparedCore prepared;
+			prepared.core = module->buildModuleCore(index);
+			if (!prepared.core)
+				return;
+
+			prepared.module = module;
+			prepared.index = index;
+			cores.push_back(prepared);
+		};
+
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+			prepare(lfo[i].get(), patchParameters.getLFOParameters(i)->moduleIndex);
+
+		prepare(ampEG.get(), patchParameters.ampEGParameters->moduleIndex);
+		prepare(filterEG.get(), patchParameters.filterEGParameters->moduleIndex);
+		prepare(auxEG.get(), patchParameters.auxEGParameters->moduleIndex);
+
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			prepare(filter[i].get(), patchParameters.getFilterParameters(i)->moduleIndex);
+
+#ifndef SYNTHLAB_WS
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			prepare(oscillator[i].get(), patchParameters.getOscParameters(i)->moduleIndex);
+#endif
+		// --- nothing to prepare for the wave sequencing oscillators: WSOscillator builds every
+		//     core of its nested oscillators in its constructor, since the sequence selects them
+	}
+
+	/**
+	\brief
+	Build the render graph used by the patch analyzer
+	- finds the module that owns each bound mod matrix source and destination by
+	  locating its pointer inside the module's modulation arrays
+	- only needs to be done once since module modulation arrays never move; 
+	  loading new cores does not change them
+	- sources or destinations that do not belong to a graph node (e.g. wave sequencer, 
+	  the nested WS oscillators) are marked -1 and treated conservatively
+	*/
+	void SynthVoice::buildRenderGraph()
+	{
+		// --- modulator arrays of each node
+		Modulators* inputs[kNumRenderGraphNodes] = { nullptr };
+		Modulators* outputs[kNumRenderGraphNodes] = { nullptr };
+
+#ifndef SYNTHLAB_WS
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+			inputs[kRGOsc1 + i] = oscillator[i]->getModulationInput().get();
+			outputs[kRGOsc1 + i] = oscillator[i]->getModulationOutput().get();
+		}
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+		{
+			inputs[kRGLFO1 + i] = lfo[i]->getModulationInput().get();
+			outputs[kRGLFO1 + i] = lfo[i]->getModulationOutput().get();
+		}
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+		{
+			inputs[kRGFilter1 + i] = filter[i]->getModulationInput().get();
+			outputs[kRGFilter1 + i] = filter[i]->getModulationOutput().get();
+		}
+		inputs[kRGAmpEG] = ampEG->getModulationInput().get();
+		outputs[kRGAmpEG] = ampEG->getModulationOutput().get();
+		inputs[kRGFilterEG] = filterEG->getModulationInput().get();
+		outputs[kRGFilterEG] = filterEG->getModulationOutput().get();
+		inputs[kRGAuxEG] = auxEG->getModulationInput().get();
+		outputs[kRGAuxEG] = auxEG->getModulationOutput().get();
+		inputs[kRGDCA] = dca->getModulationInput().get();
+		outputs[kRGDCA] = dca->getModulationOutput().get();
+
+		// --- find the node whose modulator array contains the pointer
+		auto findOwner = [](Modulators** mods, double* ptr)
+		{
+			if (!ptr) return -1;
+			for (int32_t n = 0; n < kNumRenderGraphNodes; n++)
+			{
+				if (!mods[n]) continue;
+				double* base = mods[n]->getModArrayPtr(0);
+				if (ptr >= base && ptr < base + MAX_MODULATION_CHANNELS)
+					return n;
+			}
+			return -1;
+		};
+
+		for (uint32_t row = 0; row < kNumberModSources; row++)
+			modSourceOwner[row] = findOwner(outputs, modMatrix->getModSourcePtr(row));
+
+		for (uint32_t col = 0; col < kNumberModDestinations; col++)
+			modDestinationOwner[col] = findOwner(inputs, modMatrix->getModDestinationPtr(col));
+
+		analyzePatch();
+	}
+
+	/**
+	\brief
+	Patch analyzer: computes the set of modules that can affect the voice output
+	- the Amp EG, filters and DCA are always in the audio path
+	- oscillators are live if their output is not fully attenuated; FM operators are always 
+	  live since they modulate each other by algorithm, WS oscillators are not in the graph
+	- a modulator (LFO, filter EG, aux EG) is live if any of its outputs is routed via an
+	  enabled mod matrix channel to a live module; iterates since modulators may modulate 
+	  each other (e.g. LFO1 -> LFO2 fo)
+	- called from update() so it tracks parameter and routing changes
+	*/
+	void SynthVoice::analyzePatch()
+	{
+		for (uint32_t n = 0; n < kNumRenderGraphNodes; n++)
+			moduleLive[n] = false;
+
+		// --- the audio path
+		moduleLive[kRGAmpEG] = true;
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+			moduleLive[kRGFilter1 + i] = true;
+		moduleLive[kRGDCA] = true;
+
+		// --- oscillators
+#if defined SYNTHLAB_DX || defined SYNTHLAB_WS
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			moduleLive[kRGOsc1 + i] = true;
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+			moduleLive[kRGOsc1 + i] = parameters->getOscParameters(i)->outputAmplitude_dB > kMinAbsoluteGain_dB;
+#endif
+
+		// --- modulators: propagate liveness backwards through enabled routings
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (uint32_t row = 0; row < kNumberModSources; row++)
+			{
+				int32_t owner = modSourceOwner[row];
+				if (owner < 0 || moduleLive[owner])
+					continue;
 
+				for (uint32_t col = 0; col < kNumberModDestinations; col++)
+				{
+					if (!modMatrix->getModDestinationPtr(col) ||
+						parameters->modMatrixParameters->modDestinationColumns->at(col).channelEnable[row] == 0)
+						continue;
+
+					// --- unknown destinations are assumed live
+					int32_t destOwner = modDestinationOwner[col];
+					if (destOwner < 0 || moduleLive[destOwner])
+					{
+						moduleLive[owner] = true;
+						changed = true;
+						break;
+					}
+				}
+			}
+		}
 	}
 
 	/**
@@ -455,15 +784,11 @@ namespace SynthLab
 		//parameters->updateCodeKnobs = 0;
 
 		// --- check for new modules here
-		if (parameters->lfo1Parameters->moduleIndex != lfo[0]->getSelectedCoreIndex())
-		{
-			// --- we have a new LFO1
-			loadLFOCore(1, parameters->lfo1Parameters->moduleIndex);
-		}
-		if (parameters->lfo2Parameters->moduleIndex != lfo[1]->getSelectedCoreIndex())
+		for (uint32_t i = 0; i < NUM_LFO; i++)
 		{
-			// --- we have a new LFO2
-			loadLFOCore(2, parameters->lfo2Parameters->moduleIndex);
+			// --- we have a new LFO
+			if (parameters->getLFOParameters(i)->moduleIndex != lfo[i]->getSelectedCoreIndex())
+				loadLFOCore(i + 1, parameters->getLFOParameters(i)->moduleIndex);
 		}
 
 		if (parameters->ampEGParameters->moduleIndex != ampEG->getSelectedCoreIndex())
@@ -482,39 +807,25 @@ namespace SynthLab
 			loadEGCore(3, parameters->auxEGParameters->moduleIndex);
 		}
 
-		if (parameters->filter1Parameters->moduleIndex != filter[0]->getSelectedCoreIndex())
-		{
-			// --- we have a new fFilter 1
-			loadFilterCore(1, parameters->filter1Parameters->moduleIndex);
-		}
-		if (parameters->filter2Parameters->moduleIndex != filter[1]->getSelectedCoreIndex())
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
 		{
-			// --- we have a new filter 2
-			loadFilterCore(2, parameters->filter2Parameters->moduleIndex);
+			// --- we have a new filter
+			if (parameters->getFilterParameters(i)->moduleIndex != filter[i]->getSelectedCoreIndex())
+				loadFilterCore(i + 1, parameters->getFilterParameters(i)->moduleIndex);
 		}
 
 #ifndef SYNTHLAB_WS
-		if (parameters->osc1Parameters->moduleIndex != oscillator[0]->getSelectedCoreIndex())
-		{
-			// --- we have a new OSC1
-			loadOscCore(1, parameters->osc1Parameters->moduleIndex);
-		}
-		if (parameters->osc2Parameters->moduleIndex != oscillator[1]->getSelectedCoreIndex())
-		{
-			// --- we have a new OSC2
-			loadOscCore(2, parameters->osc2Parameters->moduleIndex);
-		}
-		if (parameters->osc3Parameters->moduleIndex != oscillator[2]->getSelectedCoreIndex())
-		{
-			// --- we have a new OSC3
-			loadOscCore(3, parameters->osc3Parameters->moduleIndex);
-		}
-		if (parameters->osc4Parameters->moduleIndex != oscillator[3]->getSelectedCoreIndex())
+		for (uint32_t i = 0; i < NUM_OSC; i++)
 		{
-			// --- we have a new OSC4
-			loadOscCore(4, parameters->osc4Parameters->moduleIndex);
+			// --- we have a new oscillator
+			if (parameters->getOscParameters(i)->moduleIndex != oscillator[i]->getSelectedCoreIndex())
+				loadOscCore(i + 1, parameters->getOscParameters(i)->moduleIndex);
 		}
 #endif
+
+		// --- parameters or routing may have changed
+		analyzePatch();
+
 		return true;
 	}
 
@@ -529,17 +840,20 @@ namespace SynthLab
 	*/
 	void SynthVoice::accumulateToMixBuffer(std::shared_ptr<AudioBuffer> oscBuffers, uint32_t samplesInBlock, double scaling)
 	{
+		// --- nothing to add
+		if (oscBuffers->allOutputsSilent())
+			return;
+
+		mixBuffers->setOutputSilenceFlags(0);
 		float* leftOutBuffer = mixBuffers->getOutputBuffer(LEFT_CHANNEL);
 		float* rightOutBuffer = mixBuffers->getOutputBuffer(RIGHT_CHANNEL);
 		float* leftOscBuffer = oscBuffers->getOutputBuffer(LEFT_CHANNEL);
 		float* rightOscBuffer = oscBuffers->getOutputBuffer(RIGHT_CHANNEL);
 
-		for (uint32_t i = 0; i < samplesInBlock; i++)
-		{
-			// --- stereo
-			leftOutBuffer[i] += leftOscBuffer[i] * scaling;
-			rightOutBuffer[i] += rightOscBuffer[i] * scaling;
-		}
+		// --- stereo
+		const SynthKernelTable& kernels = getSynthKernels();
+		kernels.mixAccumulate(leftOutBuffer, leftOscBuffer, samplesInBlock, (float)scaling);
+		kernels.mixAccumulate(rightOutBuffer, rightOscBuffer, samplesInBlock, (float)scaling);
 	}
 
 	/**
@@ -553,17 +867,16 @@ namespace SynthLab
 	*/
 	void SynthVoice::writeToMixBuffer(std::shared_ptr<AudioBuffer> oscBuffers, uint32_t samplesInBlock, double scaling)
 	{
+		mixBuffers->setOutputSilenceFlags(oscBuffers->getOutputSilenceFlags());
 		float* leftOutBuffer = mixBuffers->getOutputBuffer(LEFT_CHANNEL);
 		float* rightOutBuffer = mixBuffers->getOutputBuffer(RIGHT_CHANNEL);
 		float* leftOscBuffer = oscBuffers->getOutputBuffer(LEFT_CHANNEL);
 		float* rightOscBuffer = oscBuffers->getOutputBuffer(RIGHT_CHANNEL);
 
-		for (uint32_t i = 0; i < samplesInBlock; i++)
-		{
-			// --- stereo
-			leftOutBuffer[i] = leftOscBuffer[i] * scaling;
-			rightOutBuffer[i] = rightOscBuffer[i] * scaling;
-		}
+		// --- stereo
+		const SynthKernelTable& kernels = getSynthKernels();
+		kernels.mixWrite(leftOutBuffer, leftOscBuffer, samplesInBlock, (float)scaling);
+		kernels.mixWrite(rightOutBuffer, rightOscBuffer, samplesInBlock, (float)scaling);
 	}
 
 	/**
@@ -585,26 +898,169 @@ namespace SynthLab
 	{
 		uint32_t samplesToProcess = synthProcessInfo.getSamplesInBlock();
 
-		// --- clear for accumulation
-		mixBuffers->flushBuffers();
+		// --- everything up to the DCA
+		renderModules(samplesToProcess);
+
+		// --- update and render
+		dca->render(samplesToProcess);
+
+		// --- to mains
+		copyOutputToOutput(dca->getAudioBuffers(), synthProcessInfo, STEREO_TO_STEREO, samplesToProcess);
+
+		// --- check for note off condition
+		checkNoteOffCondition();
+
+		return true;
+	}
+
+	/**
+	\brief
+	Render a block of audio data for an active note event, accumulating the DCA output
+	directly into the owner's mix buffers
+	- identical to render() except there is no per-voice output staging; the DCA
+	  reads its input and adds into the destination with the voice scaling folded into its gain
+	- this saves a full block stereo write + read per voice
+	- a silent voice (see AudioBuffer silence flags) skips the accumulation
+
+	\param synthProcessInfo the engine's output buffers (accumulated into, not overwritten)
+	\param sampleOffset location in the output buffers of the top of this block
+	\param samplesToProcess number of samples to render, must be <= blockSize
+	\param scaling voice mix scalar, applied inside the DCA
+	*/
+	bool SynthVoice::renderAccumulate(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess, double scaling)
+	{
+		// --- everything up to the DCA
+		renderModules(samplesToProcess);
+
+		// --- the DCA
+		return renderDCAAccumulate(synthProcessInfo, sampleOffset, samplesToProcess, scaling);
+	}
+
+	/**
+	\brief
+	The last part of renderAccumulate( ): render the DCA into the owner's mix buffers and check for
+	the end of the note
+	- for module-major rendering, after every stage of renderModules( ) has run (see renderStage( ))
+
+	\param synthProcessInfo the engine's output buffers (accumulated into, not overwritten)
+	\param sampleOffset location in the output buffers of the top of this block
+	\param samplesToProcess number of samples to render, must be <= blockSize
+	\param scaling voice mix scalar, applied inside the DCA
+	*/
+	bool SynthVoice::renderDCAAccumulate(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess, double scaling)
+	{
+		// --- silent voices add nothing; otherwise the mains are no longer silent
+		if (!dca->getAudioBuffers()->allInputsSilent())
+			synthProcessInfo.setOutputSilenceFlags(0);
+
+		// --- update, render and accumulate to mains
+		dca->renderAccumulate(synthProcessInfo.getOutputBuffer(LEFT_CHANNEL) + sampleOffset,
+							  synthProcessInfo.getOutputBuffer(RIGHT_CHANNEL) + sampleOffset,
+							  samplesToProcess, scaling);
+
+		// --- check for note off condition
+		checkNoteOffCondition();
+
+		return true;
+	}
+
+	/**
+	\brief
+	Render the modulators, oscillators and filters and deliver the result to the DCA input
+	- the DCA itself is rendered by the caller
+
+	\param samplesToProcess number of samples to render
+	*/
+	void SynthVoice::renderModules(uint32_t samplesToProcess)
+	{
+		for (uint32_t stage = 0; stage < enumToInt(voiceRenderStage::kNumStages); stage++)
+			renderStage(static_cast<voiceRenderStage>(stage), samplesToProcess);
+	}
 
-		// --- render modulators first
+	/**
+	\brief
+	Render one stage of renderModules( )
+	- running the stages in voiceRenderStage order is the same as renderModules( ); the engine's
+	module-major mode runs each stage across all active voices before the next one, so one
+	module type's code and tables stay hot in the caches while it is run for every voice
+	- the stages of one voice only share that voice's modules and buffers, so interleaving
+	them with other voices does not change the output
+
+	\param stage the stage to render
+	\param samplesToProcess number of samples to render
+	*/
+	void SynthVoice::renderStage(voiceRenderStage stage, uint32_t samplesToProcess)
+	{
+		switch (stage)
+		{
+		case voiceRenderStage::kLFOs:
+			renderLFOStage(samplesToProcess);
+			break;
+		case voiceRenderStage::kEGs:
+			renderEGStage(samplesToProcess);
+			break;
+		case voiceRenderStage::kModMatrix:
+			// --- run modulation matrix; this does all block modultion routing 
+			//     sources -> destinations
+			modMatrix->runModMatrix();
+			break;
+		case voiceRenderStage::kOscillators:
+			renderOscillatorStage(samplesToProcess);
+			break;
+		case voiceRenderStage::kFilters:
+			renderFilterStage(samplesToProcess);
+			break;
+		default:
+			break;
+		}
+	}
+
+	/**
+	\brief
+	Render stage: the LFOs; dead modules (see analyzePatch()) are skipped
+
+	\param samplesToProcess number of samples to render
+	*/
+	void SynthVoice::renderLFOStage(uint32_t samplesToProcess)
+	{
 		for (uint32_t i = 0; i<NUM_LFO; i++)
-			lfo[i]->render(samplesToProcess);
+		{
+			if (isModuleLive(kRGLFO1 + i))
+				lfo[i]->render(samplesToProcess);
+		}
+	}
 
-		// --- EGs
+	/**
+	\brief
+	Render stage: the EGs (and the wave sequencer, which is also a modulator)
+
+	\param samplesToProcess number of samples to render
+	*/
+	void SynthVoice::renderEGStage(uint32_t samplesToProcess)
+	{
 		ampEG->render(samplesToProcess);
-		filterEG->render(samplesToProcess);
-		auxEG->render(samplesToProcess);
+		if (isModuleLive(kRGFilterEG))
+			filterEG->render(samplesToProcess);
+		if (isModuleLive(kRGAuxEG))
+			auxEG->render(samplesToProcess);
 
 #ifdef SYNTHLAB_WS
 		// --- sequencer generates modulation values
 		waveSequencer->render(samplesToProcess);
 #endif
+	}
 
-		// --- run modulation matrix; this does all block modultion routing 
-		//     sources -> destinations
-		modMatrix->runModMatrix();
+	/**
+	\brief
+	Render stage: the oscillators, mixed into the mix buffers
+
+	\param samplesToProcess number of samples to render
+	*/
+	void SynthVoice::renderOscillatorStage(uint32_t samplesToProcess)
+	{
+		// --- clear for accumulation
+		mixBuffers->flushBuffers();
+		mixBuffers->setOutputSilenceFlags(ALL_CHANNELS_SILENT);
 
 #ifdef SYNTHLAB_WS
 		// --- render the 4 oscillatorsin one object
@@ -786,20 +1242,33 @@ namespace SynthLab
 			accumulateToMixBuffer(oscillator[0]->getAudioBuffers(), samplesToProcess, 0.25);
 		}
 #else // all others
-		// --- render the 4 oscillators
+		// --- render the NUM_OSC oscillators
 		for (uint32_t i = 0; i < NUM_OSC; i++)
 		{
+			// --- silent oscillators contribute nothing
+			if (!isModuleLive(kRGOsc1 + i))
+				continue;
+
 			oscillator[i]->render(samplesToProcess);
-			accumulateToMixBuffer(oscillator[i]->getAudioBuffers(), samplesToProcess, 0.25);
+			accumulateToMixBuffer(oscillator[i]->getAudioBuffers(), samplesToProcess, 1.0 / NUM_OSC);
 		}
 
 		// --- you may comment this out if needed
 		//     many cobbled wavetables have small DC offsets that add up over time
 		removeMixBufferDC(samplesToProcess);
 #endif
+	}
 
-		// --- setup filtering
-		if (parameters->filterModeIndex == enumToInt(FilterMode::kSeries))
+	/**
+	\brief
+	Render stage: the filters, from the mix buffers to the DCA input
+
+	\param samplesToProcess number of samples to render
+	*/
+	void SynthVoice::renderFilterStage(uint32_t samplesToProcess)
+	{
+		// --- setup filtering; with a single filter both modes are the same
+		if (NUM_FILTER == 1 || parameters->filterModeIndex == enumToInt(FilterMode::kSeries))
 		{
 			// --- to Filter1
 			copyBufferToInput(mixBuffers, filter[0]->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
@@ -807,45 +1276,47 @@ namespace SynthLab
 			// --- update and render
 			filter[0]->render(samplesToProcess);
 
-			// --- to Filter2
-			copyOutputToInput(filter[0]->getAudioBuffers(), filter[1]->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
+			// --- to Filter2, ...
+			for (uint32_t i = 1; i < NUM_FILTER; i++)
+			{
+				copyOutputToInput(filter[i - 1]->getAudioBuffers(), filter[i]->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
 
-			// --- update and render
-			filter[1]->render(samplesToProcess);
+				// --- update and render
+				filter[i]->render(samplesToProcess);
+			}
 
 			// --- to DCA
-			copyOutputToInput(filter[1]->getAudioBuffers(), dca->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
+			copyOutputToInput(filter[NUM_FILTER - 1]->getAudioBuffers(), dca->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
 		}
 		else
 		{
-			// --- to Filter1
-			copyBufferToInput(mixBuffers, filter[0]->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
-
-			// --- to Filter2
-			copyBufferToInput(mixBuffers, filter[1]->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
+			// --- to Filter1, Filter2, ...
+			for (uint32_t i = 0; i < NUM_FILTER; i++)
+				copyBufferToInput(mixBuffers, filter[i]->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
 
 			// --- clear mix buffers so we can mix the filter outputs into it
 			mixBuffers->flushBuffers();
+			mixBuffers->setOutputSilenceFlags(ALL_CHANNELS_SILENT);
 
 			// --- update and render
-			filter[0]->render(samplesToProcess);
-			accumulateToMixBuffer(filter[0]->getAudioBuffers(), samplesToProcess, 0.5);
-
-			// --- update and render
-			filter[1]->render(samplesToProcess);
-			accumulateToMixBuffer(filter[1]->getAudioBuffers(), samplesToProcess, 0.5);
+			for (uint32_t i = 0; i < NUM_FILTER; i++)
+			{
+				filter[i]->render(samplesToProcess);
+				accumulateToMixBuffer(filter[i]->getAudioBuffers(), samplesToProcess, 1.0 / NUM_FILTER);
+			}
 
 			// --- to DCA
 			copyBufferToInput(mixBuffers, dca->getAudioBuffers(), STEREO_TO_STEREO, samplesToProcess);
 		}
+	}
 
-		// --- update and render
-		dca->render(samplesToProcess);
-
-		// --- to mains
-		copyOutputToOutput(dca->getAudioBuffers(), synthProcessInfo, STEREO_TO_STEREO, samplesToProcess);
-
-		// --- check for note off condition
+	/**
+	\brief
+	Check the status of the Amp EG object at the end of a render cycle
+	- if the note has expired, either start the pending stolen note or deactivate the voice
+	*/
+	void SynthVoice::checkNoteOffCondition()
+	{
 		if (voiceIsActive)
 		{
 			if (ampEG->getState() == enumToInt(EGState::kOff))
@@ -873,7 +1344,6 @@ namespace SynthLab
 					voiceIsActive = false;
 			}
 		}
-		return true;
 	}
 
 	/**
@@ -881,6 +1351,8 @@ namespace SynthLab
 	Note-on handler for voice
 	- For oscillators: start glide modulators then call note-on handlers
 	- For all others: call note-on handlers
+	- the modules pass the note to their selected core only; the other cores get it if
+	they are selected during the note (see SynthModule::doSelectedCoreNoteOn( ))
 	- set and save voice state information
 
 	\param event MIDI note event
@@ -888,8 +1360,8 @@ namespace SynthLab
 	*/
 	bool SynthVoice::doNoteOn(midiEvent& event)
 	{
-		// --- calculate MIDI -> pitch value
-		double midiPitch = midiNoteNumberToOscFrequency(event.midiData1);
+		// --- MIDI -> pitch value, precomputed per note
+		double midiPitch = lookupTables->getNotePitch(event.midiData1);
 		int32_t lastMIDINote = currentMIDINote;
 		currentMIDINote = (int32_t)event.midiData1;
 
@@ -949,7 +1421,7 @@ namespace SynthLab
 	bool SynthVoice::doNoteOff(midiEvent& event)
 	{
 		// --- lookup MIDI -> pitch value
-		double midiPitch = midiNoteNumberToOscFrequency(event.midiData1);
+		double midiPitch = lookupTables->getNotePitch(event.midiData1);
 
 		MIDINoteEvent noteEvent(midiPitch, event.midiData1, event.midiData2);
 
@@ -1139,106 +1611,76 @@ namespace SynthLab
 	std::vector<std::string> SynthVoice::getModuleStrings(uint32_t mask, bool modKnobs)
 	{
 		std::vector<std::string> strings;
-		if (modKnobs)
-		{
-			if (mask == LFO1_MOD_KNOBS)
-				lfo[0]->getModKnobStrings(strings);
-			else if (mask == LFO2_MOD_KNOBS)
-				lfo[1]->getModKnobStrings(strings);
-
-			else if (mask == EG1_MOD_KNOBS)
-				ampEG->getModKnobStrings(strings);
-			else if (mask == EG2_MOD_KNOBS)
-				filterEG->getModKnobStrings(strings);
-			else if (mask == EG3_MOD_KNOBS)
-				auxEG->getModKnobStrings(strings);
-
-			else if (mask == FILTER1_MOD_KNOBS)
-				filter[0]->getModKnobStrings(strings);
-			else if (mask == FILTER2_MOD_KNOBS)
-				filter[1]->getModKnobStrings(strings);
 #ifdef SYNTHLAB_WS
-			else if (mask == OSC1_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getModKnobStrings(strings);
-			else if (mask == OSC2_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(1)->getModKnobStrings(strings);
-			else if (mask == OSC3_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(2)->getModKnobStrings(strings);
-			else if (mask == OSC4_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(3)->getModKnobStrings(strings);
-#else		
-			// --- subcomponents
-			else if (mask == OSC1_MOD_KNOBS)
-				oscillator[0]->getModKnobStrings(strings);
-			else if (mask == OSC2_MOD_KNOBS)
-				oscillator[1]->getModKnobStrings(strings);
-			else if (mask == OSC3_MOD_KNOBS)
-				oscillator[2]->getModKnobStrings(strings);
-			else if (mask == OSC4_MOD_KNOBS)
-				oscillator[3]->getModKnobStrings(strings);
-#endif
+		// --- the WS oscillators are not voice modules; their masks return mod knob strings
+		for (uint32_t i = 0; i < NUM_OSCILLATORS; i++)
+		{
+			if (mask == (OSC1_MOD_KNOBS << i))
+			{
+				wsOscillator[MAIN_OSC]->getWTOscillator(i)->getModKnobStrings(strings);
+				return strings;
+			}
 		}
-		else
+		for (uint32_t i = 0; i < MAX_SEQ_STEPS && !modKnobs; i++)
 		{
-			if (mask == LFO1_WAVEFORMS)
-				lfo[0]->getModuleStrings(strings);
-			else if (mask == LFO2_WAVEFORMS)
-				lfo[1]->getModuleStrings(strings);
-
-			else if (mask == EG1_CONTOUR)
-				ampEG->getModuleStrings(strings);
-			else if (mask == EG2_CONTOUR)
-				filterEG->getModuleStrings(strings);
-			else if (mask == EG3_CONTOUR)
-				auxEG->getModuleStrings(strings);
-
-			else if (mask == FILTER1_TYPES)
-				filter[0]->getModuleStrings(strings);
-			else if (mask == FILTER2_TYPES)
-				filter[1]->getModuleStrings(strings);
-
-#ifdef SYNTHLAB_WS
-			else if (mask == OSC1_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getModKnobStrings(strings);
-			else if (mask == OSC2_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(1)->getModKnobStrings(strings);
-			else if (mask == OSC3_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(2)->getModKnobStrings(strings);
-			else if (mask == OSC4_MOD_KNOBS)
-				wsOscillator[MAIN_OSC]->getWTOscillator(3)->getModKnobStrings(strings);
-
-			else if (mask == WAVE_SEQ_WAVES_1)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_2)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_3)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_4)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_5)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_6)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_7)
-				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-			else if (mask == WAVE_SEQ_WAVES_8)
+			if (mask == (WAVE_SEQ_WAVES_1 << i))
+			{
 				wsOscillator[MAIN_OSC]->getWTOscillator(0)->getAllModuleStrings(strings, empty_string); // gets all currrent core strings //
-
-#else		
-			else if (mask == OSC1_WAVEFORMS)
-				oscillator[0]->getModuleStrings(strings);
-			else if (mask == OSC2_WAVEFORMS)
-				oscillator[1]->getModuleStrings(strings);
-			else if (mask == OSC3_WAVEFORMS)
-				oscillator[2]->getModuleStrings(strings);
-			else if (mask == OSC4_WAVEFORMS)
-				oscillator[3]->getModuleStrings(strings);
+				return strings;
+			}
+		}
 #endif
+		SynthModule* module = getModuleForMask(mask);
+		if (module)
+		{
+			if (modKnobs)
+				module->getModKnobStrings(strings);
+			else
+				module->getModuleStrings(strings);
 		}
 
 		return strings;
 	}
 
+	/**
+	\brief
+	Find the module for a GUI update code
+	- the mod knob codes (LFO1_MOD_KNOBS, ...) use the same bits as the string list codes 
+	(LFO1_WAVEFORMS, ...) so either may be used
+	- the codes for each module type are consecutive bits
+
+	\param mask the update code of one module
+	\return the module or nullptr if there is no such module in this SynthEngineConfig
+	*/
+	SynthModule* SynthVoice::getModuleForMask(uint32_t mask)
+	{
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+		{
+			if (mask == (LFO1_WAVEFORMS << i))
+				return lfo[i].get();
+		}
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+		{
+			if (mask == (FILTER1_TYPES << i))
+				return filter[i].get();
+		}
+#ifndef SYNTHLAB_WS
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+			if (mask == (OSC1_WAVEFORMS << i))
+				return oscillator[i].get();
+		}
+#endif
+		if (mask == EG1_CONTOUR)
+			return ampEG.get();
+		if (mask == EG2_CONTOUR)
+			return filterEG.get();
+		if (mask == EG3_CONTOUR)
+			return auxEG.get();
+
+		return nullptr;
+	}
+
 
 	/**
 	\brief
@@ -1252,7 +1694,11 @@ namespace SynthLab
 		uint32_t lfo_L = NUM_LFO;
 		uint32_t eg_L = NUM_EG;
 		uint32_t filter_L = NUM_FILTER;
+#ifdef SYNTHLAB_WS
 		uint32_t osc_L = NUM_OSCILLATORS;
+#else
+		uint32_t osc_L = NUM_OSC;
+#endif
 		uint32_t wsosc_L = 2;
 
 		uint32_t lfo_C = 0;
@@ -1383,37 +1829,30 @@ namespace SynthLab
 	Function to load a new LFO Core
 	- optional, only for systems that allow dynamic GUIs
 
-	\param lfoIndex index of LFO (0 or 1 as there are 2 LFOs)
+	\param lfoIndex index of LFO (1 to NUM_LFO)
 	\param index Core index parameter (0, 1, 2 or 3 as there are 4 cores)
+	\return false if the core is not built yet; it is selected once it is, see SynthEngine::prepareModuleCores( )
 	*/
-	void SynthVoice::loadLFOCore(uint32_t lfoIndex, uint32_t index)
+	bool SynthVoice::loadLFOCore(uint32_t lfoIndex, uint32_t index)
 	{
-		if (lfoIndex == 1)
-		{
-			lfo[0]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= LFO1_WAVEFORMS;
-			parameters->updateCodeKnobs |= LFO1_MOD_KNOBS;
+		if (lfoIndex == 0 || lfoIndex > NUM_LFO)
+			return false;
 
-			// --- THIS IS NOT NEEDED - remove; the modulation input and output array pointers
-			//     DO NOT CHANGE when a new core is loaded.
-			modMatrix->clearModSource(kSourceLFO1_Norm);
-			modMatrix->addModSource(kSourceLFO1_Norm, lfo[0]->getModulationOutput()->getModArrayPtr(kLFONormalOutput));
+		uint32_t i = lfoIndex - 1;
+		if (!lfo[i]->selectModuleCore(index))
+			return false;
 
-			modMatrix->clearModDestination(kDestLFO1_fo);
-			modMatrix->addModDestination(kDestLFO1_fo, lfo[0]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		}
-		else if (lfoIndex == 2)
-		{
-			lfo[1]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= LFO2_WAVEFORMS;
-			parameters->updateCodeKnobs |= LFO2_MOD_KNOBS;
+		parameters->updateCodeDroplists |= LFO1_WAVEFORMS << i;
+		parameters->updateCodeKnobs |= LFO1_MOD_KNOBS << i;
 
-			modMatrix->clearModSource(kSourceLFO2_Norm);
-			modMatrix->addModSource(kSourceLFO2_Norm, lfo[1]->getModulationOutput()->getModArrayPtr(kLFONormalOutput));
+		// --- THIS IS NOT NEEDED - remove; the modulation input and output array pointers
+		//     DO NOT CHANGE when a new core is loaded.
+		modMatrix->clearModSource(lfoNormalSource[i]);
+		modMatrix->addModSource(lfoNormalSource[i], lfo[i]->getModulationOutput()->getModArrayPtr(kLFONormalOutput));
 
-			modMatrix->clearModDestination(kDestLFO2_fo);
-			modMatrix->addModDestination(kDestLFO2_fo, lfo[1]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		}
+		modMatrix->clearModDestination(kDestLFO1_fo + i);
+		modMatrix->addModDestination(kDestLFO1_fo + i, lfo[i]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		return true;
 	}
 
 	/**
@@ -1421,37 +1860,32 @@ namespace SynthLab
 	Function to load a new filter Core
 	- optional, only for systems that allow dynamic GUIs
 
-	\param filterIndex index of filter (0 or 1 as there are 2 filters)
+	\param filterIndex index of filter (1 to NUM_FILTER)
 	\param index Core index parameter (0, 1, 2 or 3 as there are 4 cores)
+	\return false if the core is not built yet; it is selected once it is, see SynthEngine::prepareModuleCores( )
 	*/
-	void SynthVoice::loadFilterCore(uint32_t filterIndex, uint32_t index)
+	bool SynthVoice::loadFilterCore(uint32_t filterIndex, uint32_t index)
 	{
-		if (filterIndex == 1)
-		{
-			filter[0]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= FILTER1_TYPES;
-			parameters->updateCodeKnobs |= FILTER1_MOD_KNOBS;
+		if (filterIndex == 0 || filterIndex > NUM_FILTER)
+			return false;
 
-			parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceFilterEG_Norm, kDestFilter1_fc_EG);
+		uint32_t i = filterIndex - 1;
+		if (!filter[i]->selectModuleCore(index))
+			return false;
 
-			modMatrix->clearModDestination(kDestFilter1_fc_EG);
-			modMatrix->clearModDestination(kDestFilter1_fc_Bipolar);
+		parameters->updateCodeDroplists |= FILTER1_TYPES << i;
+		parameters->updateCodeKnobs |= FILTER1_MOD_KNOBS << i;
 
-			modMatrix->addModDestination(kDestFilter1_fc_EG, filter[0]->getModulationInput()->getModArrayPtr(kEGMod));
-			modMatrix->addModDestination(kDestFilter1_fc_Bipolar, filter[0]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		}
-		else if (filterIndex == 2)
-		{
-			filter[1]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= FILTER2_TYPES;
-			parameters->updateCodeKnobs |= FILTER2_MOD_KNOBS;
+		// --- filter EG is hardwired to filter 1
+		if (i == 0)
+			parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceFilterEG_Norm, kDestFilter1_fc_EG);
 
-			modMatrix->clearModDestination(kDestFilter2_fc_EG);
-			modMatrix->clearModDestination(kDestFilter2_fc_Bipolar);
+		modMatrix->clearModDestination(kDestFilter1_fc_EG + i);
+		modMatrix->clearModDestination(kDestFilter1_fc_Bipolar + i);
 
-			modMatrix->addModDestination(kDestFilter2_fc_EG, filter[1]->getModulationInput()->getModArrayPtr(kEGMod));
-			modMatrix->addModDestination(kDestFilter2_fc_Bipolar, filter[1]->getModulationInput()->getModArrayPtr(kBipolarMod));
-		}
+		modMatrix->addModDestination(kDestFilter1_fc_EG + i, filter[i]->getModulationInput()->getModArrayPtr(kEGMod));
+		modMatrix->addModDestination(kDestFilter1_fc_Bipolar + i, filter[i]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		return true;
 	}
 
 	/**
@@ -1459,10 +1893,11 @@ namespace SynthLab
 	Function to load a new oscillator Core
 	- optional, only for systems that allow dynamic GUIs
 
-	\param oscIndex index of oscillator (0, 1, 2 or 3 as there are 4 oscillators)
+	\param oscIndex index of oscillator (1 to NUM_OSC)
 	\param index Core index parameter (0, 1, 2 or 3 as there are 4 cores)
+	\return false if the core is not built yet; it is selected once it is, see SynthEngine::prepareModuleCores( )
 	*/
-	void SynthVoice::loadOscCore(uint32_t oscIndex, uint32_t index)
+	bool SynthVoice::loadOscCore(uint32_t oscIndex, uint32_t index)
 	{
 #ifdef SYNTHLAB_WS
 		if (oscIndex == 1)
@@ -1472,76 +1907,27 @@ namespace SynthLab
 			parameters->updateCodeKnobs |= OSC1_MOD_KNOBS;
 		}
 #else
-		if (oscIndex == 1)
-		{
-			oscillator[0]->selectModuleCore(index);
+		if (oscIndex == 0 || oscIndex > NUM_OSC)
+			return false;
 
-			// --- OPTIONAL: Used for dynamic menus in SynthLab-DM
-			parameters->updateCodeDroplists |= OSC1_WAVEFORMS;
-			parameters->updateCodeKnobs |= OSC1_MOD_KNOBS;
+		uint32_t i = oscIndex - 1;
+		if (!oscillator[i]->selectModuleCore(index))
+			return false;
 
-			// --- reset mod matrix pointers to new core modulation arrays
-			modMatrix->clearModDestination(kDestOsc1_fo);
-			modMatrix->clearModDestination(kDestOsc1_Mod);
-			modMatrix->clearModDestination(kDestOsc1_Morph);
-			modMatrix->clearModDestination(kDestOsc2_Shape);
+		// --- OPTIONAL: Used for dynamic menus in SynthLab-DM
+		parameters->updateCodeDroplists |= OSC1_WAVEFORMS << i;
+		parameters->updateCodeKnobs |= OSC1_MOD_KNOBS << i;
 
-			modMatrix->addModDestination(kDestOsc1_fo, oscillator[0]->getModulationInput()->getModArrayPtr(kBipolarMod));
-			modMatrix->addModDestination(kDestOsc1_Mod, oscillator[0]->getModulationInput()->getModArrayPtr(kUniqueMod));
-			modMatrix->addModDestination(kDestOsc1_Morph, oscillator[0]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-			modMatrix->addModDestination(kDestOsc1_Shape, oscillator[0]->getModulationInput()->getModArrayPtr(kShapeMod));
-		}
-		else if (oscIndex == 2)
-		{
-			oscillator[1]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= OSC2_WAVEFORMS;
-			parameters->updateCodeKnobs |= OSC2_MOD_KNOBS;
-
-			// --- reset mod matrix pointers to new core modulation arrays
-			modMatrix->clearModDestination(kDestOsc2_fo);
-			modMatrix->clearModDestination(kDestOsc2_Mod);
-			modMatrix->clearModDestination(kDestOsc2_Morph);
-			modMatrix->clearModDestination(kDestOsc2_Shape);
-
-			modMatrix->addModDestination(kDestOsc2_fo, oscillator[1]->getModulationInput()->getModArrayPtr(kBipolarMod));
-			modMatrix->addModDestination(kDestOsc2_Mod, oscillator[1]->getModulationInput()->getModArrayPtr(kUniqueMod));
-			modMatrix->addModDestination(kDestOsc2_Morph, oscillator[1]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-			modMatrix->addModDestination(kDestOsc2_Shape, oscillator[1]->getModulationInput()->getModArrayPtr(kShapeMod));
-		}
-		if (oscIndex == 3)
-		{
-			oscillator[2]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= OSC3_WAVEFORMS;
-			parameters->updateCodeKnobs |= OSC3_MOD_KNOBS;
-
-			// --- reset mod matrix pointers to new core modulation arrays
-			modMatrix->clearModDestination(kDestOsc3_fo);
-			modMatrix->clearModDestination(kDestOsc3_Mod);
-			modMatrix->clearModDestination(kDestOsc3_Shape);
-			modMatrix->clearModDestination(kDestOsc3_Morph);
-
-			modMatrix->addModDestination(kDestOsc3_fo, oscillator[2]->getModulationInput()->getModArrayPtr(kBipolarMod));
-			modMatrix->addModDestination(kDestOsc3_Mod, oscillator[2]->getModulationInput()->getModArrayPtr(kUniqueMod));
-			modMatrix->addModDestination(kDestOsc3_Shape, oscillator[2]->getModulationInput()->getModArrayPtr(kShapeMod));
-			modMatrix->addModDestination(kDestOsc3_Morph, oscillator[2]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-		}
-		if (oscIndex == 4)
-		{
-			oscillator[3]->selectModuleCore(index);
-			parameters->updateCodeDroplists |= OSC4_WAVEFORMS;
-			parameters->updateCodeKnobs |= OSC4_MOD_KNOBS;
-
-			// --- reset mod matrix pointers to new core modulation arrays
-			modMatrix->clearModDestination(kDestOsc4_fo);
-			modMatrix->clearModDestination(kDestOsc4_Mod);
-			modMatrix->clearModDestination(kDestOsc4_Shape);
-			modMatrix->clearModDestination(kDestOsc4_Morph);
+		// --- reset mod matrix pointers to new core modulation arrays
+		modMatrix->clearModDestination(kDestOsc1_fo + i);
+		modMatrix->clearModDestination(kDestOsc1_Mod + i);
+		modMatrix->clearModDestination(kDestOsc1_Morph + i);
+		modMatrix->clearModDestination(kDestOsc1_Shape + i);
 
-			modMatrix->addModDestination(kDestOsc4_fo, oscillator[3]->getModulationInput()->getModArrayPtr(kBipolarMod));
-			modMatrix->addModDestination(kDestOsc4_Mod, oscillator[3]->getModulationInput()->getModArrayPtr(kUniqueMod));
-			modMatrix->addModDestination(kDestOsc4_Shape, oscillator[3]->getModulationInput()->getModArrayPtr(kShapeMod));
-			modMatrix->addModDestination(kDestOsc4_Morph, oscillator[3]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
-		}
+		modMatrix->addModDestination(kDestOsc1_fo + i, oscillator[i]->getModulationInput()->getModArrayPtr(kBipolarMod));
+		modMatrix->addModDestination(kDestOsc1_Mod + i, oscillator[i]->getModulationInput()->getModArrayPtr(kUniqueMod));
+		modMatrix->addModDestination(kDestOsc1_Morph + i, oscillator[i]->getModulationInput()->getModArrayPtr(kWaveMorphMod));
+		modMatrix->addModDestination(kDestOsc1_Shape + i, oscillator[i]->getModulationInput()->getModArrayPtr(kShapeMod));
 
 		// --- morph routing
 		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc1_Morph);
@@ -1549,6 +1935,7 @@ namespace SynthLab
 		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc3_Morph);
 		parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc4_Morph);
 #endif
+		return true;
 	}
 
 	/**
@@ -1558,12 +1945,15 @@ namespace SynthLab
 
 	\param egIndex index of EG (0 or 1 as there are 2 EGs)
 	\param index Core index parameter (0, 1, 2 or 3 as there are 4 cores)
+	\return false if the core is not built yet; it is selected once it is, see SynthEngine::prepareModuleCores( )
 	*/
-	void SynthVoice::loadEGCore(uint32_t egIndex, uint32_t index)
+	bool SynthVoice::loadEGCore(uint32_t egIndex, uint32_t index)
 	{
 		if (egIndex == 1)
 		{
-			ampEG->selectModuleCore(index);
+			if (!ampEG->selectModuleCore(index))
+				return false;
+
 			parameters->updateCodeDroplists |= EG1_CONTOUR;
 			parameters->updateCodeKnobs |= EG1_MOD_KNOBS;
 
@@ -1577,7 +1967,9 @@ namespace SynthLab
 		}
 		else if (egIndex == 2)
 		{
-			filterEG->selectModuleCore(index);
+			if (!filterEG->selectModuleCore(index))
+				return false;
+
 			parameters->updateCodeDroplists |= EG2_CONTOUR;
 			parameters->updateCodeKnobs |= EG2_MOD_KNOBS;
 
@@ -1590,7 +1982,9 @@ namespace SynthLab
 		}
 		else if (egIndex == 3)
 		{
-			auxEG->selectModuleCore(index);
+			if (!auxEG->selectModuleCore(index))
+				return false;
+
 			parameters->updateCodeDroplists |= EG3_CONTOUR;
 			parameters->updateCodeKnobs |= EG3_MOD_KNOBS;
 
@@ -1611,5 +2005,9 @@ namespace SynthLab
 			parameters->modMatrixParameters->setMM_HardwiredRouting(kSourceAuxEG_Norm, kDestOsc8_Morph);
 #endif
 		}
+		else
+			return false;
+
+		return true;
 	}
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "../../source/lfo.h"
 #include "../../source/envelopegenerator.h"
 #include "../../source/synthfilter.h"
+#include "../../source/basiclookuptables.h"
+#include "../../source/synthtelemetry.h"
 
 //#define SYNTHLAB_WT 1
 //#define SYNTHLAB_VA 1
@@ -72,8 +74,9 @@ namespace SynthLab
 	enum class filterCoreType { virtualAnalog, biQuad };
 
 	// --- SETUP DEFAULT CORES HERE ------------------------------------ //
+	//     (tables are sized for the full architecture; a lean SynthEngineConfig uses the first entries)
 	// --- LFOs
-	const lfoCoreType lfoCores[NUM_LFO] =
+	const lfoCoreType lfoCores[MAX_NUM_LFO] =
 	{
 		lfoCoreType::standardLFO,	/* CORE 0 */
 		lfoCoreType::fmLFO			/* CORE 1 */
@@ -85,7 +88,7 @@ namespace SynthLab
 	const egCoreType auxEGCore = egCoreType::dxEG;
 
 	// --- FILTERS
-	const filterCoreType filterCores[NUM_FILTER] =
+	const filterCoreType filterCores[MAX_NUM_FILTER] =
 	{
 		filterCoreType::virtualAnalog,	/* CORE 0 */
 		filterCoreType::biQuad			/* CORE 1 */
@@ -101,7 +104,7 @@ namespace SynthLab
 	enum class wtCoreType { classicWT, morphingWT, soundFXWT, drumWT };
 
 	// --- wavetable cores (SynthLab-WT only)
-	const wtCoreType wtCores[NUM_OSC] =
+	const wtCoreType wtCores[MAX_NUM_OSC] =
 	{
 		wtCoreType::classicWT,	/* CORE 0 */
 		wtCoreType::classicWT,	/* CORE 1 */
@@ -113,7 +116,7 @@ namespace SynthLab
 	enum class pcmCoreType { legacyPCM, mellotronPCM, waveslicePCM };
 
 	// --- wavetable cores (SynthLab-PCM only)
-	const pcmCoreType pcmCores[NUM_OSC] =
+	const pcmCoreType pcmCores[MAX_NUM_OSC] =
 	{
 		pcmCoreType::legacyPCM,		/* CORE 0 */
 		pcmCoreType::legacyPCM,		/* CORE 1 */
@@ -325,11 +328,28 @@ namespace SynthLab
 		// --- Dynamic String suport: you can use these to keep track of the lists and knobs
 		uint32_t updateCodeDroplists = 0;
 		uint32_t updateCodeKnobs = 0;
+
+		// --- 0-based access for loops over NUM_OSC, NUM_LFO and NUM_FILTER
+#ifndef SYNTHLAB_WS
+		decltype(osc1Parameters)& getOscParameters(uint32_t index)
+		{
+			if (index == 1) return osc2Parameters;
+			if (index == 2) return osc3Parameters;
+			if (index == 3) return osc4Parameters;
+			return osc1Parameters;
+		}
+#endif
+		std::shared_ptr<LFOParameters>& getLFOParameters(uint32_t index) { return index == 1 ? lfo2Parameters : lfo1Parameters; }
+		std::shared_ptr<FilterParameters>& getFilterParameters(uint32_t index) { return index == 1 ? filter2Parameters : filter1Parameters; }
 	};
 
 	// --- voice mode: note on or note off states
 	enum class voiceState { kNoteOnState, kNoteOffState };
 
+	// --- the stages of SynthVoice::renderModules( ), in order; for rendering stage by stage
+	//     across the voices (see SynthVoice::renderStage( ))
+	enum class voiceRenderStage { kLFOs, kEGs, kModMatrix, kOscillators, kFilters, kNumStages };
+
 	/**
 	\class SynthVoice
 	\ingroup SynthVoice
@@ -405,7 +425,8 @@ namespace SynthLab
 			std::shared_ptr<SynthVoiceParameters> _parameters,
 			std::shared_ptr<WavetableDatabase> _wavetableDatabase,
 			std::shared_ptr<PCMSampleDatabase> _sampleDatabase,
-			uint32_t _blockSize = 64);
+			uint32_t _blockSize = 64,
+			SynthVoice* prototype = nullptr);
 
 		virtual ~SynthVoice() {} ///< empty destructor
 
@@ -413,6 +434,12 @@ namespace SynthLab
 		virtual bool reset(double _sampleRate);
 		virtual bool update();
 		virtual bool render(SynthProcessInfo& synthProcessInfo);
+		virtual bool renderAccumulate(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess, double scaling);
+
+		/** module-major rendering: the engine runs one stage on every active voice before the next
+		    stage, then accumulates each voice's DCA; the result is the same as renderAccumulate( ) */
+		void renderStage(voiceRenderStage stage, uint32_t samplesToProcess);
+		bool renderDCAAccumulate(SynthProcessInfo& synthProcessInfo, uint32_t sampleOffset, uint32_t samplesToProcess, double scaling);
 		virtual bool processMIDIEvent(midiEvent& event);
 		virtual bool initialize(const char* dllPath = nullptr);
 		virtual bool doNoteOn(midiEvent& event);
@@ -447,14 +474,33 @@ namespace SynthLab
 		void setAllCustomUpdateCodes(); ///< one of many ways to keep track of what needs updating; this will likely be very dependent on your GUI system and plugin framework
 
 		// --- functions to load individual cores, if using this option (see top of file)
-		void loadLFOCore(uint32_t lfoIndex, uint32_t index); ///< load a new LFO core
-		void loadFilterCore(uint32_t filterIndex, uint32_t index);///< load a new filter core
-		void loadOscCore(uint32_t oscIndex, uint32_t index);///< load a new oscillator core
-		void loadEGCore(uint32_t egIndex, uint32_t index);///< load a new EG core
+		//     real-time safe: a core that is not built yet is not loaded (false)
+		bool loadLFOCore(uint32_t lfoIndex, uint32_t index); ///< load a new LFO core
+		bool loadFilterCore(uint32_t filterIndex, uint32_t index);///< load a new filter core
+		bool loadOscCore(uint32_t oscIndex, uint32_t index);///< load a new oscillator core
+		bool loadEGCore(uint32_t egIndex, uint32_t index);///< load a new EG core
+
+		// --- patch analysis; update( ) runs this, parameter automation runs it on its own
+		void analyzePatch();		///< find modules that can affect the output; run on param/routing change
 
 		// --- DM STUFF ---
 		void setDynamicModules(std::vector<std::shared_ptr<SynthLab::ModuleCore>> modules); ///< add dynamically loaded DLL modules to existing cores
 
+		// --- memory accounting
+		void getMemoryReport(MemoryReport& report); ///< voice object, mix buffers, mod matrix and a child per module
+
+		// --- residency
+		void addReachableSources(ReachableSources& sources); ///< tables and samples the oscillators can read
+
+		// --- change detection
+		void addUpdateCounters(UpdateCounters& counters); ///< update( ) counters of the modules and their cores
+
+		// --- telemetry
+		void getModulatorTelemetry(VoiceTelemetry& telemetry); ///< EG and LFO outputs at the end of the last render
+
+		// --- background patch preparation
+		void prepareModuleCores(SynthVoiceParameters& patchParameters, PreparedCoreList& cores); ///< builds the cores a patch selects that are not instantiated yet
+
 	protected:
 		/** standalone operation only */
 		std::shared_ptr<SynthVoiceParameters> parameters = nullptr;
@@ -473,9 +519,29 @@ namespace SynthLab
 		void accumulateToMixBuffer(std::shared_ptr<AudioBuffer> oscBuffers, uint32_t samplesInBlock, double scaling); ///< accumulating voice audio data
 		void writeToMixBuffer(std::shared_ptr<AudioBuffer> oscBuffers, uint32_t samplesInBlock, double scaling = 1.0); ///< write to final mix buffer
 
+		// --- render helpers shared by render() and renderAccumulate()
+		void renderModules(uint32_t samplesToProcess);	///< modulators, oscillators, filters -> DCA input
+		void renderLFOStage(uint32_t samplesToProcess);			///< voiceRenderStage::kLFOs
+		void renderEGStage(uint32_t samplesToProcess);			///< voiceRenderStage::kEGs
+		void renderOscillatorStage(uint32_t samplesToProcess);	///< voiceRenderStage::kOscillators
+		void renderFilterStage(uint32_t samplesToProcess);		///< voiceRenderStage::kFilters
+		void checkNoteOffCondition();					///< Amp EG expired: steal or deactivate
+
+		// --- patch analysis: nodes of the voice render graph
+		enum { kRGOsc1, kRGOsc2, kRGOsc3, kRGOsc4, kRGLFO1, kRGLFO2, kRGAmpEG, kRGFilterEG, kRGAuxEG,
+			   kRGFilter1, kRGFilter2, kRGDCA, kNumRenderGraphNodes };
+		void buildRenderGraph();	///< find the owner module of each mod matrix source/destination (once)
+		void copyRenderGraph(SynthVoice* prototype);	///< skip the render graph analysis: copy its result and core set from an initialized voice
+		bool isModuleLive(uint32_t node) { return moduleLive[node]; }	///< false = skip render() and update()
+		SynthModule* getModuleForMask(uint32_t mask);	///< module for a GUI update code, nullptr if not in this configuration
+		int32_t modSourceOwner[kNumberModSources];			///< render graph node that owns the source, -1 = unknown
+		int32_t modDestinationOwner[kNumberModDestinations];///< render graph node that owns the destination, -1 = unknown
+		bool moduleLive[kNumRenderGraphNodes];				///< result of analyzePatch()
+
 		// --- voice timestamp, for knowing the age of a voice
 		uint32_t timestamp = 0;						///<voice timestamp, for knowing the age of a voice
 		int32_t currentMIDINote = -1;				///<voice timestamp, for knowing the age of a voice
+		const BasicLookupTables* lookupTables = nullptr;	///< shared per-note pitch table
 
 		// --- note message state
 		voiceState voiceNoteState = voiceState::kNoteOffState; ///< state variable
@@ -500,10 +566,16 @@ namespace SynthLab
 		const enum { MAIN_OSC, DETUNED_OSC, NUM_WS_OSC };
 		std::unique_ptr<WSOscillator> wsOscillator[NUM_WS_OSC] = { nullptr, nullptr };	///< oscillator (WS only_
 #else
-		// ---- components: 4 oscillators
+		// ---- components: NUM_OSC oscillators (4 in the full SynthEngineConfig)
 		std::unique_ptr<SynthModule> oscillator[NUM_OSC];	///< oscillators
 #endif
 
+#ifdef SYNTHLAB_DX
+		static_assert(NUM_OSC == 4, "SynthLab-DX: the FM algorithms need 4 operators");
+#elif defined SYNTHLAB_WS
+		static_assert(NUM_OSC == NUM_OSCILLATORS, "SynthLab-WS: the wave sequencer oscillators are not configurable");
+#endif
+
 		// --- LFOs
 		std::unique_ptr<SynthLFO> lfo[NUM_LFO];				///< LFOs
 
@@ -522,6 +594,19 @@ namespace SynthLab
 		DCRemovalFilter dcFilter[STEREO_CHANNELS];	///< DC removal for short term random bias
 		inline void removeMixBufferDC(uint32_t blockSize)
 		{
+			// --- silent mix: skip only once the filters have settled, and flush them then so
+			//     the next note does not start from a stale x[n-1]; until then run the tail
+			if (mixBuffers->allOutputsSilent())
+			{
+				if (dcFilter[LEFT_CHANNEL].isSettled() && dcFilter[RIGHT_CHANNEL].isSettled())
+				{
+					dcFilter[LEFT_CHANNEL].flush();
+					dcFilter[RIGHT_CHANNEL].flush();
+					return;
+				}
+				mixBuffers->setOutputSilenceFlags(0);
+			}
+
 			float* leftOutBuffer = mixBuffers->getOutputBuffer(LEFT_CHANNEL);
 			float* rightOutBuffer = mixBuffers->getOutputBuffer(RIGHT_CHANNEL);
 			for (uint32_t i = 0; i < blockSize; i++)
@@ -0,0 +1,730 @@
+// --- SynthLab kernel checker
+//
+#include "../../source/synthkernels.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   kernelcheck.cpp
+\author Will Pirkle
+\brief  Differential check of optimized block kernels against the scalar reference; see usage( ) below
+- compile together with source/synthkernels.cpp and source/synthkernelsx86.cpp; no engine needed
+- every candidate SynthKernelTable is fuzzed side by side with getScalarKernels( ) using random
+inputs, parameters, block sizes and buffer alignments
+- stateful kernels (table read, biquad, ramp, noise, rotator bank) also run long sequences of blocks and
+report how far their state drifts from the reference
+- each kernel is timed for both variants so speed and accuracy are reported together
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+using namespace SynthLab;
+
+namespace KernelCheck
+{
+	/**
+	\enum KernelID
+	\brief
+	The kernels of a SynthKernelTable
+	*/
+	enum KernelID
+	{
+		kMixAccumulate,
+		kMixWrite,
+		kApplyGain,
+		kTableRead,
+		kBiquad,
+		kLinearRamp,
+		kWhiteNoise,
+		kInt16ToFloat,
+		kDoubleToFloat,
+		kRotatorBank,
+		kGrainAccumulate,
+		kNumKernels
+	};
+
+	static const char* kernelNames[kNumKernels] =
+	{ "mixAccumulate", "mixWrite", "applyGain", "tableRead", "biquad", "linearRamp", "whiteNoise", "int16ToFloat", "doubleToFloat", "rotatorBank", "grainAccumulate" };
+
+	/**
+	\struct Tolerance
+	\brief
+	Allowed difference from the reference; an output sample passes if it is within
+	maxULP OR within maxAbsError (ULPs are meaningless near zero)
+	*/
+	struct Tolerance
+	{
+		uint32_t maxULP = 0;
+		double maxAbsError = 0.0;
+		double maxStateDrift = 0.0;
+	};
+
+	/** per kernel; pure arithmetic kernels allow FMA/reassociation rounding, the noise generator is bit exact */
+	static const Tolerance tolerances[kNumKernels] =
+	{
+		{ 2, 1.0e-7, 0.0 },		// mixAccumulate
+		{ 1, 0.0, 0.0 },		// mixWrite
+		{ 1, 0.0, 0.0 },		// applyGain
+		{ 4, 1.0e-6, 1.0e-9 },	// tableRead (phase)
+		{ 16, 1.0e-5, 1.0e-6 },	// biquad (state registers)
+		{ 1, 1.0e-6, 1.0e-9 },	// linearRamp (relative value)
+		{ 0, 0.0, 0.0 },		// whiteNoise
+		{ 0, 0.0, 0.0 },		// int16ToFloat
+		{ 0, 0.0, 0.0 },		// doubleToFloat
+		{ 4, 1.0e-6, 1.0e-9 },	// rotatorBank (sum order differs; fused multiply-adds in the rotators)
+		{ 4, 1.0e-6, 0.0 },		// grainAccumulate (fused multiply-adds in the interpolations)
+	};
+
+	/** block sizes that hit loop remainders and unroll boundaries; others are random */
+	static const uint32_t edgeBlockSizes[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 255, 256, 1023, 1024 };
+	static const uint32_t MAX_BLOCK_SIZE = 1024;
+	static const uint32_t MAX_MISALIGNMENT = 16;	///< floats; covers 64-byte (AVX-512) alignment
+	static const uint32_t TABLE_LENGTH = 2048;
+	static const uint32_t MAX_PARTIALS = 67;		///< rotator bank; covers every lane remainder up to 8 lanes
+	static const uint32_t GRAIN_FRAMES = 4096;		///< grain sample buffer; covers the largest read span of a block
+	static const double kTwoPi = 6.283185307179586;
+
+	/**
+	\struct KernelResult
+	\brief
+	Accuracy and speed of one kernel of one candidate table
+	*/
+	struct KernelResult
+	{
+		std::string kernel;
+		std::string variant;
+		uint32_t trials = 0;
+		uint32_t maxULP = 0;			///< worst sample, in units in the last place
+		double maxAbsError = 0.0;		///< worst sample, absolute
+		double stateDrift = 0.0;		///< worst state difference at the end of the long runs
+		uint32_t failedSamples = 0;		///< samples outside the tolerance
+		double reference_nsPerSample = 0.0;
+		double candidate_nsPerSample = 0.0;
+
+		bool passed(const Tolerance& tolerance) const
+		{
+			return failedSamples == 0 && stateDrift <= tolerance.maxStateDrift;
+		}
+	};
+
+	/**
+	\struct KernelParams
+	\brief
+	The randomized parameters of one block
+	*/
+	struct KernelParams
+	{
+		float gain = 1.0f;
+		uint32_t tableLength = TABLE_LENGTH;
+		double phaseInc = 0.01;
+		double outputComp = 1.0;
+		double coeffs[7] = { 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0 };
+		double rampIncrement = 0.0;
+		uint32_t partials = 1;
+		double cosInc[MAX_PARTIALS] = { 1.0 };
+		double sinInc[MAX_PARTIALS] = { 0.0 };
+		double ampInc[MAX_PARTIALS] = { 0.0 };
+		uint32_t grainChannels = 1;
+		double grainReadIndex = 0.0;
+		double grainReadInc = 1.0;
+		double grainWindowPhase = 0.0;
+		double grainWindowInc = 0.0;
+		float grainGainR = 1.0f;
+	};
+
+	/**
+	\struct KernelState
+	\brief
+	The state carried from block to block by the stateful kernels
+	*/
+	struct KernelState
+	{
+		double phase = 0.0;
+		double biquadState[2] = { 0.0, 0.0 };
+		double rampValue = 0.0;
+		int32_t noiseState[2] = { 0x67452301, (int32_t)0xefcdab89 };
+		double rotatorRe[MAX_PARTIALS] = { 0.0 };
+		double rotatorIm[MAX_PARTIALS] = { 0.0 };
+		double rotatorAmp[MAX_PARTIALS] = { 0.0 };
+	};
+
+	/**
+	\brief
+	Distance between two floats in units in the last place
+	- NaN against non-NaN is the maximum distance
+
+	\return ULP distance
+	*/
+	uint32_t ulpDistance(float a, float b)
+	{
+		if (a == b) return 0;
+		if (isnan(a) || isnan(b)) return 0xFFFFFFFF;
+
+		// --- map the sign-magnitude bit pattern onto a monotonic integer line
+		int32_t ia = 0, ib = 0;
+		memcpy(&ia, &a, sizeof(float));
+		memcpy(&ib, &b, sizeof(float));
+		int64_t la = ia < 0 ? (int64_t)INT32_MIN - ia : ia;
+		int64_t lb = ib < 0 ? (int64_t)INT32_MIN - ib : ib;
+		int64_t distance = la > lb ? la - lb : lb - la;
+		return distance > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)distance;
+	}
+
+	/**
+	\class TestBuffer
+	\brief
+	Padded buffer whose data pointer can be placed at any float offset from a 64-byte boundary
+	*/
+	template <typename T>
+	class TestBuffer
+	{
+	public:
+		TestBuffer() : storage(MAX_BLOCK_SIZE + MAX_MISALIGNMENT + 64) {}
+
+		/** data pointer at the misalignment offset (in elements) from a 64-byte boundary */
+		T* at(uint32_t misalignment)
+		{
+			uintptr_t base = reinterpret_cast<uintptr_t>(storage.data());
+			uintptr_t aligned = (base + 63) & ~(uintptr_t)63;
+			return reinterpret_cast<T*>(aligned) + misalignment;
+		}
+
+	protected:
+		std::vector<T> storage;
+	};
+
+	/**
+	\class KernelChecker
+	\brief
+	Runs one candidate kernel table side by side with the scalar reference
+	*/
+	class KernelChecker
+	{
+	public:
+		KernelChecker(uint32_t seed) : rng(seed)
+		{
+			// --- one band limited, asymmetric wave for the table reads
+			for (uint32_t i = 0; i < TABLE_LENGTH; i++)
+			{
+				double x = (kTwoPi * i) / TABLE_LENGTH;
+				table[i] = 0.6 * sin(x) + 0.3 * sin(3.0 * x + 0.5) + 0.1 * cos(7.0 * x);
+			}
+
+			// --- grain source, read as mono or interleaved stereo
+			for (uint32_t i = 0; i < 2 * GRAIN_FRAMES; i++)
+				grainSamples[i] = randomSample();
+		}
+
+		/** accuracy: random single blocks, then long runs of the stateful kernels */
+		void checkAccuracy(KernelID kernel, const SynthKernelTable& reference, const SynthKernelTable& candidate,
+			uint32_t trials, uint32_t longRunBlocks, KernelResult& result);
+
+		/** speed: ns per sample of both tables at a given block size */
+		void timeKernel(KernelID kernel, const SynthKernelTable& reference, const SynthKernelTable& candidate,
+			uint32_t blockSize, KernelResult& result);
+
+	protected:
+		std::mt19937 rng;
+		double table[TABLE_LENGTH];
+		float grainSamples[2 * GRAIN_FRAMES];
+
+		TestBuffer<float> sourceBuffer;
+		TestBuffer<double> doubleSourceBuffer;
+		TestBuffer<int16_t> int16SourceBuffer;
+		TestBuffer<float> referenceOut;
+		TestBuffer<float> candidateOut;
+
+		uint32_t randomInt(uint32_t maxValue) { return std::uniform_int_distribution<uint32_t>(0, maxValue)(rng); }
+		double randomDouble(double minValue, double maxValue) { return std::uniform_real_distribution<double>(minValue, maxValue)(rng); }
+
+		uint32_t randomBlockSize();
+		float randomSample();
+		void randomParams(KernelParams& params);
+		void randomState(KernelState& state);
+		void fillSources(uint32_t offset, uint32_t count);
+
+		void invoke(KernelID kernel, const SynthKernelTable& kernels, float* dest, uint32_t sourceOffset, uint32_t count,
+			const KernelParams& params, KernelState& state);
+		void compareOutputs(KernelID kernel, const float* referenceData, const float* candidateData, uint32_t count, KernelResult& result);
+		double compareStates(KernelID kernel, const KernelState& referenceState, const KernelState& candidateState);
+	};
+
+	/**
+	\brief
+	Half of the blocks use an edge size, the rest are uniform in 1 -> MAX_BLOCK_SIZE
+	*/
+	uint32_t KernelChecker::randomBlockSize()
+	{
+		if (randomInt(1))
+			return edgeBlockSizes[randomInt(sizeof(edgeBlockSizes) / sizeof(uint32_t) - 1)];
+		return 1 + randomInt(MAX_BLOCK_SIZE - 1);
+	}
+
+	/**
+	\brief
+	Mostly audio range samples, with some zeros, full scale values and denormals
+	*/
+	float KernelChecker::randomSample()
+	{
+		switch (randomInt(31))
+		{
+			case 0: return 0.0f;
+			case 1: return 1.0f;
+			case 2: return -1.0f;
+			case 3: return 1.0e-40f; // --- denormal
+			default: return (float)randomDouble(-1.0, 1.0);
+		}
+	}
+
+	/**
+	\brief
+	Randomizes the parameters used by a kernel; biquads are stable RBJ low pass filters
+	with a random dry/wet mix
+	*/
+	void KernelChecker::randomParams(KernelParams& params)
+	{
+		params.gain = (float)randomDouble(-2.0, 2.0);
+		params.tableLength = TABLE_LENGTH >> randomInt(3);
+		params.phaseInc = randomDouble(0.0, 0.49);
+		params.outputComp = randomDouble(0.1, 2.0);
+		params.rampIncrement = randomDouble(-1.0e-3, 1.0e-3);
+
+		double fc = randomDouble(20.0, 20000.0);
+		double Q = randomDouble(0.5, 20.0);
+		double theta = kTwoPi * fc / 48000.0;
+		double alpha = sin(theta) / (2.0 * Q);
+		double norm = 1.0 + alpha;
+		params.coeffs[0] = (1.0 - cos(theta)) / (2.0 * norm);
+		params.coeffs[1] = (1.0 - cos(theta)) / norm;
+		params.coeffs[2] = params.coeffs[0];
+		params.coeffs[3] = (-2.0 * cos(theta)) / norm;
+		params.coeffs[4] = (1.0 - alpha) / norm;
+		params.coeffs[5] = randomDouble(0.0, 1.0);
+		params.coeffs[6] = 1.0 - params.coeffs[5];
+
+		// --- partials anywhere up to Nyquist, slow amplitude ramps
+		params.partials = 1 + randomInt(MAX_PARTIALS - 1);
+		for (uint32_t k = 0; k < MAX_PARTIALS; k++)
+		{
+			double w = randomDouble(0.0, 0.5 * kTwoPi);
+			params.cosInc[k] = cos(w);
+			params.sinInc[k] = sin(w);
+			params.ampInc[k] = randomDouble(-1.0e-7, 1.0e-7);
+		}
+
+		// --- grains: pitch -2 -> +1 octaves; every sample and window read of a full block stays in range
+		params.grainChannels = 1 + randomInt(1);
+		params.grainReadInc = randomDouble(0.25, 2.0);
+		params.grainReadIndex = randomDouble(0.0, GRAIN_FRAMES - 2.0 - (MAX_BLOCK_SIZE - 1) * params.grainReadInc);
+		params.grainWindowPhase = randomDouble(0.0, TABLE_LENGTH / 2.0);
+		params.grainWindowInc = randomDouble(0.0, (TABLE_LENGTH - 2.0 - params.grainWindowPhase) / MAX_BLOCK_SIZE);
+		params.grainGainR = (float)randomDouble(-2.0, 2.0);
+	}
+
+	/**
+	\brief
+	Random starting state
+	*/
+	void KernelChecker::randomState(KernelState& state)
+	{
+		state.phase = randomDouble(0.0, 1.0);
+		state.biquadState[0] = randomDouble(-1.0, 1.0);
+		state.biquadState[1] = randomDouble(-1.0, 1.0);
+		state.rampValue = randomDouble(0.0, 1.0);
+		state.noiseState[0] = (int32_t)rng();
+		state.noiseState[1] = (int32_t)rng();
+
+		// --- rotators on the unit circle at random phases
+		for (uint32_t k = 0; k < MAX_PARTIALS; k++)
+		{
+			double phase = randomDouble(0.0, kTwoPi);
+			state.rotatorRe[k] = cos(phase);
+			state.rotatorIm[k] = sin(phase);
+			state.rotatorAmp[k] = randomDouble(-1.0, 1.0) / MAX_PARTIALS;
+		}
+	}
+
+	/**
+	\brief
+	Random float, double and 16-bit inputs at the given alignment
+	*/
+	void KernelChecker::fillSources(uint32_t offset, uint32_t count)
+	{
+		float* source = sourceBuffer.at(offset);
+		double* doubleSource = doubleSourceBuffer.at(offset);
+		int16_t* int16Source = int16SourceBuffer.at(offset);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			source[i] = randomSample();
+			doubleSource[i] = randomDouble(-2.0, 2.0);
+			int16Source[i] = (int16_t)(randomInt(65535) - 32768);
+		}
+		int16Source[0] = -32768; // --- extremes
+		if (count > 1) int16Source[count - 1] = 32767;
+	}
+
+	/**
+	\brief
+	Calls one kernel of a table with the shared inputs
+	*/
+	void KernelChecker::invoke(KernelID kernel, const SynthKernelTable& kernels, float* dest, uint32_t sourceOffset, uint32_t count,
+		const KernelParams& params, KernelState& state)
+	{
+		const float* source = sourceBuffer.at(sourceOffset);
+
+		switch (kernel)
+		{
+			case kMixAccumulate: kernels.mixAccumulate(dest, source, count, params.gain); break;
+			case kMixWrite: kernels.mixWrite(dest, source, count, params.gain); break;
+			case kApplyGain: kernels.applyGain(dest, count, params.gain); break;
+			case kTableRead: state.phase = kernels.tableRead(dest, table, params.tableLength, state.phase, params.phaseInc, params.outputComp, count); break;
+			case kBiquad: kernels.biquad(dest, count, params.coeffs, state.biquadState); break;
+			case kLinearRamp: state.rampValue = kernels.linearRamp(dest, count, state.rampValue, params.rampIncrement); break;
+			case kWhiteNoise: kernels.whiteNoise(dest, count, state.noiseState); break;
+			case kInt16ToFloat: kernels.int16ToFloat(dest, int16SourceBuffer.at(sourceOffset), count); break;
+			case kDoubleToFloat: kernels.doubleToFloat(dest, doubleSourceBuffer.at(sourceOffset), count); break;
+			case kRotatorBank: kernels.rotatorBank(dest, count, state.rotatorRe, state.rotatorIm, params.cosInc, params.sinInc,
+				state.rotatorAmp, params.ampInc, params.partials); break;
+			case kGrainAccumulate:
+				// --- both channels accumulate into dest, so every output sample checks left and right
+				kernels.grainAccumulate(dest, dest, count, grainSamples, params.grainChannels, params.grainReadIndex, params.grainReadInc,
+					table, params.grainWindowPhase, params.grainWindowInc, params.gain, params.grainGainR); break;
+			default: break;
+		}
+	}
+
+	/**
+	\brief
+	Updates the worst errors and counts the samples outside the tolerance
+	*/
+	void KernelChecker::compareOutputs(KernelID kernel, const float* referenceData, const float* candidateData, uint32_t count, KernelResult& result)
+	{
+		const Tolerance& tolerance = tolerances[kernel];
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t ulp = ulpDistance(referenceData[i], candidateData[i]);
+			double absError = fabs((double)referenceData[i] - (double)candidateData[i]);
+			if (isnan(absError)) absError = HUGE_VAL;
+
+			result.maxULP = std::max(result.maxULP, ulp);
+			result.maxAbsError = std::max(result.maxAbsError, absError);
+			if (ulp > tolerance.maxULP && absError > tolerance.maxAbsError)
+				result.failedSamples++;
+		}
+	}
+
+	/**
+	\brief
+	Largest difference between the reference and candidate state variables
+	*/
+	double KernelChecker::compareStates(KernelID kernel, const KernelState& referenceState, const KernelState& candidateState)
+	{
+		switch (kernel)
+		{
+			case kTableRead:
+			{
+				// --- phase is circular
+				double drift = fabs(referenceState.phase - candidateState.phase);
+				return std::min(drift, 1.0 - drift);
+			}
+			case kBiquad:
+				return std::max(fabs(referenceState.biquadState[0] - candidateState.biquadState[0]),
+								fabs(referenceState.biquadState[1] - candidateState.biquadState[1]));
+			case kLinearRamp:
+				// --- relative: the long run walks far outside 0 -> 1 and float outputs are only checked to 1 ULP
+				return fabs(referenceState.rampValue - candidateState.rampValue) / std::max(1.0, fabs(referenceState.rampValue));
+			case kWhiteNoise:
+				return (referenceState.noiseState[0] == candidateState.noiseState[0] &&
+						referenceState.noiseState[1] == candidateState.noiseState[1]) ? 0.0 : HUGE_VAL;
+			case kRotatorBank:
+			{
+				double drift = 0.0;
+				for (uint32_t k = 0; k < MAX_PARTIALS; k++)
+				{
+					drift = std::max(drift, fabs(referenceState.rotatorRe[k] - candidateState.rotatorRe[k]));
+					drift = std::max(drift, fabs(referenceState.rotatorIm[k] - candidateState.rotatorIm[k]));
+					drift = std::max(drift, fabs(referenceState.rotatorAmp[k] - candidateState.rotatorAmp[k]));
+				}
+				return drift;
+			}
+			default:
+				return 0.0;
+		}
+	}
+
+	/**
+	\brief
+	Fuzzes one kernel: independent random blocks, then (for stateful kernels) one long run with
+	state carried across blocks of random size, parameters and alignment
+
+	\param kernel the kernel to check
+	\param reference the scalar kernels
+	\param candidate the kernels under test
+	\param trials number of independent blocks
+	\param longRunBlocks number of consecutive blocks in the long run
+	\param result accumulates the errors
+	*/
+	void KernelChecker::checkAccuracy(KernelID kernel, const SynthKernelTable& reference, const SynthKernelTable& candidate,
+		uint32_t trials, uint32_t longRunBlocks, KernelResult& result)
+	{
+		bool stateful = kernel == kTableRead || kernel == kBiquad || kernel == kLinearRamp || kernel == kWhiteNoise || kernel == kRotatorBank;
+		KernelParams params;
+		KernelState referenceState;
+		KernelState candidateState;
+
+		// --- independent blocks
+		for (uint32_t trial = 0; trial < trials; trial++)
+		{
+			uint32_t count = randomBlockSize();
+			uint32_t sourceOffset = randomInt(MAX_MISALIGNMENT - 1);
+			uint32_t destOffset = randomInt(MAX_MISALIGNMENT - 1);
+			float* referenceData = referenceOut.at(destOffset);
+			float* candidateData = candidateOut.at(destOffset);
+
+			randomParams(params);
+			randomState(referenceState);
+			candidateState = referenceState;
+			fillSources(sourceOffset, count);
+
+			// --- in-place and accumulating kernels need identical starting contents
+			for (uint32_t i = 0; i < count; i++)
+				referenceData[i] = candidateData[i] = randomSample();
+
+			invoke(kernel, reference, referenceData, sourceOffset, count, params, referenceState);
+			invoke(kernel, candidate, candidateData, sourceOffset, count, params, candidateState);
+			compareOutputs(kernel, referenceData, candidateData, count, result);
+			result.trials++;
+		}
+
+		if (!stateful)
+			return;
+
+		// --- long run; the filter and oscillator keep their parameters, as they would in a note
+		randomParams(params);
+		randomState(referenceState);
+		candidateState = referenceState;
+		for (uint32_t block = 0; block < longRunBlocks; block++)
+		{
+			uint32_t count = randomBlockSize();
+			uint32_t sourceOffset = randomInt(MAX_MISALIGNMENT - 1);
+			uint32_t destOffset = randomInt(MAX_MISALIGNMENT - 1);
+			float* referenceData = referenceOut.at(destOffset);
+			float* candidateData = candidateOut.at(destOffset);
+
+			fillSources(sourceOffset, count);
+			for (uint32_t i = 0; i < count; i++)
+				referenceData[i] = candidateData[i] = randomSample();
+
+			invoke(kernel, reference, referenceData, sourceOffset, count, params, referenceState);
+			invoke(kernel, candidate, candidateData, sourceOffset, count, params, candidateState);
+			compareOutputs(kernel, referenceData, candidateData, count, result);
+		}
+		result.stateDrift = std::max(result.stateDrift, compareStates(kernel, referenceState, candidateState));
+	}
+
+	/**
+	\brief
+	Times one kernel of both tables at a fixed block size with warm caches
+	- identical inputs and parameters for both
+	- rounds alternate between the tables and the fastest round is kept, which
+	  rejects most scheduling and frequency-scaling noise
+
+	\param kernel the kernel to time
+	\param reference the scalar kernels
+	\param candidate the kernels under test
+	\param blockSize samples per call
+	\param result receives ns per sample for both
+	*/
+	void KernelChecker::timeKernel(KernelID kernel, const SynthKernelTable& reference, const SynthKernelTable& candidate,
+		uint32_t blockSize, KernelResult& result)
+	{
+		const uint32_t rounds = 7;
+		const uint32_t iterations = 4000;
+		KernelParams params;
+		randomParams(params);
+		fillSources(0, blockSize);
+
+		// --- keep the accumulating kernel in range
+		params.gain = kernel == kMixAccumulate || kernel == kGrainAccumulate ? 1.0e-3f : 1.0f;
+		params.grainGainR = 1.0e-3f;
+		params.rampIncrement = 1.0e-6;
+		params.partials = 64;
+
+		float* dest = referenceOut.at(0);
+		auto timeRound = [&](const SynthKernelTable& kernels)
+		{
+			KernelState state;
+			for (uint32_t i = 0; i < blockSize; i++)
+				dest[i] = 0.5f;
+
+			auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < iterations; i++)
+				invoke(kernel, kernels, dest, 0, blockSize, params, state);
+			double nsec = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			return nsec / ((double)iterations * blockSize);
+		};
+
+		// --- warm up
+		timeRound(reference);
+		timeRound(candidate);
+
+		result.reference_nsPerSample = HUGE_VAL;
+		result.candidate_nsPerSample = HUGE_VAL;
+		for (uint32_t round = 0; round < rounds; round++)
+		{
+			result.reference_nsPerSample = std::min(result.reference_nsPerSample, timeRound(reference));
+			result.candidate_nsPerSample = std::min(result.candidate_nsPerSample, timeRound(candidate));
+		}
+	}
+
+	/**
+	\brief
+	The kernel tables to check against the reference: every ISA table this CPU can run
+	- the scalar table checks itself so the harness is always exercised
+
+	\return candidate tables
+	*/
+	std::vector<const SynthKernelTable*> getCandidateKernels()
+	{
+		std::vector<const SynthKernelTable*> candidates;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(KernelISA::kNumKernelISAs); i++)
+		{
+			KernelISA isa = static_cast<KernelISA>(i);
+			if (isKernelISASupported(isa))
+				candidates.push_back(getISAKernels(isa));
+		}
+		return candidates;
+	}
+
+	/**
+	\brief
+	ISA tables leave kernels they do not implement as nullptr
+
+	\return true if the table has a version of the kernel
+	*/
+	bool hasKernel(KernelID kernel, const SynthKernelTable& kernels)
+	{
+		switch (kernel)
+		{
+			case kMixAccumulate: return kernels.mixAccumulate != nullptr;
+			case kMixWrite: return kernels.mixWrite != nullptr;
+			case kApplyGain: return kernels.applyGain != nullptr;
+			case kTableRead: return kernels.tableRead != nullptr;
+			case kBiquad: return kernels.biquad != nullptr;
+			case kLinearRamp: return kernels.linearRamp != nullptr;
+			case kWhiteNoise: return kernels.whiteNoise != nullptr;
+			case kInt16ToFloat: return kernels.int16ToFloat != nullptr;
+			case kDoubleToFloat: return kernels.doubleToFloat != nullptr;
+			case kRotatorBank: return kernels.rotatorBank != nullptr;
+			case kGrainAccumulate: return kernels.grainAccumulate != nullptr;
+			default: return false;
+		}
+	}
+
+	void usage()
+	{
+		printf("usage: kernelcheck [options]\n");
+		printf("  --seed n       random seed (default 1); failures print the seed to reproduce\n");
+		printf("  --trials n     independent random blocks per kernel (default 2000)\n");
+		printf("  --blocks n     consecutive blocks in the stateful long runs (default 20000)\n");
+		printf("  --kernel name  check one kernel only\n");
+		printf("  --variant name check one candidate table only\n");
+		printf("  --block n      block size for the timing columns (default 64)\n");
+		printf("  --no-timing    accuracy only\n");
+		printf("exit code: 0 = all kernels within tolerance, 1 = failures, 2 = bad arguments\n");
+	}
+
+} // namespace
+
+using namespace KernelCheck;
+
+int main(int argc, char* argv[])
+{
+	uint32_t seed = 1;
+	uint32_t trials = 2000;
+	uint32_t longRunBlocks = 20000;
+	uint32_t timingBlockSize = 64;
+	bool timing = true;
+	const char* onlyKernel = nullptr;
+	const char* onlyVariant = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (!strcmp(argv[i], "--seed") && hasValue) seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if (!strcmp(argv[i], "--trials") && hasValue) trials = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if (!strcmp(argv[i], "--blocks") && hasValue) longRunBlocks = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if (!strcmp(argv[i], "--kernel") && hasValue) onlyKernel = argv[++i];
+		else if (!strcmp(argv[i], "--variant") && hasValue) onlyVariant = argv[++i];
+		else if (!strcmp(argv[i], "--block") && hasValue) timingBlockSize = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if (!strcmp(argv[i], "--no-timing")) timing = false;
+		else { usage(); return 2; }
+	}
+
+	if (timingBlockSize < 1 || timingBlockSize > MAX_BLOCK_SIZE)
+	{
+		printf("--block must be 1 -> %u\n", MAX_BLOCK_SIZE);
+		return 2;
+	}
+
+	const SynthKernelTable& reference = getScalarKernels();
+	uint32_t failures = 0;
+
+	// --- what the engine would bind on this machine
+	initSynthKernels();
+	printf("%s\n", getSynthKernelsReport().c_str());
+
+	printf("%-14s %-10s %7s %8s %10s %10s %9s %9s %8s %s\n",
+		"kernel", "variant", "trials", "maxULP", "maxAbs", "drift", "ref_ns", "cand_ns", "speedup", "result");
+
+	for (const SynthKernelTable* candidate : getCandidateKernels())
+	{
+		if (onlyVariant && strcmp(onlyVariant, candidate->variantName) != 0)
+			continue;
+
+		for (uint32_t kernel = 0; kernel < kNumKernels; kernel++)
+		{
+			if (onlyKernel && strcmp(onlyKernel, kernelNames[kernel]) != 0)
+				continue;
+			if (!hasKernel((KernelID)kernel, *candidate))
+				continue;
+
+			// --- same seed per kernel so a single kernel can be re-run in isolation
+			KernelChecker checker(seed + kernel);
+			KernelResult result;
+			result.kernel = kernelNames[kernel];
+			result.variant = candidate->variantName;
+			checker.checkAccuracy((KernelID)kernel, reference, *candidate, trials, longRunBlocks, result);
+
+			if (timing)
+				checker.timeKernel((KernelID)kernel, reference, *candidate, timingBlockSize, result);
+
+			bool passed = result.passed(tolerances[kernel]);
+			if (!passed) failures++;
+
+			printf("%-14s %-10s %7u %8u %10.3g %10.3g %9.3f %9.3f %8.2f %s\n",
+				result.kernel.c_str(), result.variant.c_str(), result.trials, result.maxULP, result.maxAbsError, result.stateDrift,
+				result.reference_nsPerSample, result.candidate_nsPerSample,
+				result.candidate_nsPerSample > 0.0 ? result.reference_nsPerSample / result.candidate_nsPerSample : 0.0,
+				passed ? "ok" : "FAIL");
+
+			if (!passed)
+				printf("    %u samples outside tolerance; reproduce with --seed %u --kernel %s --variant %s\n",
+					result.failedSamples, seed, result.kernel.c_str(), result.variant.c_str());
+		}
+	}
+
+	return failures > 0 ? 1 : 0;
+}
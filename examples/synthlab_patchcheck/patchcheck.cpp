@@ -0,0 +1,324 @@
+// --- SynthLab patch checker
+//
+#include "../synthlab_examples/synthengine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include <random>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   patchcheck.cpp
+\author Will Pirkle
+\brief  Loads patches with out-of-range index fields and corrupted payloads; see usage( ) below
+- compile together with the SynthLab sources and the synthlab_examples engine and voice,
+using the same SYNTHLAB_WT (VA, PCM, KS, DX, WS) flag as the plugin
+- exits with 1 if an index reaches the audio thread out of range or the output is not finite;
+a crash is a failure too
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+using namespace SynthLab;
+
+namespace PatchCheck
+{
+	/** the engine's render block size, same as the plugin's */
+	static const uint32_t ENGINE_BLOCK_SIZE = 64;
+
+	void usage()
+	{
+		printf("usage: patchcheck [--fs sampleRate] [--fuzz count] [--seed n] [--dll path]\n");
+		printf("  saves a patch with out-of-range index fields, loads it and renders notes with it,\n");
+		printf("  then loads count copies of a patch with random bytes changed (default 200)\n");
+	}
+
+	/**
+	\brief
+	Writes out-of-range values into every index field of the tree
+	*/
+	void poisonIndexes(SynthEngineParameters& params)
+	{
+		SynthVoiceParameters& voiceParams = *params.voiceParameters;
+		params.synthModeIndex = 50;
+		voiceParams.synthModeIndex = 50;
+		voiceParams.filterModeIndex = 1000;
+#ifdef SYNTHLAB_DX
+		voiceParams.fmAlgorithmIndex = 1000;
+#endif
+
+#ifdef SYNTHLAB_WS
+		voiceParams.wsOsc1Parameters->soloWaveWSIndex = 100000;
+		voiceParams.wsOsc2Parameters->soloWaveWSIndex = -77;
+		WaveSequencerParameters& seqParams = *voiceParams.waveSequencerParameters;
+		seqParams.timingLoopStart = 0;
+		seqParams.timingLoopEnd = 1000;
+		seqParams.timingLoopDirIndex = 99;
+		for (uint32_t i = 0; i < MAX_SEQ_STEPS; i++)
+		{
+			seqParams.stepDurationNoteIndex[i] = 1000;
+			seqParams.xfadeDurationNoteIndex[i] = 1000;
+			seqParams.stepType[i] = 99;
+			seqParams.waveLaneValue[i] = 1.0e6;
+		}
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+#ifdef SYNTHLAB_KS
+			voiceParams.getOscParameters(i)->algorithmIndex = 1000;
+#else
+			voiceParams.getOscParameters(i)->waveIndex = 1000 + i;
+#endif
+			voiceParams.getOscParameters(i)->moduleIndex = 99;
+		}
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+		{
+			voiceParams.getLFOParameters(i)->waveformIndex = -3;
+			voiceParams.getLFOParameters(i)->modeIndex = 9;
+			voiceParams.getLFOParameters(i)->moduleIndex = 99;
+		}
+		voiceParams.ampEGParameters->egContourIndex = 77;
+		voiceParams.filterEGParameters->egContourIndex = -1;
+		voiceParams.auxEGParameters->moduleIndex = 99;
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+		{
+			voiceParams.getFilterParameters(i)->filterIndex = -5;
+			voiceParams.getFilterParameters(i)->moduleIndex = 99;
+		}
+		voiceParams.dcaParameters->moduleIndex = 99;
+	}
+
+	/**
+	\brief
+	Checks the index fields of the engine's tree after a patch switch
+
+	\return the number of fields out of range; each one is printed
+	*/
+	uint32_t countBadIndexes(SynthEngineParameters& params)
+	{
+		uint32_t bad = 0;
+		auto check = [&bad](bool inRange, const char* name)
+		{
+			if (inRange) return;
+			printf("  out of range: %s\n", name);
+			bad++;
+		};
+
+		SynthVoiceParameters& voiceParams = *params.voiceParameters;
+		const uint32_t synthModes = enumToInt(SynthMode::kPoly) + 1;
+		check(params.synthModeIndex < synthModes, "engine synthModeIndex");
+		check(voiceParams.synthModeIndex < synthModes, "voice synthModeIndex");
+		check(voiceParams.filterModeIndex <= enumToInt(FilterMode::kParallel), "filterModeIndex");
+#ifdef SYNTHLAB_DX
+		check(voiceParams.fmAlgorithmIndex <= enumToInt(DX100Algo::kFM8), "fmAlgorithmIndex");
+#endif
+
+#ifdef SYNTHLAB_WS
+		const int32_t waves = (int32_t)(NUM_MODULE_CORES * MODULE_STRINGS);
+		check(voiceParams.wsOsc1Parameters->soloWaveWSIndex >= -1 && voiceParams.wsOsc1Parameters->soloWaveWSIndex < waves, "ws osc 1 soloWaveWSIndex");
+		check(voiceParams.wsOsc2Parameters->soloWaveWSIndex >= -1 && voiceParams.wsOsc2Parameters->soloWaveWSIndex < waves, "ws osc 2 soloWaveWSIndex");
+		WaveSequencerParameters& seqParams = *voiceParams.waveSequencerParameters;
+		check(seqParams.timingLoopStart >= 1 && seqParams.timingLoopStart <= MAX_SEQ_STEPS, "timingLoopStart");
+		check(seqParams.timingLoopEnd >= 1 && seqParams.timingLoopEnd <= MAX_SEQ_STEPS, "timingLoopEnd");
+		check(seqParams.timingLoopDirIndex <= enumToInt(LoopDirection::kForwardBackward), "timingLoopDirIndex");
+		for (uint32_t i = 0; i < MAX_SEQ_STEPS; i++)
+		{
+			check(seqParams.stepDurationNoteIndex[i] < enumToInt(NoteDuration::kNumNoteDurations), "stepDurationNoteIndex");
+			check(seqParams.xfadeDurationNoteIndex[i] < enumToInt(NoteDuration::kNumNoteDurations), "xfadeDurationNoteIndex");
+			check(seqParams.stepType[i] <= enumToInt(StepMode::kGate), "stepType");
+			check(seqParams.waveLaneValue[i] >= 0.0 && seqParams.waveLaneValue[i] < (double)waves, "waveLaneValue");
+		}
+#else
+		for (uint32_t i = 0; i < NUM_OSC; i++)
+		{
+#ifdef SYNTHLAB_KS
+			check(voiceParams.getOscParameters(i)->algorithmIndex < MODULE_STRINGS, "osc algorithmIndex");
+#else
+			check(voiceParams.getOscParameters(i)->waveIndex < MODULE_STRINGS, "osc waveIndex");
+#endif
+			check(voiceParams.getOscParameters(i)->moduleIndex < NUM_MODULE_CORES, "osc moduleIndex");
+		}
+#endif
+		for (uint32_t i = 0; i < NUM_LFO; i++)
+		{
+			LFOParameters& lfoParams = *voiceParams.getLFOParameters(i);
+			check(lfoParams.waveformIndex >= 0 && lfoParams.waveformIndex < (int32_t)MODULE_STRINGS, "lfo waveformIndex");
+			check(lfoParams.modeIndex >= 0 && lfoParams.modeIndex <= enumToInt(LFOMode::kFreeRun), "lfo modeIndex");
+			check(lfoParams.moduleIndex < NUM_MODULE_CORES, "lfo moduleIndex");
+		}
+		EGParameters* egs[3] = { voiceParams.ampEGParameters.get(), voiceParams.filterEGParameters.get(), voiceParams.auxEGParameters.get() };
+		for (EGParameters* egParams : egs)
+		{
+			check(egParams->egContourIndex >= 0 && egParams->egContourIndex < (int32_t)MODULE_STRINGS, "egContourIndex");
+			check(egParams->moduleIndex < NUM_MODULE_CORES, "eg moduleIndex");
+		}
+		for (uint32_t i = 0; i < NUM_FILTER; i++)
+		{
+			FilterParameters& filterParams = *voiceParams.getFilterParameters(i);
+			check(filterParams.filterIndex >= 0 && filterParams.filterIndex < (int32_t)MODULE_STRINGS, "filterIndex");
+			check(filterParams.moduleIndex < NUM_MODULE_CORES, "filter moduleIndex");
+		}
+		check(voiceParams.dcaParameters->moduleIndex < NUM_MODULE_CORES, "dca moduleIndex");
+		return bad;
+	}
+
+	/**
+	\brief
+	Renders blocks, playing a chord in the first one and releasing it before the last
+
+	\return false if a sample is not finite
+	*/
+	bool renderNotes(SynthEngine& engine, SynthProcessInfo& processInfo, uint32_t blocks)
+	{
+		bool finite = true;
+		for (uint32_t block = 0; block < blocks; block++)
+		{
+			processInfo.clearMidiEvents();
+			for (uint32_t note = 0; note < 4; note++)
+			{
+				uint32_t midiNote = 48 + 7 * note;
+				if (block == 0)
+					processInfo.pushMidiEvent(midiEvent(NOTE_ON, 0, midiNote, 100, note));
+				else if (block == blocks - 2)
+					processInfo.pushMidiEvent(midiEvent(NOTE_OFF, 0, midiNote, 0, note));
+			}
+			processInfo.setSamplesInBlock(ENGINE_BLOCK_SIZE);
+			engine.render(processInfo);
+
+			for (uint32_t channel = 0; channel < 2; channel++)
+			{
+				float* buffer = processInfo.getOutputBuffer(channel);
+				for (uint32_t i = 0; i < ENGINE_BLOCK_SIZE; i++)
+					finite = finite && std::isfinite(buffer[i]);
+			}
+		}
+		return finite;
+	}
+
+	/**
+	\brief
+	Loads a patch and renders until the audio thread has switched to it
+
+	\return false if the patch was refused
+	*/
+	bool loadPatch(SynthEngine& engine, SynthProcessInfo& processInfo, const std::vector<uint8_t>& patchData)
+	{
+		if (!engine.preparePatch(patchData.data(), (uint32_t)patchData.size()))
+			return false;
+
+		processInfo.clearMidiEvents();
+		processInfo.setSamplesInBlock(ENGINE_BLOCK_SIZE);
+		engine.render(processInfo);
+		return !engine.isPatchPending();
+	}
+}
+
+using namespace PatchCheck;
+
+int main(int argc, char* argv[])
+{
+	double sampleRate = 48000.0;
+	uint32_t fuzzCount = 200;
+	uint32_t seed = 1;
+	const char* dllPath = "";
+
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (!strcmp(argv[i], "--fs") && hasValue) sampleRate = atof(argv[++i]);
+		else if (!strcmp(argv[i], "--fuzz") && hasValue) fuzzCount = (uint32_t)atoi(argv[++i]);
+		else if (!strcmp(argv[i], "--seed") && hasValue) seed = (uint32_t)atoi(argv[++i]);
+		else if (!strcmp(argv[i], "--dll") && hasValue) dllPath = argv[++i];
+		else { usage(); return 2; }
+	}
+
+	SynthEngine engine(ENGINE_BLOCK_SIZE);
+	engine.reset(sampleRate);
+	engine.initialize(dllPath);
+
+	SynthProcessInfo processInfo(0, 2, ENGINE_BLOCK_SIZE);
+	processInfo.BPM = 120.0;
+	processInfo.timeSigNumerator = 4.0;
+	processInfo.timeSigDenomintor = 4;
+
+	std::shared_ptr<SynthEngineParameters> parameters;
+	engine.getParameters(parameters);
+
+	std::vector<uint8_t> patchData;
+	uint32_t failures = 0;
+
+	// --- step 1: out-of-range index fields
+	{
+		std::vector<uint8_t> validPatch;
+		engine.savePatch(validPatch);
+
+		// --- the voices point into the engine's tree, so poison it, save it and load the valid
+		//     patch back before the next render( ) can see the bad values
+		poisonIndexes(*parameters);
+		engine.savePatch(patchData);
+		if (!engine.preparePatch(validPatch.data(), (uint32_t)validPatch.size()))
+		{
+			printf("FAIL: the valid patch was refused\n");
+			return 1;
+		}
+		processInfo.clearMidiEvents();
+		processInfo.setSamplesInBlock(ENGINE_BLOCK_SIZE);
+		engine.render(processInfo);
+
+		if (!loadPatch(engine, processInfo, patchData))
+		{
+			printf("FAIL: the patch with out-of-range indexes was refused\n");
+			failures++;
+		}
+		else
+		{
+			uint32_t bad = countBadIndexes(*parameters);
+			bool finite = renderNotes(engine, processInfo, 200);
+			printf("out-of-range indexes: %u fields left out of range, output %s\n", bad, finite ? "finite" : "NOT finite");
+			if (bad || !finite)
+				failures++;
+		}
+	}
+
+	// --- step 2: random bytes changed after the header; the patch may be refused, but if it
+	//     loads its indexes must be in range and rendering must not crash
+	{
+		std::vector<uint8_t> cleanPatch;
+		engine.savePatch(cleanPatch);
+
+		std::mt19937 random(seed);
+		uint32_t loaded = 0;
+		uint32_t badPatches = 0;
+		for (uint32_t n = 0; n < fuzzCount; n++)
+		{
+			std::vector<uint8_t> fuzzed = cleanPatch;
+			uint32_t changes = 1 + random() % 16;
+			for (uint32_t c = 0; c < changes && fuzzed.size() > kPatchHeaderBytes; c++)
+			{
+				size_t offset = kPatchHeaderBytes + random() % (fuzzed.size() - kPatchHeaderBytes);
+				fuzzed[offset] = (uint8_t)random();
+			}
+
+			if (!loadPatch(engine, processInfo, fuzzed))
+				continue;
+
+			loaded++;
+			if (countBadIndexes(*parameters))
+				badPatches++;
+
+			// --- only the indexes are checked: a random double can be any frequency or gain
+			renderNotes(engine, processInfo, 8);
+		}
+		printf("fuzzed patches: %u of %u loaded, %u with indexes out of range\n", loaded, fuzzCount, badPatches);
+		if (badPatches)
+			failures++;
+	}
+
+	printf(failures ? "FAILED\n" : "passed\n");
+	return failures ? 1 : 0;
+}
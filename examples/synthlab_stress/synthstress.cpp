@@ -0,0 +1,436 @@
+// --- SynthLab stress tool
+//
+#include "../synthlab_examples/synthengine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthstress.cpp
+\author Will Pirkle
+\brief  Worst-case block timing under adversarial MIDI; see usage( ) below
+- compile together with the SynthLab sources and the synthlab_examples engine and voice,
+using the same SYNTHLAB_WT (VA, PCM, KS, DX, WS) flag as the plugin
+- average CPU is not reported on purpose: the worst block is what drops out in a DAW
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+using namespace SynthLab;
+
+namespace SynthStress
+{
+	/**
+	\enum StressScenario
+	\brief
+	The adversarial MIDI streams
+	*/
+	enum StressScenario
+	{
+		kChord128,			///< all 128 notes on (then off) at a single sample offset
+		kStealCycle,		///< note-ons faster than voices can free up, at full polyphony
+		kSustainFlood,		///< sustain pedal toggling every few samples over held and released notes
+		kControllerStream,	///< pitch bend, mod wheel and volume on every sample of every block
+		kPatchChange,		///< core changes on oscillators, filters and LFOs mid-note
+		kNumStressScenarios
+	};
+
+	static const char* scenarioNames[kNumStressScenarios] =
+	{ "chord128", "stealCycle", "sustainFlood", "controllerStream", "patchChange" };
+
+	/** host block sizes to test; the engine renders internally in ENGINE_BLOCK_SIZE slices */
+	static const uint32_t hostBlockSizes[] = { 32, 64, 256, 1024 };
+	static const uint32_t ENGINE_BLOCK_SIZE = 64;
+
+	/**
+	\struct StressResult
+	\brief
+	Block timing for one scenario/core/block-size run, as percent of the real-time budget
+	*/
+	struct StressResult
+	{
+		std::string scenario;
+		std::string core;
+		uint32_t blockSize = 0;
+		double worst_Percent = 0.0;	///< worst block
+		double p999_Percent = 0.0;	///< 99.9th percentile block
+	};
+
+	/**
+	\struct StressThreshold
+	\brief
+	One line of the thresholds file; "*" matches any scenario, core or block size
+	*/
+	struct StressThreshold
+	{
+		std::string scenario;
+		std::string core;
+		std::string blockSize;
+		double worst_Percent = 100.0;
+		double p999_Percent = 100.0;
+
+		bool matches(const StressResult& result) const
+		{
+			return (scenario == "*" || scenario == result.scenario) &&
+				   (core == "*" || core == result.core) &&
+				   (blockSize == "*" || blockSize == std::to_string(result.blockSize));
+		}
+	};
+
+	/**
+	\brief
+	Sets the core index on every module that has alternate cores
+
+	\param parameters the engine parameters
+	\param oscCore oscillator core index
+	\param otherCore filter and LFO core index; wraps at two cores
+	*/
+	void selectCores(std::shared_ptr<SynthEngineParameters>& parameters, uint32_t oscCore, uint32_t otherCore)
+	{
+		std::shared_ptr<SynthVoiceParameters> voice = parameters->voiceParameters;
+#ifndef SYNTHLAB_WS
+		voice->osc1Parameters->moduleIndex = oscCore;
+		voice->osc2Parameters->moduleIndex = oscCore;
+		voice->osc3Parameters->moduleIndex = oscCore;
+		voice->osc4Parameters->moduleIndex = oscCore;
+#endif
+		voice->filter1Parameters->moduleIndex = otherCore % 2;
+		voice->filter2Parameters->moduleIndex = otherCore % 2;
+		voice->lfo1Parameters->moduleIndex = otherCore % 2;
+		voice->lfo2Parameters->moduleIndex = otherCore % 2;
+	}
+
+	/**
+	\brief
+	Queues the adversarial MIDI for one host block
+
+	\param scenario the stream to generate
+	\param block index of the block in the run
+	\param blockSize host block size
+	\param processInfo receives the events
+	\param parameters engine parameters; modified by the patch change scenario
+	\param oscCore the core under test
+	\param oscCoreCount number of oscillator cores, for the patch change scenario
+	*/
+	void generateEvents(StressScenario scenario, uint32_t block, uint32_t blockSize, SynthProcessInfo& processInfo,
+		std::shared_ptr<SynthEngineParameters>& parameters, uint32_t oscCore, uint32_t oscCoreCount)
+	{
+		switch (scenario)
+		{
+			case kChord128:
+			{
+				// --- everything at once, alternating on and off every 16 blocks
+				if (block % 16 == 0)
+				{
+					bool noteOn = (block / 16) % 2 == 0;
+					uint32_t offset = blockSize / 2;
+					for (uint32_t note = 0; note < 128; note++)
+						processInfo.pushMidiEvent(midiEvent(noteOn ? NOTE_ON : NOTE_OFF, 0, note, noteOn ? 127 : 0, offset));
+				}
+				break;
+			}
+			case kStealCycle:
+			{
+				// --- 8 new notes per block, each released 3 blocks later; polyphony is always exhausted
+				for (uint32_t i = 0; i < 8; i++)
+				{
+					uint32_t offset = (i * blockSize) / 8;
+					uint32_t note = 24 + ((block * 8 + i) % 80);
+					processInfo.pushMidiEvent(midiEvent(NOTE_ON, 0, note, 100, offset));
+					if (block >= 3)
+					{
+						uint32_t oldNote = 24 + (((block - 3) * 8 + i) % 80);
+						processInfo.pushMidiEvent(midiEvent(NOTE_OFF, 0, oldNote, 0, offset));
+					}
+				}
+				break;
+			}
+			case kSustainFlood:
+			{
+				// --- pedal toggles every 4 samples; a note starts and one stops each block
+				//     (pushed in time order: the engine renders the queue in the order it is given)
+				uint32_t noteOffOffset = blockSize / 2;
+				processInfo.pushMidiEvent(midiEvent(NOTE_ON, 0, 36 + (block % 48), 100, 0));
+				for (uint32_t i = 0; i < blockSize; i += 4)
+				{
+					if (block >= 8 && i == noteOffOffset)
+						processInfo.pushMidiEvent(midiEvent(NOTE_OFF, 0, 36 + ((block - 8) % 48), 0, noteOffOffset));
+					processInfo.pushMidiEvent(midiEvent(CONTROL_CHANGE, 0, SUSTAIN_PEDAL, ((i / 4) % 2) ? 0 : 127, i));
+				}
+				break;
+			}
+			case kControllerStream:
+			{
+				// --- a held chord with controllers on every sample
+				if (block == 0)
+				{
+					for (uint32_t note = 48; note < 48 + MAX_VOICES; note++)
+						processInfo.pushMidiEvent(midiEvent(NOTE_ON, 0, note, 100, 0));
+				}
+				for (uint32_t i = 0; i < blockSize; i++)
+				{
+					uint32_t value = (block * blockSize + i) % 16384;
+					processInfo.pushMidiEvent(midiEvent(PITCH_BEND, 0, value & 0x7F, (value >> 7) & 0x7F, i));
+					processInfo.pushMidiEvent(midiEvent(CONTROL_CHANGE, 0, MOD_WHEEL, value & 0x7F, i));
+					processInfo.pushMidiEvent(midiEvent(CONTROL_CHANGE, 0, VOLUME_CC07, 64 + (value & 0x3F), i));
+				}
+				break;
+			}
+			case kPatchChange:
+			{
+				// --- held chord; cores change every 4 blocks
+				if (block == 0)
+				{
+					for (uint32_t note = 48; note < 48 + MAX_VOICES; note++)
+						processInfo.pushMidiEvent(midiEvent(NOTE_ON, 0, note, 100, 0));
+				}
+				if (block % 4 == 3)
+				{
+					uint32_t step = block / 4;
+					selectCores(parameters, (oscCore + step) % oscCoreCount, step);
+				}
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	/**
+	\brief
+	Runs one scenario on a freshly constructed engine and times every render( ) call
+
+	\return the worst and 99.9th percentile block times as percent of the block's real-time budget
+	*/
+	StressResult runScenario(StressScenario scenario, uint32_t oscCore, uint32_t oscCoreCount, const std::string& coreName,
+		uint32_t blockSize, double sampleRate, double seconds, const char* dllPath)
+	{
+		SynthEngine engine(ENGINE_BLOCK_SIZE);
+		engine.reset(sampleRate);
+		engine.initialize(dllPath);
+
+		SynthProcessInfo processInfo(0, 2, blockSize);
+		processInfo.BPM = 120.0;
+		processInfo.timeSigNumerator = 4.0;
+		processInfo.timeSigDenomintor = 4;
+
+		std::shared_ptr<SynthEngineParameters> parameters;
+		engine.getParameters(parameters);
+		parameters->synthModeIndex = enumToInt(SynthMode::kPoly);
+
+		// --- voices only switch to built cores; build every core the run selects, untimed
+		uint32_t setupSteps = scenario == kPatchChange ? std::max(oscCoreCount, (uint32_t)2) : 1;
+		for (uint32_t step = 0; step < setupSteps; step++)
+		{
+			selectCores(parameters, (oscCore + step) % oscCoreCount, step);
+			engine.setParameters(parameters);
+			engine.prepareModuleCores();
+
+			// --- installs them
+			processInfo.clearMidiEvents();
+			processInfo.setSamplesInBlock(blockSize);
+			engine.render(processInfo);
+		}
+		selectCores(parameters, oscCore, 0);
+		engine.setParameters(parameters);
+
+		uint32_t numBlocks = std::max((uint32_t)1, (uint32_t)(seconds * sampleRate / blockSize));
+		std::vector<double> blockTimes_uSec;
+		blockTimes_uSec.reserve(numBlocks);
+
+		for (uint32_t block = 0; block < numBlocks; block++)
+		{
+			processInfo.clearMidiEvents();
+			generateEvents(scenario, block, blockSize, processInfo, parameters, oscCore, oscCoreCount);
+			processInfo.setSamplesInBlock(blockSize);
+			processInfo.absoluteBufferTime_Sec = (double)block * blockSize / sampleRate;
+
+			// --- parameter changes are part of the block, same as a plugin's processing function
+			auto start = std::chrono::steady_clock::now();
+			if (scenario == kPatchChange)
+				engine.setParameters(parameters);
+			engine.render(processInfo);
+			auto end = std::chrono::steady_clock::now();
+
+			blockTimes_uSec.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+		}
+
+		std::sort(blockTimes_uSec.begin(), blockTimes_uSec.end());
+		size_t p999Index = (size_t)(0.999 * (blockTimes_uSec.size() - 1) + 0.5);
+		double budget_uSec = 1.0e6 * blockSize / sampleRate;
+
+		StressResult result;
+		result.scenario = scenarioNames[scenario];
+		result.core = coreName;
+		result.blockSize = blockSize;
+		result.worst_Percent = 100.0 * blockTimes_uSec.back() / budget_uSec;
+		result.p999_Percent = 100.0 * blockTimes_uSec[p999Index] / budget_uSec;
+		return result;
+	}
+
+	/**
+	\brief
+	Reads the thresholds file; later lines override earlier ones for the same run
+
+	\return false if the file could not be opened
+	*/
+	bool loadThresholds(const char* path, std::vector<StressThreshold>& thresholds)
+	{
+		std::ifstream file(path);
+		if (!file.is_open()) return false;
+
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (line.empty() || line[0] == '#') continue;
+
+			std::istringstream fields(line);
+			StressThreshold threshold;
+			if (fields >> threshold.scenario >> threshold.core >> threshold.blockSize >> threshold.worst_Percent >> threshold.p999_Percent)
+				thresholds.push_back(threshold);
+		}
+		return true;
+	}
+
+	/**
+	\brief
+	Writes the measured results as a thresholds file, with headroom
+
+	\return false if the file could not be written
+	*/
+	bool recordThresholds(const char* path, const std::vector<StressResult>& results, double headroom)
+	{
+		FILE* file = fopen(path, "w");
+		if (!file) return false;
+
+		fprintf(file, "# scenario core blockSize worst_%% p99.9_%%  (percent of the block's real-time budget)\n");
+		for (const StressResult& result : results)
+			fprintf(file, "%s %s %u %.1f %.1f\n", result.scenario.c_str(), result.core.c_str(), result.blockSize,
+				result.worst_Percent * headroom, result.p999_Percent * headroom);
+
+		fclose(file);
+		return true;
+	}
+
+	void usage()
+	{
+		printf("synthstress [options]\n"
+			"  --fs <Hz>             sample rate (48000)\n"
+			"  --seconds <sec>       audio rendered per run (2)\n"
+			"  --dll <path>          plugin folder, for PCM samples\n"
+			"  --thresholds <file>   fail (exit 1) if any run exceeds its threshold\n"
+			"  --record <file>       write the results as a thresholds file, with 50%% headroom\n"
+			"  --scenario <name>     run only one scenario\n");
+	}
+
+} // namespace SynthStress
+
+using namespace SynthStress;
+
+int main(int argc, char* argv[])
+{
+	double sampleRate = 48000.0;
+	double seconds = 2.0;
+	const char* dllPath = nullptr;
+	const char* thresholdsPath = nullptr;
+	const char* recordPath = nullptr;
+	const char* onlyScenario = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (!strcmp(argv[i], "--fs") && hasValue) sampleRate = atof(argv[++i]);
+		else if (!strcmp(argv[i], "--seconds") && hasValue) seconds = atof(argv[++i]);
+		else if (!strcmp(argv[i], "--dll") && hasValue) dllPath = argv[++i];
+		else if (!strcmp(argv[i], "--thresholds") && hasValue) thresholdsPath = argv[++i];
+		else if (!strcmp(argv[i], "--record") && hasValue) recordPath = argv[++i];
+		else if (!strcmp(argv[i], "--scenario") && hasValue) onlyScenario = argv[++i];
+		else { usage(); return 2; }
+	}
+
+	std::vector<StressThreshold> thresholds;
+	if (thresholdsPath && !loadThresholds(thresholdsPath, thresholds))
+	{
+		printf("cannot read thresholds file %s\n", thresholdsPath);
+		return 2;
+	}
+
+	// --- the oscillator cores of this build
+	std::vector<std::string> oscCoreNames;
+	{
+		SynthEngine probe(ENGINE_BLOCK_SIZE);
+#if defined SYNTHLAB_WT
+		oscCoreNames = probe.getModuleCoreNames(WTO_MODULE);
+#elif defined SYNTHLAB_VA
+		oscCoreNames = probe.getModuleCoreNames(VAO_MODULE);
+#elif defined SYNTHLAB_PCM
+		oscCoreNames = probe.getModuleCoreNames(PCMO_MODULE);
+#elif defined SYNTHLAB_KS
+		oscCoreNames = probe.getModuleCoreNames(KSO_MODULE);
+#elif defined SYNTHLAB_DX
+		oscCoreNames = probe.getModuleCoreNames(FMO_MODULE);
+#endif
+	}
+	if (oscCoreNames.empty())
+		oscCoreNames.push_back("default");
+
+	// --- no spaces in the report columns
+	for (std::string& name : oscCoreNames)
+		std::replace(name.begin(), name.end(), ' ', '_');
+
+	std::vector<StressResult> results;
+	uint32_t failures = 0;
+
+	printf("%-18s %-16s %6s %10s %10s\n", "scenario", "core", "block", "worst_%", "p99.9_%");
+	for (uint32_t scenario = 0; scenario < kNumStressScenarios; scenario++)
+	{
+		if (onlyScenario && strcmp(onlyScenario, scenarioNames[scenario]) != 0)
+			continue;
+
+		for (uint32_t core = 0; core < oscCoreNames.size(); core++)
+		{
+			for (uint32_t blockSize : hostBlockSizes)
+			{
+				StressResult result = runScenario((StressScenario)scenario, core, (uint32_t)oscCoreNames.size(), oscCoreNames[core],
+					blockSize, sampleRate, seconds, dllPath);
+				results.push_back(result);
+
+				// --- last matching threshold wins
+				const StressThreshold* threshold = nullptr;
+				for (const StressThreshold& t : thresholds)
+				{
+					if (t.matches(result))
+						threshold = &t;
+				}
+
+				bool failed = threshold && (result.worst_Percent > threshold->worst_Percent || result.p999_Percent > threshold->p999_Percent);
+				if (failed)
+					failures++;
+
+				printf("%-18s %-16s %6u %10.1f %10.1f%s\n", result.scenario.c_str(), result.core.c_str(), result.blockSize,
+					result.worst_Percent, result.p999_Percent, failed ? "  FAIL" : "");
+			}
+		}
+	}
+
+	if (recordPath && !recordThresholds(recordPath, results, 1.5))
+	{
+		printf("cannot write thresholds file %s\n", recordPath);
+		return 2;
+	}
+
+	if (failures > 0)
+	{
+		printf("%u run(s) exceeded their thresholds\n", failures);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,464 @@
+#include "additivecore.h"
+#include "synthkernels.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   additivecore.cpp
+\author Will Pirkle
+\brief  See also Designing Software Synthesizers in C++ 2nd Ed. by Will Pirkle
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Construction: Cores follow the same construction pattern
+	- set the Module type and name parameters
+	- expose the 16 module strings
+	- expose the 4 mod knob label strings
+	- intialize any internal variables
+
+	Core Specific:
+	- the additive core for the VA oscillator
+
+	\returns the newly constructed object
+	*/
+	AdditiveCore::AdditiveCore()
+	{
+		moduleType = VAO_MODULE;
+		moduleName = "Additive";
+		preferredIndex = 1; // ordering for user
+
+		/*
+			Module Strings, zero-indexed for your GUI Control:
+			- sawtooth, square, triangle
+		*/
+		coreData.moduleStrings[0] = "sawtooth";		coreData.moduleStrings[8] =  empty_string.c_str();
+		coreData.moduleStrings[1] = "square";		coreData.moduleStrings[9] =  empty_string.c_str();
+		coreData.moduleStrings[2] = "triangle";		coreData.moduleStrings[10] = empty_string.c_str();
+		coreData.moduleStrings[3] = empty_string.c_str();	coreData.moduleStrings[11] = empty_string.c_str();
+		coreData.moduleStrings[4] = empty_string.c_str();	coreData.moduleStrings[12] = empty_string.c_str();
+		coreData.moduleStrings[5] = empty_string.c_str();	coreData.moduleStrings[13] = empty_string.c_str();
+		coreData.moduleStrings[6] = empty_string.c_str();	coreData.moduleStrings[14] = empty_string.c_str();
+		coreData.moduleStrings[7] = empty_string.c_str();	coreData.moduleStrings[15] = empty_string.c_str();
+
+		// --- modulation control knobs
+		coreData.modKnobStrings[MOD_KNOB_A]	= "Bright";
+		coreData.modKnobStrings[MOD_KNOB_B] = "Decay";
+		coreData.modKnobStrings[MOD_KNOB_C]	= "Stretch";
+		coreData.modKnobStrings[MOD_KNOB_D] = "Partials";
+
+		setWaveform(0);
+		resetRotators(0.0);
+	}
+
+	/**
+	\brief Resets object to initialized state
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- forces the increments, levels and decay factors to be recalculated on the next update
+
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool AdditiveCore::reset(CoreProcData& processInfo)
+	{
+		// --- parameters
+		VAOscParameters* parameters = static_cast<VAOscParameters*>(processInfo.moduleParameters);
+
+		sampleRate = processInfo.sampleRate;
+
+		setWaveform(parameters->waveIndex);
+		resetRotators(0.0);
+		currentFrequency = 0.0;
+		decayDirty = true;
+
+		// --- silent until the first update( )
+		for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+		{
+			envelope[i] = 1.0;
+			amplitude[i] = 0.0;
+		}
+		audiblePartials = 0;
+		activePartials = 0;
+
+		return true;
+	}
+
+	/**
+	\brief Sets up the partial slots for a waveform
+	- the levels are the Fourier series of the bandlimited waveform, normalized to +/-1
+	- signs are in the levels, so every rotator starts at sine phase 0
+
+	\param waveIndex index of the waveform in the module strings
+	*/
+	void AdditiveCore::setWaveform(uint32_t waveIndex)
+	{
+		waveform = waveIndex > 2 ? 0 : waveIndex;
+
+		// --- sawtooth: all harmonics, 1/n; square and triangle: odd harmonics, 1/n and 1/n^2
+		firstHarmonic = 1.0;
+		harmonicStep = waveform == 0 ? 1.0 : 2.0;
+
+		for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+		{
+			double n = firstHarmonic + i * harmonicStep;
+			harmonic[i] = n;
+
+			if (waveform == 0)
+				waveLevel[i] = ((i & 1) ? -2.0 : 2.0) / (kPi * n);
+			else if (waveform == 1)
+				waveLevel[i] = 4.0 / (kPi * n);
+			else
+				waveLevel[i] = ((i & 1) ? -8.0 : 8.0) / (kPi * kPi * n * n);
+		}
+
+		levelsDirty = true;
+		currentFrequency = 0.0;
+	}
+
+	/**
+	\brief Sets the rotators to a start phase
+	- phase 0 is (1, 0) for every partial, which is the common case
+	- other phases use the same complex recursion as the increments
+
+	\param startPhase start phase of the fundamental, in cycles
+	*/
+	void AdditiveCore::resetRotators(double startPhase)
+	{
+		if (startPhase == 0.0)
+		{
+			for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+			{
+				rotatorRe[i] = 1.0;
+				rotatorIm[i] = 0.0;
+			}
+			return;
+		}
+
+		// --- harmonic phases; stretched partials start as if they were harmonic
+		double re = cos(kTwoPi * firstHarmonic * startPhase);
+		double im = sin(kTwoPi * firstHarmonic * startPhase);
+		double stepRe = cos(kTwoPi * harmonicStep * startPhase);
+		double stepIm = sin(kTwoPi * harmonicStep * startPhase);
+		for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+		{
+			rotatorRe[i] = re;
+			rotatorIm[i] = im;
+			double nextRe = re * stepRe - im * stepIm;
+			im = re * stepIm + im * stepRe;
+			re = nextRe;
+		}
+	}
+
+	/**
+	\brief Calculates the frequency ratios and the rotator increments
+	- harmonic partials: one sin/cos pair for the fundamental and one for the step, then
+	a complex recursion across the partials
+	- stretched partials: ratio = n * sqrt(1 + B*n^2), one sin/cos pair per partial
+	- only partials below ADD_OSC_MAX_PARTIAL_FS * fs get new increments; partials that are
+	still fading out above the limit keep their old ones, so they never alias
+
+	\param oscillatorFrequency the modulated fundamental frequency
+	\param stretch the inharmonicity coefficient B
+	*/
+	void AdditiveCore::calculateIncrements(double oscillatorFrequency, double stretch)
+	{
+		currentFrequency = oscillatorFrequency;
+		currentStretch = stretch;
+
+		// --- ratios are sorted, so the audible partials are a prefix
+		double maxRatio = (ADD_OSC_MAX_PARTIAL_FS * sampleRate) / oscillatorFrequency;
+		uint32_t count = 0;
+		for (; count < partialCount; count++)
+		{
+			double n = harmonic[count];
+			ratio[count] = stretch > 0.0 ? n * sqrt(1.0 + stretch * n * n) : n;
+			if (ratio[count] >= maxRatio)
+				break;
+		}
+		audiblePartials = count;
+
+		double w = (kTwoPi * oscillatorFrequency) / sampleRate;
+		if (stretch > 0.0)
+		{
+			for (uint32_t i = 0; i < audiblePartials; i++)
+			{
+				cosIncrement[i] = cos(w * ratio[i]);
+				sinIncrement[i] = sin(w * ratio[i]);
+			}
+			return;
+		}
+
+		// --- harmonic: z(i) = z(0) * step^i
+		double re = cos(w * firstHarmonic);
+		double im = sin(w * firstHarmonic);
+		double stepRe = cos(w * harmonicStep);
+		double stepIm = sin(w * harmonicStep);
+		for (uint32_t i = 0; i < audiblePartials; i++)
+		{
+			cosIncrement[i] = re;
+			sinIncrement[i] = im;
+			double nextRe = re * stepRe - im * stepIm;
+			im = re * stepIm + im * stepRe;
+			re = nextRe;
+		}
+	}
+
+	/**
+	\brief Updates the object for the next block of audio processing
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- modulator inputs are accessied via processInfo.modulationInputs
+	- mod knob values are accessed via parameters->modKnobValue[]
+	Core Specific:
+	- calculates the pitch modulation value from GUI controls, input modulator kBipolarMod,
+	and MIDI pitch bend
+	- recalculates the increments only if the pitch, stretch, waveform or partial count changed
+	- calculates final gain and pan values
+
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool AdditiveCore::update(CoreProcData& processInfo)
+	{
+		// --- parameters
+		VAOscParameters* parameters = static_cast<VAOscParameters*>(processInfo.moduleParameters);
+
+		// --- get the pitch bend value in semitones
+		double midiPitchBend = calculatePitchBend(processInfo.midiInputData);
+
+		// --- get the master tuning multiplier in semitones
+		double masterTuning = calculateMasterTuning(processInfo.midiInputData);
+
+		// --- calculate combined tuning offsets by simply adding values in semitones
+		double freqMod = processInfo.modulationInputs->getModValue(kBipolarMod) * kOscBipolarModRangeSemitones;
+
+		// --- do the portamento
+		double glideMod = glideModulator->getNextModulationValue();
+
+		// --- calculate combined tuning offsets by simply adding values in semitones
+		double currentPitchModSemitones = glideMod +
+			freqMod +
+			midiPitchBend +
+			masterTuning +
+			(parameters->octaveDetune * 12) +	/* octaves =  semitones*12 */
+			(parameters->coarseDetune) +		/* semitones */
+			(parameters->fineDetune / 100.0) +	/* cents/100 = semitones */
+			(processInfo.unisonDetuneCents / 100.0);	/* cents/100 = semitones */
+
+		// --- direct calculation version 2^(n/12) - note that this is equal temperatment
+		double pitchShift = pow(2.0, currentPitchModSemitones / 12.0);
+
+		// --- calculate the moduated pitch value
+		double oscillatorFrequency = midiPitch*pitchShift;
+
+		// --- BOUND the value to our range
+		boundValue(oscillatorFrequency, VA_OSC_MIN, VA_OSC_MAX);
+
+		// --- waveform and partial count
+		if (parameters->waveIndex != waveform && parameters->waveIndex <= 2)
+			setWaveform(parameters->waveIndex);
+
+		uint32_t count = (uint32_t)(getModKnobValueLinear(parameters->modKnobValue[MOD_KNOB_D], ADD_OSC_MIN_PARTIALS, ADD_OSC_MAX_PARTIALS) + 0.5);
+		if (count != partialCount)
+		{
+			partialCount = count;
+			currentFrequency = 0.0;
+		}
+
+		// --- increments, only when something changed
+		double stretch = getModKnobValueLinear(parameters->modKnobValue[MOD_KNOB_C], 0.0, ADD_OSC_MAX_STRETCH);
+		if (stretch != currentStretch)
+			decayDirty = true;
+		if (oscillatorFrequency != currentFrequency || stretch != currentStretch)
+			calculateIncrements(oscillatorFrequency, stretch);
+
+		// --- tilt in dB/octave -> exponent of the harmonic number: 20*log10(2) = 6.0206 dB/octave
+		double tilt = getModKnobValueLinear(parameters->modKnobValue[MOD_KNOB_A], -6.0, 6.0) / 6.0206;
+		if (tilt != tiltExponent)
+		{
+			tiltExponent = tilt;
+			levelsDirty = true;
+		}
+
+		// --- decay: 10 sec -> 0.1 sec for the fundamental, 0 = sustain
+		double decay = parameters->modKnobValue[MOD_KNOB_B] > 0.0 ? pow(10.0, 1.0 - 2.0 * parameters->modKnobValue[MOD_KNOB_B]) : 0.0;
+		if (decay != decayTime)
+		{
+			decayTime = decay;
+			decayDirty = true;
+		}
+
+		// --- scale from dB
+		outputAmplitude = dB2Raw(parameters->outputAmplitude_dB);
+
+		// --- pan
+		double panTotal = parameters->panValue;
+		boundValueBipolar(panTotal);
+
+		// --- equal power calculation in synthfunction.h
+		calculatePanValues(panTotal, panLeftGain, panRightGain);
+
+		return true;
+	}
+
+	/**
+	\brief Renders the output of the module
+	- renders to output buffer using pointers in the CoreProcData argument
+	Core Specific:
+	- control rate: envelopes, targets, culling and renormalization for this block
+	- audio rate: the rotator bank kernel renders the mono sum into the left buffer
+	- gain and pan are applied into both channels
+
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool AdditiveCore::render(CoreProcData& processInfo)
+	{
+		float* leftOutBuffer = processInfo.outputBuffers[LEFT_CHANNEL];
+		float* rightOutBuffer = processInfo.outputBuffers[RIGHT_CHANNEL];
+		uint32_t samples = processInfo.samplesToProcess;
+		if (samples == 0)
+			return true;
+
+		// --- cached levels and decay factors
+		if (levelsDirty)
+		{
+			for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+				level[i] = tiltExponent == 0.0 ? waveLevel[i] : waveLevel[i] * pow(harmonic[i], tiltExponent);
+			levelsDirty = false;
+		}
+
+		if (decayDirty || samples != decayBlockSize)
+		{
+			// --- higher partials decay faster: tau(n) = tau / sqrt(ratio(n))
+			double blockTime = samples / sampleRate;
+			for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+			{
+				double partialRatio = currentStretch > 0.0 ? harmonic[i] * sqrt(1.0 + currentStretch * harmonic[i] * harmonic[i]) : harmonic[i];
+				decayFactor[i] = decayTime > 0.0 ? exp(-blockTime * sqrt(partialRatio) / decayTime) : 1.0;
+			}
+			decayBlockSize = samples;
+			decayDirty = false;
+		}
+
+		// --- per-partial envelopes; all of them, so a partial that comes back in range
+		//     (e.g. the pitch falls) has decayed like the others
+		if (decayTime > 0.0)
+		{
+			for (uint32_t i = 0; i < partialCount; i++)
+				envelope[i] *= decayFactor[i];
+		}
+
+		// --- targets for the end of the block; inaudible and out of range partials fade to zero
+		uint32_t scanCount = audiblePartials > activePartials ? audiblePartials : activePartials;
+		uint32_t renderCount = 0;
+		for (uint32_t i = 0; i < scanCount; i++)
+		{
+			double target = 0.0;
+			if (i < audiblePartials)
+			{
+				target = level[i] * envelope[i];
+				if (fabs(target) < ADD_OSC_MIN_AUDIBLE)
+					target = 0.0;
+			}
+
+			targetAmplitude[i] = target;
+			if (target != 0.0 || amplitude[i] != 0.0)
+				renderCount = i + 1;
+		}
+
+		// --- ramps, and one Newton step of 1/sqrt(|z|^2) to hold the rotators on the unit circle
+		double rampScale = 1.0 / samples;
+		for (uint32_t i = 0; i < renderCount; i++)
+		{
+			amplitudeIncrement[i] = (targetAmplitude[i] - amplitude[i]) * rampScale;
+
+			double gain = 1.5 - 0.5 * (rotatorRe[i] * rotatorRe[i] + rotatorIm[i] * rotatorIm[i]);
+			rotatorRe[i] *= gain;
+			rotatorIm[i] *= gain;
+		}
+
+		// --- the bank
+		if (renderCount > 0)
+			getSynthKernels().rotatorBank(leftOutBuffer, samples, rotatorRe, rotatorIm, cosIncrement, sinIncrement, amplitude, amplitudeIncrement, renderCount);
+		else
+			memset(leftOutBuffer, 0, samples * sizeof(float));
+
+		// --- land exactly on the targets; the ramps accumulate rounding
+		for (uint32_t i = 0; i < renderCount; i++)
+			amplitude[i] = targetAmplitude[i];
+		activePartials = renderCount;
+
+		// --- scale and pan
+		float leftGain = (float)(outputAmplitude * panLeftGain);
+		float rightGain = (float)(outputAmplitude * panRightGain);
+		for (uint32_t i = 0; i < samples; i++)
+		{
+			float oscOutput = leftOutBuffer[i];
+			leftOutBuffer[i] = oscOutput * leftGain;
+			rightOutBuffer[i] = oscOutput * rightGain;
+		}
+
+		// --- advance the glide modulator
+		glideModulator->advanceClock(samples);
+
+		// --- rendered
+		return true;
+	}
+
+	/**
+	\brief Note-on handler for the ModuleCore
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- MIDI note information is accessed via processInfo.noteEvent
+
+	Core Specific:
+	- saves MIDI pitch for modulation calculation in update() function
+	- restarts the rotators and envelopes; the partials ramp up from zero over the first block
+
+	\param processInfo is the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool AdditiveCore::doNoteOn(CoreProcData& processInfo)
+	{
+		// --- parameters
+		midiPitch = processInfo.noteEvent.midiPitch;
+
+		// --- reset to new start phase
+		resetRotators(processInfo.unisonStartPhase > 0.0 ? processInfo.unisonStartPhase / 360.0 : 0.0);
+
+		for (uint32_t i = 0; i < ADD_OSC_MAX_PARTIALS; i++)
+		{
+			envelope[i] = 1.0;
+			amplitude[i] = 0.0;
+		}
+		activePartials = 0;
+
+		return true;
+	}
+
+	/**
+	\brief Note-off handler for the ModuleCore
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- MIDI note information is accessed via processInfo.noteEvent
+
+	Core Specific:
+	- nothing to do; the amp EG shapes the release
+
+	\param processInfo is the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool AdditiveCore::doNoteOff(CoreProcData& processInfo)
+	{
+		return true;
+	}
+
+} // namespace
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "synthbase.h"
+#include "synthfunctions.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   additivecore.h
+\author Will Pirkle
+\brief  See also Designing Software Synthesizers in C++ 2nd Ed. by Will Pirkle
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Constants for the additive oscillator core
+	*/
+	const uint32_t ADD_OSC_MIN_PARTIALS = 64;		///< partial count with the Partials knob at 0
+	const uint32_t ADD_OSC_MAX_PARTIALS = 512;		///< partial count with the Partials knob at 1
+	const double ADD_OSC_MAX_PARTIAL_FS = 0.45;		///< partials at or above this fraction of fs are culled (Nyquist = 0.5)
+	const double ADD_OSC_MIN_AUDIBLE = 1.0e-5;		///< partials below -100dB are culled
+	const double ADD_OSC_MAX_STRETCH = 1.0e-3;		///< inharmonicity coefficient with the Stretch knob at 1
+	//@}
+
+	/**
+	\class AdditiveCore
+	\ingroup ModuleCores
+	\brief
+	Additive oscillator with up to 512 partials
+
+	Each partial is a recursive sine oscillator: a complex rotator (re, im) that is turned by
+	(cos w, sin w) every sample, so a partial costs two multiply-adds per sample and no
+	trig or table lookups. The rotator bank is rendered with the bound rotatorBank kernel
+	(see synthkernels.h) so the partials run in SIMD lanes.
+
+	Control rate (once per block, in update( ) and render( )):
+	- rotator increments are recalculated only when the pitch changes; harmonic partials
+	use a complex recursion from the fundamental, stretched partials use sin/cos
+	- the rotators are renormalized (one Newton step) to cancel the slow amplitude drift of
+	the recursion
+	- each partial has its own amplitude envelope: a level from the waveform spectrum and
+	brightness tilt, times an exponential decay that is faster for higher partials; the
+	tilted levels and the per-block decay factors are cached and only recalculated when
+	their knobs change
+	- partial amplitudes ramp linearly across the block to the new targets, so there is no
+	zipper noise from the control rate
+	- partials at or above ADD_OSC_MAX_PARTIAL_FS * fs and partials below ADD_OSC_MIN_AUDIBLE are
+	culled: the bank only renders up to the last partial that is audible (fading partials
+	finish their ramp to zero first)
+
+	Base Class: ModuleCore
+	- Overrides the five (5) common functions plus a special getParameters() method to
+	return a shared pointer to the parameters structure.
+	- NOTE: These functions have identical names as the SynthModules that own them,
+	however the arguments are different. ModuleCores use the CoreProcData structure
+	for passing arguments into the cores because they are thunk-barrier compliant.
+	- This means that the owning SynthModule must prepare this structure and populate it prior to
+	function calls. The large majority of this preparation is done in the SynthModule constructor
+	and is one-time in nature.
+
+	GUI Parameters: VAOscParameters
+	- GUI parameters are delivered into the core via the thunk-barrier compliant CoreProcData
+	argument that is passed into each function identically
+	- processInfo.moduleParameters contains a void* version of the GUI parameter structure pointer
+	- the Core function casts the GUI parameter pointer prior to usage
+
+	Access to Modulators is done via the thunk-barrier compliant CoreProcData argument
+	- processInfo.modulationInputs
+	- processInfo.modulationOutputs
+
+	Access to audio buffers (I/O/FM) is done via the thunk-barrier compliant CoreProcData argument
+	- processInfo.inputBuffers
+	- processInfo.outputBuffers
+	- processInfo.fmBuffers
+
+	Construction: Cores follow the same construction pattern
+	- set the Module type and name parameters
+	- expose the 16 module strings
+	- expose the 4 mod knob label strings
+	- intialize any internal variables
+
+	Standalone Mode:
+	- These objects are designed to be internal members of the outer SynthModule that owns them.
+	They may be used in standalone mode without modification, and you will use the CoreProcData
+	structure to pass information into the functions.
+
+	Module Strings, zero-indexed for your GUI Control:
+	- sawtooth, square, triangle
+
+	ModKnob Strings, for fixed GUI controls by index constant
+	- MOD_KNOB_A = "Bright" spectral tilt, -6dB/octave -> +6dB/octave; center is the pure waveform
+	- MOD_KNOB_B = "Decay" per-partial decay; 0 = sustain
+	- MOD_KNOB_C = "Stretch" inharmonicity (piano-like stretched partials)
+	- MOD_KNOB_D = "Partials" 64 -> 512 partials
+
+	Render:
+	- renders into the output buffer using pointers in the CoreProcData argument to the render function
+	- renders one block of audio per render cycle
+	- renders in mono that is copied to the right channel as dual-mono stereo
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class AdditiveCore : public MemoryAccounted<AdditiveCore, ModuleCore>
+	{
+	public:
+		/** simple default constructor */
+		AdditiveCore();				/* C-TOR */
+
+		/** Destructor is empty: all resources are smart pointers */
+		virtual ~AdditiveCore() {}		/* D-TOR */
+
+		/** ModuleCore Overrides */
+		virtual bool reset(CoreProcData& processInfo) override;
+		virtual bool update(CoreProcData& processInfo) override;
+		virtual bool render(CoreProcData& processInfo) override;
+		virtual bool doNoteOn(CoreProcData& processInfo) override;
+		virtual bool doNoteOff(CoreProcData& processInfo) override;
+
+		/** partials rendered in the last block, after culling */
+		uint32_t getActivePartials() { return activePartials; }
+
+	protected:
+		/** spectrum of the waveform: harmonic numbers and levels of the partial slots */
+		void setWaveform(uint32_t waveIndex);
+
+		/** frequency ratios and rotator increments for a new pitch or stretch */
+		void calculateIncrements(double oscillatorFrequency, double stretch);
+
+		/** rotators to their note-on phase */
+		void resetRotators(double startPhase);
+
+		// --- basic variables
+		double sampleRate = 0.0;		///< sample rate
+		double midiPitch = 0.0;			///< the midi pitch
+		double outputAmplitude = 1.0;	///< amplitude in dB
+		double panLeftGain = 0.707;		///< left channel gain
+		double panRightGain = 0.707;	///< right channel gain
+
+		// --- control rate state
+		uint32_t waveform = 0;				///< waveform of the partial spectrum
+		double firstHarmonic = 1.0;			///< harmonic number of partial 0
+		double harmonicStep = 1.0;			///< harmonic number step between partials (2 = odd only)
+		uint32_t partialCount = ADD_OSC_MIN_PARTIALS;	///< from the Partials knob
+		uint32_t audiblePartials = 0;		///< below the frequency limit
+		uint32_t activePartials = 0;		///< rendered: up to the last partial with a non-zero amplitude
+		double currentFrequency = 0.0;		///< increments are valid for this fundamental
+		double currentStretch = 0.0;		///< and this inharmonicity
+		double tiltExponent = 0.0;			///< level *= harmonic^tiltExponent
+		double decayTime = 0.0;				///< fundamental decay time constant in seconds; 0 = sustain
+		bool levelsDirty = true;			///< levels need recalculating
+		bool decayDirty = true;				///< decay factors need recalculating
+		uint32_t decayBlockSize = 0;		///< decay factors are valid for this block size
+
+		// --- per partial, structure-of-arrays for the rotator bank kernel
+		double harmonic[ADD_OSC_MAX_PARTIALS] = { 0.0 };		///< harmonic number
+		double waveLevel[ADD_OSC_MAX_PARTIALS] = { 0.0 };		///< waveform spectrum, signed
+		double level[ADD_OSC_MAX_PARTIALS] = { 0.0 };			///< waveform spectrum with tilt
+		double ratio[ADD_OSC_MAX_PARTIALS] = { 0.0 };			///< frequency / fundamental, with stretch
+		double envelope[ADD_OSC_MAX_PARTIALS] = { 0.0 };		///< decay envelope
+		double decayFactor[ADD_OSC_MAX_PARTIALS] = { 0.0 };	///< envelope multiplier per block
+		double rotatorRe[ADD_OSC_MAX_PARTIALS] = { 0.0 };		///< rotator real part (cosine)
+		double rotatorIm[ADD_OSC_MAX_PARTIALS] = { 0.0 };		///< rotator imaginary part (sine), the output
+		double cosIncrement[ADD_OSC_MAX_PARTIALS] = { 0.0 };	///< cos(w) per sample
+		double sinIncrement[ADD_OSC_MAX_PARTIALS] = { 0.0 };	///< sin(w) per sample
+		double amplitude[ADD_OSC_MAX_PARTIALS] = { 0.0 };		///< ramped across the block
+		double amplitudeIncrement[ADD_OSC_MAX_PARTIALS] = { 0.0 };	///< per sample
+		double targetAmplitude[ADD_OSC_MAX_PARTIALS] = { 0.0 };	///< at the end of the block
+	};
+
+} // namespace
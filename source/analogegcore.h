@@ -81,7 +81,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class AnalogEGCore : public ModuleCore
+	class AnalogEGCore : public MemoryAccounted<AnalogEGCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -26,7 +26,7 @@ namespace SynthLab
 	AudioDelay::AudioDelay(std::shared_ptr<MidiInputData> _midiInputData, 
 		std::shared_ptr<AudioDelayParameters> _parameters, 
 		uint32_t blockSize) :
-		SynthModule(_midiInputData)
+		MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -37,6 +37,19 @@ namespace SynthLab
 		audioBuffers.reset(new SynthProcessInfo(DELAY_AUDIO_INPUTS, DELAY_AUDIO_OUTPUTS, blockSize));
 	}
 
+	/**
+	\brief Memory accounting: adds the delay buffers to the module's report
+
+	\param report the node for this module
+	*/
+	void AudioDelay::getMemoryReport(MemoryReport& report)
+	{
+		SynthModule::getMemoryReport(report);
+		uint64_t bytes = delayBuffer_L.getAllocatedBytes() + delayBuffer_R.getAllocatedBytes();
+		report.ownedBytes += bytes;
+		report.residentBytes += estimateResidentBytes(bytes);
+	}
+
 	/**
 	\brief Resets object to initialized state
 	- call once during initialization
@@ -98,8 +111,6 @@ namespace SynthLab
 	*/
 	bool AudioDelay::render(uint32_t samplesToProcess)
 	{
-		update();
-
 		// --- stereo I/O
 		float* leftInBuffer = getAudioBuffers()->getInputBuffer(LEFT_CHANNEL);
 		float* leftOutBuffer = getAudioBuffers()->getOutputBuffer(LEFT_CHANNEL);
@@ -107,6 +118,23 @@ namespace SynthLab
 		float* rightInBuffer = getAudioBuffers()->getInputBuffer(RIGHT_CHANNEL);
 		float* rightOutBuffer = getAudioBuffers()->getOutputBuffer(RIGHT_CHANNEL);
 
+		// --- silent input and everything in the delay lines has been read out below threshold:
+		//     the tail is empty, so skip
+		bool inputSilent = audioBuffers->allInputsSilent();
+		if (!inputSilent)
+			silentTailSamples = 0;
+		else if (silentTailSamples > fmax(delayInSamples_L, delayInSamples_R))
+		{
+			memset(leftOutBuffer, 0, samplesToProcess * sizeof(float));
+			memset(rightOutBuffer, 0, samplesToProcess * sizeof(float));
+			audioBuffers->setOutputSilenceFlags(ALL_CHANNELS_SILENT);
+			return true;
+		}
+		audioBuffers->setOutputSilenceFlags(0);
+
+		update();
+		double tailPeak = 0.0;
+
 		for (uint32_t i = 0; i <samplesToProcess; i++)
 		{
 			// --- inputs
@@ -116,6 +144,7 @@ namespace SynthLab
 			// --- read delays
 			double ynL = delayBuffer_L.readBuffer(delayInSamples_L);
 			double ynR = delayBuffer_R.readBuffer(delayInSamples_R);
+			tailPeak = fmax(tailPeak, fmax(fabs(ynL), fabs(ynR)));
 
 			// --- create input for delay buffer with LEFT channel info
 			double dnL = xnL + (parameters->feedback_Pct / 100.0) * ynL;
@@ -143,6 +172,10 @@ namespace SynthLab
 			rightOutBuffer[i] = outputR;
 		}
 
+		// --- count toward an empty tail
+		if (inputSilent)
+			silentTailSamples = tailPeak < kSilenceThreshold ? silentTailSamples + samplesToProcess : 0;
+
 		return true;
 	}
 
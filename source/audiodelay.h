@@ -98,7 +98,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class AudioDelay : public SynthModule
+	class AudioDelay : public MemoryAccounted<AudioDelay, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -106,6 +106,7 @@ namespace SynthLab
 			std::shared_ptr<AudioDelayParameters> _parameters,
 			uint32_t blockSize = 64);
 		virtual ~AudioDelay() {}
+		virtual void getMemoryReport(MemoryReport& report) override;
 
 		/** SynthModule Overrides */
 		virtual bool reset(double _sampleRate) override;
@@ -137,6 +138,9 @@ namespace SynthLab
 		// --- delay buffer of doubles
 		CircularBuffer<double> delayBuffer_L;	///< LEFT delay buffer of doubles
 		CircularBuffer<double> delayBuffer_R;	///< RIGHT delay buffer of doubles
+
+		// --- silence tracking
+		uint32_t silentTailSamples = 0;	///< samples of silent input with delayed output below kSilenceThreshold
 	};
 
 } // namespace
@@ -17,6 +17,7 @@ namespace SynthLab
 	\brief
 	Construction:
 	- creates new Hann window table
+	- fills the per-note pitch and velocity tables
 	- you can add more here
 
      */
@@ -27,6 +28,25 @@ namespace SynthLab
 		{
 			hannTable->table[n] = (0.5 * (1.0 - cos((n*2.0*kPi) / (double)(DEFAULT_LUT_LENGTH - 1))));
 		}
+
+		for (uint32_t n = 0; n < NUM_MIDI_NOTES; n++)
+		{
+			notePitches[n] = midiNoteNumberToOscFrequency(n);
+			velocityGains[n] = mmaMIDItoAtten(n);
+		}
+	}
+
+	/**
+	\brief
+	The shared instance; the function-local static is constructed once, thread-safe, on the
+	first call so call this from a constructor and keep the pointer
+
+	\returns the process-global tables
+	*/
+	const BasicLookupTables& BasicLookupTables::getSharedTables()
+	{
+		static const BasicLookupTables sharedTables;
+		return sharedTables;
 	}
 
 	/**
@@ -38,7 +58,7 @@ namespace SynthLab
 
 	\returns the newly constructed object
 	*/
-	double BasicLookupTables::readTableByTablePointer(double* table, double index)
+	double BasicLookupTables::readTableByTablePointer(const double* table, double index) const
 	{
 		// --- get the read location
 		double dIntPart = 0.0;
@@ -58,10 +78,10 @@ namespace SynthLab
 
 	\returns the newly constructed object
 	*/
-	double BasicLookupTables::readTableByTableIndex(uint32_t tableIndex, double index)
+	double BasicLookupTables::readTableByTableIndex(uint32_t tableIndex, double index) const
 	{
 		if (index >= DEFAULT_LUT_LENGTH) return 0.0;
-		double* table = nullptr;
+		const double* table = nullptr;
 		switch (tableIndex)
 		{
 		case HANN_LUT:
@@ -24,6 +24,10 @@ namespace SynthLab
 	\brief
 	Very basic lookup table object
 	- holds a smart pointer to a single LookupTable structure, Hann Window
+	- holds the per-note tables used at note-on: the pitch of each MIDI note and the
+	MMA gain of each velocity, so that note-on does not calculate them
+	- the tables never change after construction so one process-global instance is shared
+	by all owners; see getSharedTables( )
 	- you can add more tables and access functions as you like
 	- provides multiple functions to access the lookup table with different
 	lookup index types
@@ -39,15 +43,31 @@ namespace SynthLab
 	public:
 		BasicLookupTables(); 
 		~BasicLookupTables() {}
-		double readTableByTablePointer(double* table, double index); 
-		double readTableByTableIndex(uint32_t tableIndex, double index);
-		inline double readTableByTableIndexNormalized(uint32_t table, double normalizedIndex) { return readTableByTableIndex(table, normalizedIndex*DEFAULT_LUT_LENGTH); } ///< read a table with enumerated table index
-		inline double readHannTableWithNormIndex(double normalizedIndex) { return readTableByTablePointer(hannTable->table, normalizedIndex*DEFAULT_LUT_LENGTH); }///< read Hann table
-		inline double readSineTableWithNormIndex(double normalizedIndex) { return readTableByTablePointer(&sin_1024[0], normalizedIndex*DEFAULT_LUT_LENGTH); }///<read sine table
+
+		/** the process-global, read-only instance; built on the first call (not real-time safe) */
+		static const BasicLookupTables& getSharedTables();
+
+		double readTableByTablePointer(const double* table, double index) const;
+		double readTableByTableIndex(uint32_t tableIndex, double index) const;
+		inline double readTableByTableIndexNormalized(uint32_t table, double normalizedIndex) const { return readTableByTableIndex(table, normalizedIndex*DEFAULT_LUT_LENGTH); } ///< read a table with enumerated table index
+		inline double readHannTableWithNormIndex(double normalizedIndex) const { return readTableByTablePointer(hannTable->table, normalizedIndex*DEFAULT_LUT_LENGTH); }///< read Hann table
+		inline double readSineTableWithNormIndex(double normalizedIndex) const { return readTableByTablePointer(&sin_1024[0], normalizedIndex*DEFAULT_LUT_LENGTH); }///<read sine table
+
+		/** the raw Hann table, DEFAULT_LUT_LENGTH points from 0 up to 1 and back to 0, for kernels that read it directly */
+		inline const double* getHannTable() const { return hannTable ? hannTable->table : nullptr; }
+
+		/** per-note values: equal tempered pitch at A440 by note number, MMA velocity gain by velocity (0 -> 127) */
+		inline double getNotePitch(uint32_t midiNoteNumber) const { return notePitches[midiNoteNumber & (NUM_MIDI_NOTES - 1)]; }
+		inline double getVelocityGain(uint32_t midiNoteVelocity) const { return velocityGains[midiNoteVelocity & (NUM_MIDI_NOTES - 1)]; }
+
+		/** memory accounting: this object plus its dynamic tables (the static tables are compiled in) */
+		uint64_t getAllocatedBytes() const { return sizeof(BasicLookupTables) + (hannTable ? sizeof(LookUpTable) + hannTable->tableLength * sizeof(double) : 0); }
 
 	protected:
 		// --- tables go here
 		std::unique_ptr<LookUpTable> hannTable = nullptr;///< a single lookup table - you can add more tables here
+		double notePitches[NUM_MIDI_NOTES] = { 0.0 };	///< midiNoteNumberToOscFrequency( ) of each note
+		double velocityGains[NUM_MIDI_NOTES] = { 0.0 };	///< mmaMIDItoAtten( ) of each velocity
 	};
 
 
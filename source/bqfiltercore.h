@@ -77,7 +77,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class BQFilterCore : public ModuleCore
+	class BQFilterCore : public MemoryAccounted<BQFilterCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
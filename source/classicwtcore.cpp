@@ -85,6 +85,9 @@ namespace SynthLab
 		// -- reset the synhcronizer
 		hardSyncronizer.reset(sampleRate, 0.0);
 
+		// --- recalculate everything on the next update
+		updateDetector.invalidate();
+
 		// --- reset to new start phase
 		oscClock.reset(parameters->modKnobValue[MOD_KNOB_A]);
 
@@ -158,71 +161,75 @@ namespace SynthLab
 			(parameters->fineDetune / 100.0) +	/* cents/100 = semitones */
 			(processInfo.unisonDetuneCents / 100.0);	/* cents/100 = semitones */
 
-		// --- lookup the pitch shift modifier (fraction)
-		//double pitchShift = pitchShiftTableLookup(currentPitchModSemitones);
-		// --- or ...
-		// --- direct calculation version 2^(n/12) - note that this is equal temperatment
-		double pitchShift = pow(2.0, currentPitchModSemitones / 12.0);
+		// --- unique mod  input
+		double hsMod = processInfo.modulationInputs->getModValue(kUniqueMod);
 
-		// --- calculate the moduated pitch value
-		double oscillatorFrequency = midiPitch*pitchShift;
+		// --- change detection: skip the pitch, hard sync, gain and pan calculations
+		//     when none of their inputs moved
+		double updateKey[] = { midiPitch, currentPitchModSemitones, hsMod,
+			parameters->modKnobValue[MOD_KNOB_B], parameters->outputAmplitude_dB, parameters->panValue };
 
-		// --- BOUND the value to our range - in theory, we would bound this to any NYQUIST
-		boundValue(oscillatorFrequency, WT_OSC_MIN, WT_OSC_MAX);
+		if (updateDetector.hasChanged(updateKey))
+		{
+			// --- lookup the pitch shift modifier (fraction)
+			//double pitchShift = pitchShiftTableLookup(currentPitchModSemitones);
+			// --- or ...
+			// --- direct calculation version 2^(n/12) - note that this is equal temperatment
+			double pitchShift = pow(2.0, currentPitchModSemitones / 12.0);
 
-		// --- phase inc = fo/fs
-		oscClock.setFrequency(oscillatorFrequency, sampleRate);
+			// --- calculate the moduated pitch value
+			double oscillatorFrequency = midiPitch*pitchShift;
 
-		// --- set the hard sync helper
-		/*
-			ALL Cores have a special Modulation that is routed as kUniqueMod
-			For the ClassicWTCore this is Hard Sync Modulation
-		*/
-		parameters->hardSyncRatio = getModKnobValueLinear(parameters->modKnobValue[MOD_KNOB_B], 1.0, 4.0);
+			// --- BOUND the value to our range - in theory, we would bound this to any NYQUIST
+			boundValue(oscillatorFrequency, WT_OSC_MIN, WT_OSC_MAX);
 
-		// --- unique mod  input
-		double hsMod = processInfo.modulationInputs->getModValue(kUniqueMod);
+			// --- phase inc = fo/fs
+			oscClock.setFrequency(oscillatorFrequency, sampleRate);
 
-		// --- additive modulation with full wave rectified control signal (cut LFO rate in half)
-		double mod = fabs(hsMod);
-		mapDoubleValue(mod, 0.0, 0.0, HSYNC_MOD_SLOPE);
-		parameters->hardSyncRatio += mod;
-		boundValue(parameters->hardSyncRatio, 1.0, 4.0);
+			// --- set the hard sync helper
+			/*
+				ALL Cores have a special Modulation that is routed as kUniqueMod
+				For the ClassicWTCore this is Hard Sync Modulation
+			*/
+			hardSyncRatio = getModKnobValueLinear(parameters->modKnobValue[MOD_KNOB_B], 1.0, 4.0);
 
-		// --- update
-		hardSyncronizer.setHardSyncFrequency(oscillatorFrequency*(parameters->hardSyncRatio));
+			// --- additive modulation with full wave rectified control signal (cut LFO rate in half)
+			double mod = fabs(hsMod);
+			mapDoubleValue(mod, 0.0, 0.0, HSYNC_MOD_SLOPE);
+			hardSyncRatio += mod;
+			boundValue(hardSyncRatio, 1.0, 4.0);
 
-		// --- select the wavetable source; only if changed
-		if (parameters->waveIndex != currentWaveIndex)
-		{
-			// --- try to get by index first (faster at runtime)
-			selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.uniqueIndexes[parameters->waveIndex]);
+			// --- update
+			hardSyncronizer.setHardSyncFrequency(oscillatorFrequency*hardSyncRatio);
+
+			// --- note for the table selection
+			tableNote = midiNoteNumberFromOscFrequency(oscillatorFrequency);
+
+			// --- scale from GUI dB
+			outputAmplitude = dB2Raw(parameters->outputAmplitude_dB);
 
-			// --- see if there is a map version (slower at runtime)
-			if(!selectedTableSource)
-				selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.moduleStrings[parameters->waveIndex]);
+			// --- pan
+			double panTotal = parameters->panValue;
+			boundValueBipolar(panTotal);
 
-			currentWaveIndex = parameters->waveIndex;
+			// --- equal power calculation in synthfunction.h
+			calculatePanValues(panTotal, panLeftGain, panRightGain);
 		}
 
-		// --- select table
-		uint32_t midiNote = midiNoteNumberFromOscFrequency(oscillatorFrequency);
-		selectedTableSource->selectTable(midiNote);
+		// --- the parameters are shared, so render( ) reads this voice's value
+		parameters->hardSyncRatio = hardSyncRatio;
 
-		// --- scale from GUI dB
-		outputAmplitude = dB2Raw(parameters->outputAmplitude_dB);
+		// --- select the wavetable source by index, lock-free (the indexes were found at reset);
+		//     every update, so that a source replaced at runtime (an imported wavetable) is picked up
+		selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.uniqueIndexes[parameters->waveIndex]);
+
+		// --- select table; always, the source may be shared with other voices
+		selectedTableSource->selectTable(tableNote);
 
 		// --- shape
 		parameters->oscillatorShape = parameters->modKnobValue[MOD_KNOB_A];
 		boundValueBipolar(parameters->oscillatorShape);
 
-		// --- pan
-		double panTotal = parameters->panValue;
-		boundValueBipolar(panTotal);
-
-		// --- equal power calculation in synthfunction.h
-		calculatePanValues(panTotal, panLeftGain, panRightGain);
-
 		return true;
 	}
 
@@ -384,7 +391,7 @@ namespace SynthLab
 		else
 			oscClock.reset(parameters->modKnobValue[MOD_KNOB_C]); // MOD_KNOB_C = start phase
 
-		currentWaveIndex = -1;
+		updateDetector.invalidate();
 		return true;
 	}
 
@@ -429,7 +436,7 @@ namespace SynthLab
 			wavetables[waveIndex].addSynthLabTableSet(&slTableSet);
 			uint32_t uniqueIndex = 0;
 			if (!processInfo.wavetableDatabase->addTableSource(slTableSet.waveformName, &wavetables[waveIndex], uniqueIndex))
-				; // delete wt;
+				coreData.uniqueIndexes[waveIndex] = processInfo.wavetableDatabase->getWaveformIndex(slTableSet.waveformName); // --- another core added it first
 			else
 				coreData.uniqueIndexes[waveIndex] = uniqueIndex;
 		}
@@ -71,6 +71,11 @@ namespace SynthLab
 	- MOD_KNOB_C = "Phase"
 	- MOD_KNOB_D = "D"
 
+	Update:
+	- the pitch, hard sync, gain and pan calculations are skipped when none of their inputs
+	changed since the last update (see UpdateChangeDetector); the table is selected every time
+	because the table sources are shared by the voices
+
 	Render:
 	- renders into the output buffer using pointers in the CoreProcData argument to the render function
 	- renders one block of audio per render cycle
@@ -82,7 +87,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class ClassicWTCore : public ModuleCore
+	class ClassicWTCore : public MemoryAccounted<ClassicWTCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -97,6 +102,7 @@ namespace SynthLab
 		virtual bool render(CoreProcData& processInfo) override; 
 		virtual bool doNoteOn(CoreProcData& processInfo) override;
 		virtual bool doNoteOff(CoreProcData& processInfo) override;
+		virtual void addUpdateCounters(UpdateCounters& counters) override { counters.add(updateDetector.getCounters()); }
 
 		/** Helper functions for rendering  */
 		double renderSample(SynthClock& clock, double shape = 0.5);
@@ -109,7 +115,11 @@ namespace SynthLab
 		double outputAmplitude = 1.0;	///< amplitude in dB
 		double panLeftGain = 0.707;		///< left channel gain
 		double panRightGain = 0.707;	///< right channel gain
-		int32_t currentWaveIndex = -1;  ///< to minimize dictionary (map) lookup iterating
+
+		// --- change detection
+		UpdateChangeDetector<6> updateDetector;	///< pitch, hard sync, gain and pan inputs of update( )
+		double hardSyncRatio = 1.0;		///< hard sync ratio with modulation, from the last recalculation
+		uint32_t tableNote = 0;			///< MIDI note of the table to select, from the last recalculation
 
 		// --- timebase
 		SynthClock oscClock; ///< the oscillator timebase
@@ -0,0 +1,606 @@
+#include "convolver.h"
+#include "pcmsample.h"
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   convolver.cpp
+\author Will Pirkle
+\brief  Zero-latency partitioned convolution for cabinet and body impulse responses
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/** \return head and tail memory */
+	uint64_t ImpulseResponse::getAllocatedBytes() const
+	{
+		uint64_t bytes = 0;
+		for (uint32_t i = 0; i < 2; i++)
+			bytes += (headTaps[i].capacity() + tailRe[i].capacity() + tailIm[i].capacity()) * sizeof(double);
+		return bytes;
+	}
+
+	/** zero the history and delay lines; the next partition starts empty */
+	void ConvolutionState::flush()
+	{
+		for (uint32_t i = 0; i < 2; i++)
+		{
+			std::fill(history[i].begin(), history[i].end(), 0.0);
+			std::fill(tailOutput[i].begin(), tailOutput[i].end(), 0.0);
+			std::fill(delayLineRe[i].begin(), delayLineRe[i].end(), 0.0);
+			std::fill(delayLineIm[i].begin(), delayLineIm[i].end(), 0.0);
+		}
+		position = 0;
+		newestSpectrum = 0;
+	}
+
+	/** \return buffers and signal memory, not including the shared impulse response or the FFT tables */
+	uint64_t ConvolutionState::getAllocatedBytes() const
+	{
+		uint64_t bytes = (sumRe.capacity() + sumIm.capacity() + frame.capacity()) * sizeof(double);
+		for (uint32_t i = 0; i < 2; i++)
+			bytes += (history[i].capacity() + tailOutput[i].capacity() + delayLineRe[i].capacity() + delayLineIm[i].capacity()) * sizeof(double);
+		return bytes;
+	}
+
+	/**
+	\brief Constructs a stereo convolver
+	- See class declaration for information on standalone operation
+
+	\param _midiInputData shared MIDI input resource; may be nullptr
+	\param _parameters shared GUI and operational parameters; may be nullptr
+	\param blockSize the synth block process size in frames (stereo); sets the partition size
+
+	\returns the newly constructed object
+	*/
+	Convolver::Convolver(std::shared_ptr<MidiInputData> _midiInputData,
+		std::shared_ptr<ConvolverParameters> _parameters,
+		uint32_t blockSize) :
+		MemoryAccounted(_midiInputData)
+		, parameters(_parameters)
+	{
+		// --- standalone ONLY: parameters
+		if (!parameters)
+			parameters.reset(new ConvolverParameters);
+
+		// --- power of two partitions, at least one block
+		partitionSize = CONVOLVER_MIN_PARTITION;
+		while (partitionSize < blockSize)
+			partitionSize <<= 1;
+
+		// --- create our audio buffers
+		audioBuffers.reset(new SynthProcessInfo(CONVOLVER_AUDIO_INPUTS, CONVOLVER_AUDIO_OUTPUTS, blockSize));
+	}
+
+	/**
+	\brief Destruction: states that were never switched to, or not yet collected
+	*/
+	Convolver::~Convolver()
+	{
+		delete pendingState.exchange(nullptr);
+		delete retiredState.exchange(nullptr);
+	}
+
+	/**
+	\brief Memory accounting: adds the running state; the impulse response is shared
+
+	\param report the node for this module
+	*/
+	void Convolver::getMemoryReport(MemoryReport& report)
+	{
+		SynthModule::getMemoryReport(report);
+		if (!state)
+			return;
+
+		uint64_t bytes = sizeof(ConvolutionState) + state->getAllocatedBytes();
+		report.ownedBytes += bytes;
+		report.residentBytes += estimateResidentBytes(bytes);
+
+		if (state->impulseResponse)
+			report.sharedBytes += state->impulseResponse->getAllocatedBytes();
+	}
+
+	/**
+	\brief Resets object to initialized state
+	- call once during initialization
+	- call any time sample rate changes (after init); the impulse response is prepared again
+	at the new rate
+	- NOT real-time safe
+
+	\param _sampleRate the current sample rate in Hz
+
+	\returns true if successful, false otherwise
+	*/
+	bool Convolver::reset(double _sampleRate)
+	{
+		silentInputSamples = 0;
+
+		// --- if sample rate did not change, just flush
+		if (sampleRate == _sampleRate && state)
+		{
+			state->flush();
+			return true;
+		}
+
+		sampleRate = _sampleRate;
+
+		// --- the audio thread is stopped: install the new state directly
+		delete pendingState.exchange(nullptr);
+		delete retiredState.exchange(nullptr);
+		state = createState(prepareImpulseResponse());
+
+		return true;
+	}
+
+	/**
+	\brief Updates the wet/dry mix
+
+	\returns true if successful, false otherwise
+	*/
+	bool Convolver::update()
+	{
+		dryMix = parameters->dryLevel_dB <= CONVOLVER_LEVEL_OFF_DB ? 0.0 : pow(10.0, parameters->dryLevel_dB / 20.0);
+		wetMix = parameters->wetLevel_dB <= CONVOLVER_LEVEL_OFF_DB ? 0.0 : pow(10.0, parameters->wetLevel_dB / 20.0);
+		return true;
+	}
+
+	/**
+	\brief Processes audio through the convolver
+	- Calls the update function first - NOTE: owning object does not need to call update()
+	- switches to a newly loaded impulse response first
+	- any number of samples up to the block size; partitions complete inside the loop
+
+	\returns true if successful, false otherwise
+	*/
+	bool Convolver::render(uint32_t samplesToProcess)
+	{
+		// --- stereo I/O
+		float* inputs[2] = { getAudioBuffers()->getInputBuffer(LEFT_CHANNEL), getAudioBuffers()->getInputBuffer(RIGHT_CHANNEL) };
+		float* outputs[2] = { getAudioBuffers()->getOutputBuffer(LEFT_CHANNEL), getAudioBuffers()->getOutputBuffer(RIGHT_CHANNEL) };
+
+		// --- switch to a new response at the block boundary; the flag tells publishState( ) that
+		//     a switch may be between taking the pending state and retiring the old one
+		switchingState.store(true);
+		ConvolutionState* newState = pendingState.exchange(nullptr);
+		if (newState)
+		{
+			// --- the retired slot is always empty here: publishState( ) collects it before it
+			//     posts a state, so nothing is freed on the audio thread
+			retiredState.store(state.release(), std::memory_order_release);
+			state.reset(newState);
+			silentInputSamples = 0;
+		}
+		switchingState.store(false, std::memory_order_release);
+
+		bool inputSilent = audioBuffers->allInputsSilent();
+
+		// --- no response: pass through
+		if (!hasImpulseResponse())
+		{
+			for (uint32_t c = 0; c < 2; c++)
+				memcpy(outputs[c], inputs[c], samplesToProcess * sizeof(float));
+			audioBuffers->setOutputSilenceFlags(inputSilent ? ALL_CHANNELS_SILENT : 0);
+			return true;
+		}
+
+		ConvolutionState& convolution = *state;
+		const ImpulseResponse& impulseResponse = *convolution.impulseResponse;
+		uint32_t B = impulseResponse.partitionSize;
+
+		// --- silent input for longer than the response plus the history: every buffer and
+		//     spectrum holds zeros, so the output is exactly zero and processing can be skipped
+		if (!inputSilent)
+			silentInputSamples = 0;
+		else if (silentInputSamples >= impulseResponse.length + 2 * B)
+		{
+			for (uint32_t c = 0; c < 2; c++)
+				memset(outputs[c], 0, samplesToProcess * sizeof(float));
+			audioBuffers->setOutputSilenceFlags(ALL_CHANNELS_SILENT);
+			return true;
+		}
+		audioBuffers->setOutputSilenceFlags(0);
+
+		update();
+
+		for (uint32_t i = 0; i < samplesToProcess; i++)
+		{
+			uint32_t position = convolution.position;
+
+			for (uint32_t c = 0; c < 2; c++)
+			{
+				double xn = inputs[c][i];
+				double* history = convolution.history[c].data();
+				history[B + position] = xn;
+
+				// --- head: direct convolution with partition 0, plus the tail computed
+				//     when the last partition completed
+				const double* taps = impulseResponse.headTaps[impulseResponse.channelCount > 1 ? c : 0].data();
+				const double* window = history + position + 1;
+				double yn = convolution.tailOutput[c][position];
+				for (uint32_t j = 0; j < B; j++)
+					yn += taps[j] * window[j];
+
+				outputs[c][i] = (float)(dryMix*xn + wetMix*yn);
+			}
+
+			if (++convolution.position == B)
+				processPartition();
+		}
+
+		// --- count toward an empty tail
+		if (inputSilent)
+			silentInputSamples += samplesToProcess;
+
+		return true;
+	}
+
+	/**
+	\brief
+	Audio thread: a partition of input is complete
+	- transforms the history frame [x(m-1), x(m)] into the frequency-domain delay line
+	- sums the products of the last P-1 frame spectra with the tail partition spectra and
+	transforms back; overlap-save keeps the second half, which is the tail output for the
+	next partition
+	- shifts the history by one partition
+	*/
+	void Convolver::processPartition()
+	{
+		ConvolutionState& convolution = *state;
+		const ImpulseResponse& impulseResponse = *convolution.impulseResponse;
+		uint32_t B = impulseResponse.partitionSize;
+		uint32_t bins = B + 1;
+		uint32_t slots = impulseResponse.partitionCount - 1;
+		uint32_t newest = slots > 0 ? (convolution.newestSpectrum + 1) % slots : 0;
+
+		for (uint32_t c = 0; c < 2; c++)
+		{
+			double* history = convolution.history[c].data();
+
+			if (slots > 0)
+			{
+				uint32_t irChannel = impulseResponse.channelCount > 1 ? c : 0;
+				double* delayLineRe = convolution.delayLineRe[c].data();
+				double* delayLineIm = convolution.delayLineIm[c].data();
+				double* sumRe = convolution.sumRe.data();
+				double* sumIm = convolution.sumIm.data();
+
+				convolution.fft.forward(history, delayLineRe + newest * bins, delayLineIm + newest * bins);
+
+				// --- partition k (1 -> P-1) meets the frame k-1 partitions old
+				std::fill(convolution.sumRe.begin(), convolution.sumRe.end(), 0.0);
+				std::fill(convolution.sumIm.begin(), convolution.sumIm.end(), 0.0);
+				uint32_t slot = newest;
+				for (uint32_t k = 0; k < slots; k++)
+				{
+					const double* xRe = delayLineRe + slot * bins;
+					const double* xIm = delayLineIm + slot * bins;
+					const double* hRe = impulseResponse.tailRe[irChannel].data() + k * bins;
+					const double* hIm = impulseResponse.tailIm[irChannel].data() + k * bins;
+
+					for (uint32_t b = 0; b < bins; b++)
+					{
+						sumRe[b] += xRe[b] * hRe[b] - xIm[b] * hIm[b];
+						sumIm[b] += xRe[b] * hIm[b] + xIm[b] * hRe[b];
+					}
+					slot = slot == 0 ? slots - 1 : slot - 1;
+				}
+
+				convolution.fft.inverse(sumRe, sumIm, convolution.frame.data());
+				memcpy(convolution.tailOutput[c].data(), convolution.frame.data() + B, B * sizeof(double));
+			}
+
+			// --- current partition becomes the previous one
+			memcpy(history, history + B, B * sizeof(double));
+		}
+
+		convolution.newestSpectrum = newest;
+		convolution.position = 0;
+	}
+
+	/**
+	\brief Perform note-on operations for the component
+		- nothing to do here
+
+	\return true if handled, false if not handled
+	*/
+	bool Convolver::doNoteOn(MIDINoteEvent& noteEvent)
+	{
+		return true;
+	}
+
+	/**
+	\brief Perform note-off operations for the component
+		- nothing to do here
+
+	\return true if handled, false if not handled
+	*/
+	bool Convolver::doNoteOff(MIDINoteEvent& noteEvent)
+	{
+		return true;
+	}
+
+	/**
+	\brief
+	Loads an impulse response from a WAV file
+	- NOT real-time safe; the audio thread switches to it at the top of the next render( )
+	- the prepared response is shared with every other Convolver that loads the same file
+
+	\param wavFilePath fully qualified WAV file path
+
+	\return true if sucessful
+	*/
+	bool Convolver::loadImpulseResponse(const char* wavFilePath)
+	{
+		if (!wavFilePath)
+			return false;
+
+		irFilePath = wavFilePath;
+		irSamples.clear();
+		irSamples.shrink_to_fit();
+		irChannels = 0;
+		irSampleRate = 0.0;
+
+		if (sampleRate <= 0.0)
+			return true;
+
+		std::shared_ptr<const ImpulseResponse> impulseResponse = prepareImpulseResponse();
+		if (!impulseResponse)
+		{
+			irFilePath.clear();
+			return false;
+		}
+
+		publishState(createState(impulseResponse));
+		return true;
+	}
+
+	/**
+	\brief
+	Uses an impulse response from memory, e.g. one that was synthesized
+	- NOT real-time safe; the audio thread switches to it at the top of the next render( )
+	- the samples are copied, so that the response can be prepared again at a new sample rate
+
+	\param samples the response, interleaved if more than one channel
+	\param frames length of the response in sample frames
+	\param channels channels in the data; only the first two are used
+	\param _irSampleRate sample rate of the response
+
+	\return true if sucessful
+	*/
+	bool Convolver::setImpulseResponse(const float* samples, uint32_t frames, uint32_t channels, double _irSampleRate)
+	{
+		if (!samples || frames == 0 || channels == 0 || _irSampleRate <= 0.0)
+			return false;
+
+		irFilePath.clear();
+		irSamples.assign(samples, samples + (uint64_t)frames * channels);
+		irChannels = channels;
+		irSampleRate = _irSampleRate;
+
+		if (sampleRate <= 0.0)
+			return true;
+
+		std::shared_ptr<const ImpulseResponse> impulseResponse = prepareImpulseResponse();
+		if (!impulseResponse)
+			return false;
+
+		publishState(createState(impulseResponse));
+		return true;
+	}
+
+	/**
+	\brief
+	Removes the impulse response; the module passes its input through
+	- NOT real-time safe; the audio thread switches at the top of the next render( )
+	*/
+	void Convolver::clearImpulseResponse()
+	{
+		irFilePath.clear();
+		irSamples.clear();
+		irSamples.shrink_to_fit();
+		irChannels = 0;
+		irSampleRate = 0.0;
+
+		publishState(createState(nullptr));
+	}
+
+	/**
+	\brief
+	Prepares the stored response at the current sample rate
+
+	\return the response, or null if there is none or it could not be prepared
+	*/
+	std::shared_ptr<const ImpulseResponse> Convolver::prepareImpulseResponse()
+	{
+		if (sampleRate <= 0.0)
+			return nullptr;
+
+		if (!irFilePath.empty())
+			return getSharedImpulseResponse(irFilePath, sampleRate, partitionSize);
+
+		if (!irSamples.empty())
+			return createImpulseResponse(irSamples.data(), (uint32_t)(irSamples.size() / irChannels), irChannels, irSampleRate, sampleRate, partitionSize);
+
+		return nullptr;
+	}
+
+	/**
+	\brief
+	Allocates a running state sized for a response
+	- NOT real-time safe
+
+	\param impulseResponse the response; may be null for pass-through
+
+	\return the new state
+	*/
+	std::unique_ptr<ConvolutionState> Convolver::createState(std::shared_ptr<const ImpulseResponse> impulseResponse)
+	{
+		std::unique_ptr<ConvolutionState> newState(new ConvolutionState);
+		newState->impulseResponse = impulseResponse;
+		if (!impulseResponse)
+			return newState;
+
+		uint32_t B = impulseResponse->partitionSize;
+		uint32_t spectra = (impulseResponse->partitionCount - 1) * (B + 1);
+
+		newState->fft.init(2 * B);
+		for (uint32_t c = 0; c < 2; c++)
+		{
+			newState->history[c].assign(2 * B, 0.0);
+			newState->tailOutput[c].assign(B, 0.0);
+			newState->delayLineRe[c].assign(spectra, 0.0);
+			newState->delayLineIm[c].assign(spectra, 0.0);
+		}
+		newState->sumRe.assign(B + 1, 0.0);
+		newState->sumIm.assign(B + 1, 0.0);
+		newState->frame.assign(2 * B, 0.0);
+
+		return newState;
+	}
+
+	/**
+	\brief
+	Hands a state to the audio thread
+	- frees a pending state that the audio thread has not switched to yet, so only the newest 
+	load is used, and the state the audio thread retired last time
+	- if the audio thread is in the middle of a switch, waits for it to retire its old state
+	before collecting it (a few instructions); with the pending slot empty no other switch
+	can start, so the retired slot stays empty until the new state is posted
+
+	\param newState the state to switch to
+	*/
+	void Convolver::publishState(std::unique_ptr<ConvolutionState> newState)
+	{
+		delete pendingState.exchange(nullptr);
+
+		while (switchingState.load())
+			std::this_thread::yield();
+
+		delete retiredState.exchange(nullptr, std::memory_order_acq_rel);
+		pendingState.store(newState.release(), std::memory_order_release);
+	}
+
+	/**
+	\brief
+	Prepares an impulse response for partitioned convolution
+	- resamples to the synth's rate with linear interpolation; the taps are scaled by the rate
+	ratio so that the response keeps its gain
+	- truncates to CONVOLVER_MAX_IR_SECONDS
+	- NOT real-time safe
+
+	\param samples the response, interleaved if more than one channel
+	\param frames length of the response in sample frames
+	\param channels channels in the data; only the first two are used
+	\param irSampleRate sample rate of the response
+	\param sampleRate sample rate of the synth
+	\param partitionSize B, a power of two >= CONVOLVER_MIN_PARTITION
+
+	\return the prepared response, or null if the arguments are not valid
+	*/
+	std::shared_ptr<const ImpulseResponse> Convolver::createImpulseResponse(const float* samples, uint32_t frames, uint32_t channels,
+		double irSampleRate, double sampleRate, uint32_t partitionSize)
+	{
+		if (!samples || frames == 0 || channels == 0 || irSampleRate <= 0.0 || sampleRate <= 0.0 ||
+			partitionSize < CONVOLVER_MIN_PARTITION || (partitionSize & (partitionSize - 1)) != 0)
+			return nullptr;
+
+		std::shared_ptr<ImpulseResponse> impulseResponse = std::make_shared<ImpulseResponse>();
+		ImpulseResponse& ir = *impulseResponse;
+
+		// --- input samples per output sample
+		double ratio = irSampleRate / sampleRate;
+		uint32_t length = (uint32_t)((frames - 1) / ratio) + 1;
+		length = std::min(length, (uint32_t)(CONVOLVER_MAX_IR_SECONDS * sampleRate));
+
+		uint32_t B = partitionSize;
+		ir.partitionSize = B;
+		ir.partitionCount = (length + B - 1) / B;
+		ir.channelCount = std::min(channels, (uint32_t)2);
+		ir.length = length;
+		ir.sampleRate = sampleRate;
+
+		FFT fft;
+		fft.init(2 * B);
+		std::vector<double> taps(ir.partitionCount * B, 0.0);
+		std::vector<double> frame(2 * B, 0.0);
+		uint32_t bins = B + 1;
+
+		for (uint32_t c = 0; c < ir.channelCount; c++)
+		{
+			// --- resample
+			for (uint32_t n = 0; n < length; n++)
+			{
+				double readIndex = n * ratio;
+				uint32_t index = (uint32_t)readIndex;
+				double y1 = samples[(uint64_t)index * channels + c];
+				double y2 = index + 1 < frames ? samples[(uint64_t)(index + 1) * channels + c] : 0.0;
+				taps[n] = ratio * doLinearInterpolation(y1, y2, readIndex - index);
+			}
+
+			// --- head, time reversed
+			ir.headTaps[c].resize(B);
+			for (uint32_t j = 0; j < B; j++)
+				ir.headTaps[c][B - 1 - j] = taps[j];
+
+			// --- tail spectra
+			ir.tailRe[c].resize((ir.partitionCount - 1) * bins);
+			ir.tailIm[c].resize((ir.partitionCount - 1) * bins);
+			for (uint32_t k = 1; k < ir.partitionCount; k++)
+			{
+				std::copy(taps.begin() + k * B, taps.begin() + (k + 1) * B, frame.begin());
+				fft.forward(frame.data(), ir.tailRe[c].data() + (k - 1) * bins, ir.tailIm[c].data() + (k - 1) * bins);
+			}
+		}
+
+		return impulseResponse;
+	}
+
+	/**
+	\brief
+	Shared impulse response cache
+	- one prepared response per file, sample rate and partition size, loaded with the
+	PCMSample loader on the first request
+	- the cache holds weak references: a response is freed when the last Convolver lets it go,
+	and is loaded again if it is requested after that
+	- NOT real-time safe; loads are serialized
+
+	\param wavFilePath fully qualified WAV file path
+	\param sampleRate sample rate of the synth
+	\param partitionSize B
+
+	\return the shared response, or null if the file could not be loaded
+	*/
+	std::shared_ptr<const ImpulseResponse> Convolver::getSharedImpulseResponse(const std::string& wavFilePath,
+		double sampleRate, uint32_t partitionSize)
+	{
+		typedef std::tuple<std::string, double, uint32_t> ResponseKey;
+		static std::mutex cacheMutex;
+		static std::map<ResponseKey, std::weak_ptr<const ImpulseResponse>> cache;
+
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		std::weak_ptr<const ImpulseResponse>& cached = cache[ResponseKey(wavFilePath, sampleRate, partitionSize)];
+
+		std::shared_ptr<const ImpulseResponse> impulseResponse = cached.lock();
+		if (impulseResponse)
+			return impulseResponse;
+
+		PCMSample sample;
+		if (!sample.loadPCMSample(wavFilePath.c_str()) || sample.getNumChannels() == 0)
+			return nullptr;
+
+		impulseResponse = createImpulseResponse(sample.getSampleBuffer(), sample.getSampleCount() / sample.getNumChannels(),
+			sample.getNumChannels(), sample.getSampleRate(), sampleRate, partitionSize);
+
+		cached = impulseResponse;
+		return impulseResponse;
+	}
+
+} // namespace
@@ -0,0 +1,246 @@
+#ifndef __convolver_h__
+#define __convolver_h__
+
+// --- includes
+#include "synthbase.h"
+#include "synthfunctions.h"
+#include "fft.h"
+
+#include <atomic>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   convolver.h
+\author Will Pirkle
+\brief  Zero-latency partitioned convolution for cabinet and body impulse responses
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Constants for the convolver
+	*/
+	const double CONVOLVER_MAX_IR_SECONDS = 4.0;		///< longer impulse responses are truncated
+	const uint32_t CONVOLVER_MIN_PARTITION = 16;		///< smallest partition size
+	//@}
+
+	/**
+	\struct ImpulseResponse
+	\ingroup SynthStructures
+	\brief
+	An impulse response prepared for uniformly partitioned convolution at one sample rate
+	and partition size B
+	- partition 0 (the head) is kept as time-reversed taps for direct convolution
+	- partitions 1 -> P-1 (the tail) are kept as spectra of their B taps zero-padded to 2B
+	- immutable once built, so one object is shared by every Convolver that uses it,
+	on any thread
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct ImpulseResponse
+	{
+		uint32_t partitionSize = 0;		///< B
+		uint32_t partitionCount = 0;	///< P, including the head
+		uint32_t channelCount = 0;		///< 1 (applied to both channels) or 2
+		uint32_t length = 0;			///< taps, after resampling and truncation
+		double sampleRate = 0.0;		///< rate the taps were resampled to
+
+		std::vector<double> headTaps[2];	///< partition 0, time reversed: B taps
+		std::vector<double> tailRe[2];		///< partitions 1 -> P-1: (P-1) spectra of B+1 bins
+		std::vector<double> tailIm[2];		///< partitions 1 -> P-1: (P-1) spectra of B+1 bins
+
+		/** head and tail memory */
+		uint64_t getAllocatedBytes() const;
+	};
+
+	/**
+	\struct ConvolutionState
+	\ingroup SynthStructures
+	\brief
+	Per-Convolver running state for one impulse response
+	- built off the audio thread, sized for its impulse response, so that the audio thread
+	only swaps pointers when a new response is loaded
+	- the history holds the previous and current partitions of input [x(m-1), x(m)]; it is
+	both the delay line of the direct head convolution and the overlap-save FFT frame
+	- the frequency-domain delay line is a ring of the spectra of the last P-1 frames
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct ConvolutionState
+	{
+		std::shared_ptr<const ImpulseResponse> impulseResponse = nullptr;	///< null = bypass
+
+		FFT fft;							///< 2B point transform
+		std::vector<double> history[2];		///< 2B input samples
+		std::vector<double> tailOutput[2];	///< B samples of tail output for the current partition
+		std::vector<double> delayLineRe[2];	///< (P-1) spectra of B+1 bins
+		std::vector<double> delayLineIm[2];	///< (P-1) spectra of B+1 bins
+		std::vector<double> sumRe;			///< B+1 bins
+		std::vector<double> sumIm;			///< B+1 bins
+		std::vector<double> frame;			///< 2B samples, inverse transform output
+		uint32_t position = 0;				///< write position in the current partition
+		uint32_t newestSpectrum = 0;		///< ring index of the newest frame spectrum
+
+		/** zero the history and delay lines */
+		void flush();
+
+		/** buffers and signal memory */
+		uint64_t getAllocatedBytes() const;
+	};
+
+	/**
+	\class Convolver
+	\ingroup SynthModules
+	\brief
+	Stereo convolution module for cabinet, speaker and instrument body impulse responses
+	- does not include any ModuleCores; implements functionality directly
+	- uniformly partitioned convolution with the partition size B = the block size
+	(rounded up to a power of two)
+	- zero added latency: the first partition is convolved directly in the time domain, one
+	sample at a time; the FFT tail convolution for the next partition runs when a partition
+	of input completes, so render( ) may be called with any number of samples
+	- the cost of the tail grows with the response length (one complex multiply-add per bin
+	per partition, per block); this suits cabinets and instrument bodies of up to a few
+	hundred milliseconds, not long reverbs
+	- mono responses are applied to both channels, stereo responses channel by channel
+
+	Impulse responses:
+	- loaded from WAV files with the PCMSample loader, resampled to the synth's sample rate
+	with linear interpolation, and truncated to CONVOLVER_MAX_IR_SECONDS
+	- the prepared spectra are shared: every Convolver in the process that loads the same
+	file at the same sample rate and partition size uses the same ImpulseResponse
+	- loadImpulseResponse( ) and setImpulseResponse( ) are NOT real-time safe; call them from
+	a loader or GUI thread while the audio thread runs. The new response is handed over at the
+	top of the next render( ) call; the audio thread never allocates or frees
+	- the response is reloaded at the new rate when reset( ) is called with a new sample rate
+
+	Base Class: SynthModule
+	- Overrides the five (5) common functions plus a special getParameters() method to
+	return a shared pointer to the parameters structure.
+
+	Databases: None
+
+	GUI Parameters: ConvolverParameters
+	- getParameters() function allows direct access to std::shared_ptr<ConvolverParameters>
+
+	Access to audio buffers (I/O)
+	- std::shared_ptr<AudioBuffer> getAudioBuffers()
+
+	Reads:
+	- AudioBuffer Input samples
+
+	Writes:
+	- AudioBuffer Output samples
+
+	Construction:
+	- same as AudioDelay: pass the shared MIDI data and parameters, or nullptr for standalone
+
+	Render:
+	- renders into its own AudioBuffers object; see SynthModule::getAudioBuffers()
+	- processes stereo; passes the input through when no impulse response is loaded
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class Convolver : public MemoryAccounted<Convolver, SynthModule>
+	{
+	public:
+		/** One and only specialized constructor; pointers may be null for stanalone */
+		Convolver(std::shared_ptr<MidiInputData> _midiInputData,
+			std::shared_ptr<ConvolverParameters> _parameters,
+			uint32_t blockSize = 64);
+		virtual ~Convolver();
+		virtual void getMemoryReport(MemoryReport& report) override;
+
+		/** SynthModule Overrides */
+		virtual bool reset(double _sampleRate) override;
+		virtual bool update() override;
+		virtual bool render(uint32_t samplesToProcess = 1) override;
+		virtual bool doNoteOn(MIDINoteEvent& noteEvent) override;
+		virtual bool doNoteOff(MIDINoteEvent& noteEvent) override;
+
+		/** For standalone operation only; not used in SynthLab synth projects */
+		std::shared_ptr<ConvolverParameters> getParameters() { return parameters; }
+
+		/** NOT real-time safe: load a WAV file (shared), or use samples from memory (interleaved);
+		    false if the response cannot be prepared; before the first reset( ) the source
+		    is only stored, and prepared at the reset */
+		bool loadImpulseResponse(const char* wavFilePath);
+		bool setImpulseResponse(const float* samples, uint32_t frames, uint32_t channels, double irSampleRate);
+
+		/** NOT real-time safe: back to pass-through */
+		void clearImpulseResponse();
+
+		/** true if a response is loaded and active on the audio thread */
+		bool hasImpulseResponse() { return state && state->impulseResponse; }
+
+		/** partition size B */
+		uint32_t getPartitionSize() { return partitionSize; }
+
+		/** prepares an impulse response; NOT real-time safe
+		    - getSharedImpulseResponse( ) loads a WAV file once per path, rate and partition size
+		    and returns the same object to every caller while any of them holds it */
+		static std::shared_ptr<const ImpulseResponse> createImpulseResponse(const float* samples, uint32_t frames, uint32_t channels,
+			double irSampleRate, double sampleRate, uint32_t partitionSize);
+		static std::shared_ptr<const ImpulseResponse> getSharedImpulseResponse(const std::string& wavFilePath,
+			double sampleRate, uint32_t partitionSize);
+
+	protected:
+		/** For standalone operation only; not used in SynthLab synth projects */
+		std::shared_ptr<ConvolverParameters> parameters = nullptr;
+
+		/** prepare the response from the stored source at the current rate; null if none */
+		std::shared_ptr<const ImpulseResponse> prepareImpulseResponse();
+
+		/** a running state sized for a response */
+		std::unique_ptr<ConvolutionState> createState(std::shared_ptr<const ImpulseResponse> impulseResponse);
+
+		/** hand a state to the audio thread */
+		void publishState(std::unique_ptr<ConvolutionState> newState);
+
+		/** audio thread: one partition of input is complete; run the tail for the next one */
+		void processPartition();
+
+	protected:
+		double sampleRate = 0.0;		///< current sample rate
+		uint32_t partitionSize = 64;	///< B
+		double wetMix = 1.0;			///< wet output
+		double dryMix = 0.0;			///< dry output
+
+		// --- the source of the response, kept for sample rate changes
+		std::string irFilePath;			///< WAV file; empty if from memory or none
+		std::vector<float> irSamples;	///< samples from memory, interleaved
+		uint32_t irChannels = 0;		///< channels of irSamples
+		double irSampleRate = 0.0;		///< sample rate of irSamples
+
+		// --- running state (audio thread) and the hand-over: built -> pending -> (audio thread)
+		//     -> retired -> deleted by the next load, so the audio thread never frees a state
+		std::unique_ptr<ConvolutionState> state = nullptr;
+		std::atomic<ConvolutionState*> pendingState{ nullptr };
+		std::atomic<ConvolutionState*> retiredState{ nullptr };
+		std::atomic<bool> switchingState{ false };	///< render( ) is switching states
+
+		// --- silence tracking
+		uint32_t silentInputSamples = 0;	///< samples of silent input; the tail is empty after length + 2B
+	};
+
+} // namespace
+
+#endif /* defined(__convolver_h__) */
@@ -91,7 +91,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class SynthLabCore : public ModuleCore
+	class SynthLabCore : public MemoryAccounted<SynthLabCore, ModuleCore>
 	{
 	public:
 		// --- constructor/destructor
@@ -26,7 +26,7 @@ namespace SynthLab
 	DCA::DCA(std::shared_ptr<MidiInputData> _midiInputData, 
 		std::shared_ptr<DCAParameters> _parameters, 
 		uint32_t blockSize) :
-		SynthModule(_midiInputData)
+		MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -35,6 +35,9 @@ namespace SynthLab
 		
 		// --- create our audio buffers
 		audioBuffers.reset(new SynthProcessInfo(DCA_AUDIO_INPUTS, DCA_AUDIO_OUTPUTS, blockSize));
+
+		// --- shared, read-only per-note tables
+		lookupTables = &BasicLookupTables::getSharedTables();
 	}
 
 	/**
@@ -52,6 +55,7 @@ namespace SynthLab
 		panLeftGain = 0.707;	// --- center
 		panRightGain = 0.707;	// --- center
 		midiVelocityGain = 1.0; // --- 127
+		updateDetector.invalidate();
 		return true;
 	}
 
@@ -80,17 +84,23 @@ namespace SynthLab
 
 		// --- calculate the final raw gain value
 		//     multiply the various gains together: MIDI Velocity * EG Mod * Amp Mod * gain_dB (from GUI, next code line)
-		gainRaw = midiVelocityGain * egMod * ampMod;
+		double modulatedGain = midiVelocityGain * egMod * ampMod;
+
+		// --- now process pan modifiers
+		double panTotal = parameters->panValue + (parameters->panModIntensity * modulationInput->getModValue(kPanMod));
+
+		// --- change detection: the output gain and pan are unchanged if these are
+		double updateKey[] = { modulatedGain, parameters->gainValue_dB, panTotal };
+		if (!updateDetector.hasChanged(updateKey))
+			return true; // handled
 
 		// --- apply final output gain
+		gainRaw = modulatedGain;
 		if (parameters->gainValue_dB > kMinAbsoluteGain_dB)
 			gainRaw *= pow(10.0, parameters->gainValue_dB / 20.0);
 		else
 			gainRaw = 0.0; // OFF
 
-		// --- now process pan modifiers
-		double panTotal = parameters->panValue + (parameters->panModIntensity * modulationInput->getModValue(kPanMod));
-
 		// --- limit in case pan control is biased
 		boundValueBipolar(panTotal);
 
@@ -113,22 +123,68 @@ namespace SynthLab
 	*/
 	bool DCA::render(uint32_t samplesToProcess)
 	{
-		// --- update parameters for this block
-		update();
-
 		// --- DCA processes every sample into output buffers
 		float* leftInBuffer = audioBuffers->getInputBuffer(LEFT_CHANNEL);
 		float* rightInBuffer = audioBuffers->getInputBuffer(RIGHT_CHANNEL);
 		float* leftOutBuffer = audioBuffers->getOutputBuffer(LEFT_CHANNEL);
 		float* rightOutBuffer = audioBuffers->getOutputBuffer(RIGHT_CHANNEL);
 
-		// --- process block
-		for (uint32_t i = 0; i < samplesToProcess; i++)
+		// --- silence in, silence out
+		if (audioBuffers->allInputsSilent())
 		{
-			// --- stereo, add left pan value
-			leftOutBuffer[i] = leftInBuffer[i] * gainRaw * panLeftGain;
-			rightOutBuffer[i] = rightInBuffer[i] * gainRaw * panRightGain;
+			memset(leftOutBuffer, 0, samplesToProcess * sizeof(float));
+			memset(rightOutBuffer, 0, samplesToProcess * sizeof(float));
+			audioBuffers->setOutputSilenceFlags(ALL_CHANNELS_SILENT);
+			return true;
 		}
+		audioBuffers->setOutputSilenceFlags(0);
+
+		// --- update parameters for this block
+		update();
+
+		// --- process block
+		const SynthKernelTable& kernels = getSynthKernels();
+		kernels.mixWrite(leftOutBuffer, leftInBuffer, samplesToProcess, (float)(gainRaw * panLeftGain));
+		kernels.mixWrite(rightOutBuffer, rightInBuffer, samplesToProcess, (float)(gainRaw * panRightGain));
+		return true;
+	}
+
+	/**
+	\brief Processes audio from the input buffers and ACCUMULATES into external output buffers
+	- Calls the update function first - NOTE: owning object does not need to call update()
+	- used by the voice to add its output directly into the engine's mix buffers, skipping
+	the copy through this object's output buffers and the voice staging buffers
+	- the owner's mix scaling is folded into the per-channel gain values
+	- silent input blocks are skipped entirely
+
+	\param leftOutBuffer destination left channel, already offset if needed
+	\param rightOutBuffer destination right channel, already offset if needed
+	\param samplesToProcess samples to render
+	\param outputScaling owner's mixing scalar
+
+	\returns true if successful, false otherwise
+	*/
+	bool DCA::renderAccumulate(float* leftOutBuffer, float* rightOutBuffer, uint32_t samplesToProcess, double outputScaling)
+	{
+		// --- nothing to add
+		if (audioBuffers->allInputsSilent())
+			return true;
+
+		// --- update parameters for this block
+		update();
+
+		// --- input buffers
+		float* leftInBuffer = audioBuffers->getInputBuffer(LEFT_CHANNEL);
+		float* rightInBuffer = audioBuffers->getInputBuffer(RIGHT_CHANNEL);
+
+		// --- fold all gains into one multiplier per channel
+		float leftGain = (float)(gainRaw * panLeftGain * outputScaling);
+		float rightGain = (float)(gainRaw * panRightGain * outputScaling);
+
+		// --- process block
+		const SynthKernelTable& kernels = getSynthKernels();
+		kernels.mixAccumulate(leftOutBuffer, leftInBuffer, samplesToProcess, leftGain);
+		kernels.mixAccumulate(rightOutBuffer, rightInBuffer, samplesToProcess, rightGain);
 		return true;
 	}
 
@@ -140,7 +196,8 @@ namespace SynthLab
 	bool DCA::doNoteOn(MIDINoteEvent& noteEvent)
 	{
 		// --- store our MIDI velocity
-		midiVelocityGain = mmaMIDItoAtten(noteEvent.midiNoteVelocity);
+		midiVelocityGain = lookupTables->getVelocityGain(noteEvent.midiNoteVelocity);
+		updateDetector.invalidate();
 
 		// --- prevent mod inputs from accidentaly killing output (e.g. volume is set to 0)
 		modulationInput->initInputValues();
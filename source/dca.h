@@ -2,6 +2,7 @@
 
 #include "synthbase.h"
 #include "synthfunctions.h"
+#include "basiclookuptables.h"
 
 // -----------------------------
 //	--- SynthLab SDK File --- // 
@@ -25,6 +26,8 @@ namespace SynthLab
 	- there are NO cores currently defined as the object is so simple
 	- this is an example of a SynthModule that implements its functionality
 	  DIRECTLY and without ModuleCores
+	- update( ) skips the gain and pan calculations when none of their inputs changed
+	  (see UpdateChangeDetector)
 
 	Base Class: SynthModule
 	- Overrides the five (5) common functions plus a special getParameters() method to
@@ -96,7 +99,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class DCA : public SynthModule
+	class DCA : public MemoryAccounted<DCA, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -111,6 +114,10 @@ namespace SynthLab
 		virtual bool render(uint32_t samplesToProcess = 1) override;
 		virtual bool doNoteOn(MIDINoteEvent& noteEvent) override;
 		virtual bool doNoteOff(MIDINoteEvent& noteEvent) override;
+		virtual void addUpdateCounters(UpdateCounters& counters) override { counters.add(updateDetector.getCounters()); }
+
+		/** render and accumulate directly into an owner's output buffers */
+		bool renderAccumulate(float* leftOutBuffer, float* rightOutBuffer, uint32_t samplesToProcess, double outputScaling = 1.0);
 
 		/** For standalone operation only; not used in SynthLab synth projects */
 		std::shared_ptr<DCAParameters> getParameters() { return parameters; }
@@ -124,9 +131,13 @@ namespace SynthLab
 		double panLeftGain = 0.707;		///< left channel gain
 		double panRightGain = 0.707;	///< right channel gain
 		double midiVelocityGain = 0.0;	///< gain from MIDI input velocity
+		const BasicLookupTables* lookupTables = nullptr;	///< shared velocity gain table
 
 		/** --- pan value is set by voice, or via MIDI/MIDI Channel */
 		double panValue = 0.0;			
+
+		/** --- change detection: gain and pan inputs of update( ) */
+		UpdateChangeDetector<3> updateDetector;
 	};
 
 }
\ No newline at end of file
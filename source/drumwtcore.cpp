@@ -103,7 +103,7 @@ namespace SynthLab
 			if (!processInfo.wavetableDatabase->getTableSource(drumTables[i].getWaveformName()))
 			{
 				if (!processInfo.wavetableDatabase->addTableSource(drumTables[i].getWaveformName(), &drumTables[i], uniqueIndex))
-					;
+					coreData.uniqueIndexes[i] = processInfo.wavetableDatabase->getWaveformIndex(drumTables[i].getWaveformName());
 				else
 					coreData.uniqueIndexes[i] = uniqueIndex;
 			}
@@ -140,12 +140,8 @@ namespace SynthLab
 		// --- select the wavetable source, only if changed
 		if (parameters->waveIndex != currentWaveIndex)
 		{
-			// --- try to get by index first (faster at runtime)
+			// --- by index, lock-free; the indexes were found at reset
 			selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.uniqueIndexes[parameters->waveIndex]);
-
-			// --- see if there is a map version (slower at runtime)
-			if (!selectedTableSource)
-				selectedTableSource = processInfo.wavetableDatabase->getTableSource(drumTables[parameters->waveIndex].getWaveformName());
 		}
 
 		// --- phase inc = fo/fs
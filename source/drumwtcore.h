@@ -85,7 +85,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class DrumWTCore : public ModuleCore
+	class DrumWTCore : public MemoryAccounted<DrumWTCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
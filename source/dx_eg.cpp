@@ -26,7 +26,7 @@ namespace SynthLab
 	DXEG::DXEG(std::shared_ptr<MidiInputData> _midiInputData,
 		std::shared_ptr<EGParameters> _parameters,
 		uint32_t blockSize) :
-		SynthModule(_midiInputData)
+		MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- for standalone operation
@@ -109,35 +109,24 @@ namespace SynthLab
 
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool DXEG::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool DXEG::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 	/**
@@ -81,7 +81,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class DXEGCore : public ModuleCore
+	class DXEGCore : public MemoryAccounted<DXEGCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -97,6 +97,40 @@ namespace SynthLab
 		*/
 		virtual uint32_t getWaveTableLength() override { return selectedTable.tableLength; }
 
+		/**
+		\brief
+		Memory accounting: bytes of the dynamic tables; a table shared across a range of
+		MIDI notes is only counted once
+
+		\return table bytes
+		*/
+		virtual uint64_t getTableMemoryBytes() override
+		{
+			uint64_t bytes = 0;
+			for (uint32_t i = 0; i < NUM_MIDI_NOTES; i++)
+			{
+				if (!wavetableSet[i].table || (i > 0 && wavetableSet[i].table == wavetableSet[i - 1].table))
+					continue;
+				bytes += (uint64_t)wavetableSet[i].tableLength * sizeof(double);
+			}
+			return bytes;
+		}
+
+		/**
+		\brief
+		Residency: the dynamic tables, once each (same rule as getTableMemoryBytes( ))
+
+		\param regions list to append the tables to
+		*/
+		virtual void getMemoryRegions(MemoryRegionList& regions) override
+		{
+			for (uint32_t i = 0; i < NUM_MIDI_NOTES; i++)
+			{
+				if (!wavetableSet[i].table || (i > 0 && wavetableSet[i].table == wavetableSet[i - 1].table))
+					continue;
+				regions.push_back(MemoryRegion(wavetableSet[i].table.get(), (uint64_t)wavetableSet[i].tableLength * sizeof(double)));
+			}
+		}
 
 		/**
 		\brief
@@ -28,7 +28,7 @@ namespace SynthLab
 	EnvelopeGenerator::EnvelopeGenerator(std::shared_ptr<MidiInputData> _midiInputData,
 		std::shared_ptr<EGParameters> _parameters, 
 		uint32_t blockSize) :
-		SynthModule(_midiInputData)
+		MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- for standalone operation
@@ -44,15 +44,10 @@ namespace SynthLab
 		// --- setup the cores
 		if (midiInputData->getAuxDAWDataUINT(kDMBuild) == 0)
 		{
-			// --- setup the cores
-			std::shared_ptr<AnalogEGCore> analogCore = std::make_shared<AnalogEGCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(analogCore));
-
-			std::shared_ptr<DXEGCore> dxCore = std::make_shared<DXEGCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(dxCore));
-
-			std::shared_ptr<LinearEGCore> linearCore = std::make_shared<LinearEGCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(linearCore));
+			// --- setup the cores; built on first selection
+			addModuleCoreFactory(createModuleCore<AnalogEGCore>, 0, "AnalogEG");
+			addModuleCoreFactory(createModuleCore<DXEGCore>, 1, "DX-EG");
+			addModuleCoreFactory(createModuleCore<LinearEGCore>, 2, "LinEG");
 		}
 	}
 
@@ -114,35 +109,24 @@ namespace SynthLab
 
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool EnvelopeGenerator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool EnvelopeGenerator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 	/**
@@ -98,7 +98,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class EnvelopeGenerator : public SynthModule
+	class EnvelopeGenerator : public MemoryAccounted<EnvelopeGenerator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
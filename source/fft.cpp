@@ -0,0 +1,190 @@
+#include "fft.h"
+
+#include <math.h>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   fft.cpp
+\author Will Pirkle
+\brief  Real-input FFT for convolution and table analysis
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Sets the transform size and builds the tables
+	- NOT real-time safe
+
+	\param _size the real transform size N, a power of two >= 4
+
+	\return true if sucessful
+	*/
+	bool FFT::init(uint32_t _size)
+	{
+		if (_size < 4 || (_size & (_size - 1)) != 0)
+			return false;
+
+		if (_size == size)
+			return true;
+
+		size = _size;
+		halfSize = size / 2;
+		const double pi = 3.14159265358979323846;
+
+		// --- bit reversal permutation of the half-size transform
+		uint32_t bits = 0;
+		while ((1u << bits) < halfSize)
+			bits++;
+
+		bitReverse.resize(halfSize);
+		for (uint32_t i = 0; i < halfSize; i++)
+		{
+			uint32_t reversed = 0;
+			for (uint32_t b = 0; b < bits; b++)
+				reversed |= ((i >> b) & 1) << (bits - 1 - b);
+			bitReverse[i] = reversed;
+		}
+
+		// --- butterflies
+		twiddleCos.resize(halfSize / 2);
+		twiddleSin.resize(halfSize / 2);
+		for (uint32_t k = 0; k < halfSize / 2; k++)
+		{
+			twiddleCos[k] = cos(2.0 * pi * k / halfSize);
+			twiddleSin[k] = sin(2.0 * pi * k / halfSize);
+		}
+
+		// --- even/odd split
+		splitCos.resize(halfSize + 1);
+		splitSin.resize(halfSize + 1);
+		for (uint32_t k = 0; k <= halfSize; k++)
+		{
+			splitCos[k] = cos(2.0 * pi * k / size);
+			splitSin[k] = sin(2.0 * pi * k / size);
+		}
+
+		workRe.assign(halfSize, 0.0);
+		workIm.assign(halfSize, 0.0);
+		return true;
+	}
+
+	/**
+	\brief
+	Forward transform: X[k] = sum x[n] e^(-2pi i kn/N)
+
+	\param input N real samples
+	\param re receives the N/2 + 1 real parts
+	\param im receives the N/2 + 1 imaginary parts
+	*/
+	void FFT::forward(const double* input, double* re, double* im)
+	{
+		// --- pack even samples into the real parts, odd into the imaginary parts
+		for (uint32_t n = 0; n < halfSize; n++)
+		{
+			workRe[bitReverse[n]] = input[2 * n];
+			workIm[bitReverse[n]] = input[2 * n + 1];
+		}
+
+		complexTransform(false);
+
+		// --- split: X[k] = E[k] + W^k O[k] with E, O the spectra of the even and odd samples
+		for (uint32_t k = 0; k <= halfSize; k++)
+		{
+			uint32_t a = k % halfSize;
+			uint32_t b = (halfSize - k) % halfSize;
+
+			double evenRe = 0.5 * (workRe[a] + workRe[b]);
+			double evenIm = 0.5 * (workIm[a] - workIm[b]);
+			double oddRe = 0.5 * (workIm[a] + workIm[b]);
+			double oddIm = -0.5 * (workRe[a] - workRe[b]);
+
+			re[k] = evenRe + splitCos[k] * oddRe + splitSin[k] * oddIm;
+			im[k] = evenIm + splitCos[k] * oddIm - splitSin[k] * oddRe;
+		}
+	}
+
+	/**
+	\brief
+	Inverse transform: x[n] = (1/N) sum X[k] e^(2pi i kn/N) over the full Hermitian spectrum
+
+	\param re the N/2 + 1 real parts
+	\param im the N/2 + 1 imaginary parts
+	\param output receives N real samples
+	*/
+	void FFT::inverse(const double* re, const double* im, double* output)
+	{
+		// --- merge: rebuild the packed half-size spectrum Z[k] = E[k] + i O[k]
+		for (uint32_t k = 0; k < halfSize; k++)
+		{
+			uint32_t m = halfSize - k;
+			double xRe = re[k];
+			double xIm = k == 0 ? 0.0 : im[k];
+			double yRe = re[m];
+			double yIm = m == halfSize ? 0.0 : im[m];
+
+			double evenRe = 0.5 * (xRe + yRe);
+			double evenIm = 0.5 * (xIm - yIm);
+			double diffRe = 0.5 * (xRe - yRe);
+			double diffIm = 0.5 * (xIm + yIm);
+			double oddRe = diffRe * splitCos[k] - diffIm * splitSin[k];
+			double oddIm = diffRe * splitSin[k] + diffIm * splitCos[k];
+
+			workRe[bitReverse[k]] = evenRe - oddIm;
+			workIm[bitReverse[k]] = evenIm + oddRe;
+		}
+
+		complexTransform(true);
+
+		// --- unpack
+		double scale = 1.0 / halfSize;
+		for (uint32_t n = 0; n < halfSize; n++)
+		{
+			output[2 * n] = workRe[n] * scale;
+			output[2 * n + 1] = workIm[n] * scale;
+		}
+	}
+
+	/**
+	\brief
+	Iterative radix-2 decimation-in-time butterflies on the work buffers, which are already
+	in bit reversed order
+
+	\param inverseTransform true for the positive exponent
+	*/
+	void FFT::complexTransform(bool inverseTransform)
+	{
+		double sign = inverseTransform ? 1.0 : -1.0;
+
+		for (uint32_t length = 2; length <= halfSize; length <<= 1)
+		{
+			uint32_t half = length / 2;
+			uint32_t step = halfSize / length;
+
+			for (uint32_t start = 0; start < halfSize; start += length)
+			{
+				for (uint32_t j = 0; j < half; j++)
+				{
+					double wRe = twiddleCos[j * step];
+					double wIm = sign * twiddleSin[j * step];
+
+					uint32_t top = start + j;
+					uint32_t bottom = top + half;
+
+					double tRe = workRe[bottom] * wRe - workIm[bottom] * wIm;
+					double tIm = workRe[bottom] * wIm + workIm[bottom] * wRe;
+
+					workRe[bottom] = workRe[top] - tRe;
+					workIm[bottom] = workIm[top] - tIm;
+					workRe[top] += tRe;
+					workIm[top] += tIm;
+				}
+			}
+		}
+	}
+
+} // namespace
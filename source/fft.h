@@ -0,0 +1,77 @@
+#ifndef __fft_h__
+#define __fft_h__
+
+// --- includes
+#include <stdint.h>
+#include <vector>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   fft.h
+\author Will Pirkle
+\brief  Real-input FFT for convolution and table analysis
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\class FFT
+	\ingroup SynthObjects
+	\brief
+	Radix-2 FFT of real data
+	- a real N-point transform runs as an N/2-point complex transform of the even/odd samples
+	packed into the real/imaginary parts, then one split pass separates the two spectra
+	- spectra are split (separate real and imaginary arrays) and hold the N/2 + 1 bins
+	from DC to Nyquist
+	- init( ) allocates and builds the twiddle tables and is NOT real-time safe; forward( ) and
+	inverse( ) do not allocate and are real-time safe
+	- an FFT object holds work buffers, so one object must not be used by two threads at once
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class FFT
+	{
+	public:
+		FFT() {}
+		~FFT() {}
+
+		/** size must be a power of two, >= 4; false otherwise */
+		bool init(uint32_t _size);
+
+		/** transform size N and spectrum size N/2 + 1 */
+		uint32_t getSize() { return size; }
+		uint32_t getBinCount() { return size / 2 + 1; }
+
+		/** N real samples -> N/2 + 1 bins; unscaled */
+		void forward(const double* input, double* re, double* im);
+
+		/** N/2 + 1 bins -> N real samples; scaled by 1/N so that inverse(forward(x)) = x;
+		    the imaginary parts of DC and Nyquist are ignored */
+		void inverse(const double* re, const double* im, double* output);
+
+	protected:
+		/** in-place complex transform of the half-size work buffers */
+		void complexTransform(bool inverseTransform);
+
+		uint32_t size = 0;			///< N
+		uint32_t halfSize = 0;		///< N/2, the complex transform size
+		std::vector<uint32_t> bitReverse;	///< permutation of the half-size transform
+		std::vector<double> twiddleCos;		///< cos(2pi k / (N/2)), k < N/4
+		std::vector<double> twiddleSin;		///< sin(2pi k / (N/2)), k < N/4
+		std::vector<double> splitCos;		///< cos(2pi k / N), k <= N/2
+		std::vector<double> splitSin;		///< sin(2pi k / N), k <= N/2
+		std::vector<double> workRe;			///< half-size complex work buffer
+		std::vector<double> workIm;			///< half-size complex work buffer
+	};
+
+} // namespace
+
+#endif /* defined(__fft_h__) */
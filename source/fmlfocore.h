@@ -84,7 +84,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class FMLFOCore : public ModuleCore
+	class FMLFOCore : public MemoryAccounted<FMLFOCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -60,6 +60,20 @@ namespace SynthLab
 		dxEG->selectModuleCore(1);
 	}
 
+	/**
+	\brief Memory accounting: adds the DX EG as a child of the core's report
+
+	\param report the node for this core
+	*/
+	void FMOCore::getMemoryReport(MemoryReport& report)
+	{
+		ModuleCore::getMemoryReport(report);
+		if (dxEGParameters)
+			report.ownedBytes += sizeof(EGParameters);
+		if (dxEG)
+			dxEG->getMemoryReport(report.addChild("DX EG"));
+	}
+
 	/**
 	\brief Resets object to initialized state
 	- parameters are accessed via the processInfo.moduleParameters pointer
@@ -91,7 +105,7 @@ namespace SynthLab
 		if (!processInfo.wavetableDatabase->getTableSource(sineTableSource.getWaveformName()))
 		{
 			if (!processInfo.wavetableDatabase->addTableSource(sineTableSource.getWaveformName(), &sineTableSource, uniqueIndex))
-				; // error
+				coreData.uniqueIndexes[moduleStringIndex] = processInfo.wavetableDatabase->getWaveformIndex(sineTableSource.getWaveformName());
 			else
 				coreData.uniqueIndexes[moduleStringIndex] = uniqueIndex;
 		}
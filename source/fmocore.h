@@ -83,7 +83,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class FMOCore : public ModuleCore
+	class FMOCore : public MemoryAccounted<FMOCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -91,6 +91,7 @@ namespace SynthLab
 		
 		/** Destructor is empty: all resources are smart pointers */
 		virtual ~FMOCore() {}	/* D-TOR */
+		virtual void getMemoryReport(MemoryReport& report) override;
 								
 		/** ModuleCore Overrides */
 		virtual bool reset(CoreProcData& processInfo) override;
@@ -29,7 +29,7 @@ namespace SynthLab
 		std::shared_ptr<FMOperatorParameters> _parameters,
 		std::shared_ptr<WavetableDatabase> _waveTableDatabase,
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -123,36 +123,24 @@ namespace SynthLab
 
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool FMOperator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		coreProcessData.unisonStartPhase = unisonStartPhase; 
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool FMOperator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 
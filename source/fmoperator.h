@@ -115,7 +115,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class FMOperator : public SynthModule
+	class FMOperator : public MemoryAccounted<FMOperator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -4,6 +4,9 @@
 #include "../wavetables/static_tables/vs_wt.h"
 #include "../wavetables/static_tables/fm_wt.h"
 
+#include <map>
+#include <mutex>
+
 // -----------------------------
 //	--- SynthLab SDK File --- //
 //  ----------------------------
@@ -62,8 +65,8 @@ namespace SynthLab
 	\brief Resets object to initialized state
 	- parameters are accessed via the processInfo.moduleParameters pointer
 	- initialize timbase and hard synchronizer
-	- create new tables if fs changed, or on first reset
-	 -query and add new tables to database
+	- select the shared tables if fs changed, or on first reset
+	- register them with the database unless another core (or voice) already has
 
 	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
 
@@ -85,25 +88,25 @@ namespace SynthLab
 		// --- reset to new start phase
 		oscClock.reset(parameters->modKnobValue[MOD_KNOB_C]);
 
-		// --- create new tables if fs changed, or on first reset
+		// --- select the shared tables if fs changed, or on first reset
 		if (sampleRateChanged)
-		{
-			processInfo.wavetableDatabase->removeTableSource("sinewave");
-			processInfo.wavetableDatabase->removeTableSource("parabola");
 			createTables(sampleRate);
-		}
 
-		uint32_t uniqueIndex = 0;
-		if (!processInfo.wavetableDatabase->getTableSource(coreData.moduleStrings[0]))
+		// --- register them; the first core to reset at a new rate replaces the old rate's
+		//     sources, every other core finds its own tables already there
+		IWavetableSource* sources[2] = { &tables->sineTableSource, &tables->dynamicTableSource };
+		for (uint32_t i = 0; i < 2; i++)
 		{
-			processInfo.wavetableDatabase->addTableSource(coreData.moduleStrings[0], &sineTableSource, uniqueIndex);
-			coreData.uniqueIndexes[0] = uniqueIndex;
-		}
+			if (processInfo.wavetableDatabase->getTableSource(coreData.moduleStrings[i]) != sources[i])
+			{
+				uint32_t uniqueIndex = 0;
+				processInfo.wavetableDatabase->removeTableSource(coreData.moduleStrings[i]);
+				processInfo.wavetableDatabase->addTableSource(coreData.moduleStrings[i], sources[i], uniqueIndex);
+			}
 
-		if (!processInfo.wavetableDatabase->getTableSource(coreData.moduleStrings[1]))
-		{
-			processInfo.wavetableDatabase->addTableSource(coreData.moduleStrings[1], &dynamicTableSource, uniqueIndex);
-			coreData.uniqueIndexes[1] = uniqueIndex;
+			int32_t index = processInfo.wavetableDatabase->getWaveformIndex(coreData.moduleStrings[i]);
+			if (index >= 0)
+				coreData.uniqueIndexes[i] = (uint32_t)index;
 		}
 
 		// --- init; note how I try to get the table with the faster method first
@@ -188,18 +191,9 @@ namespace SynthLab
 		// --- set it
 		hardSyncronizer.setHardSyncFrequency(oscillatorFrequency*hardSyncRatio);
 
-		// --- select the wavetable source if changed
-		if (currentWaveIndex != parameters->waveIndex)
-		{
-			// --- try to get the table with a unique index if possible
-			selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.uniqueIndexes[parameters->waveIndex]);
-
-			// --- use the name (slow)
-			if (!selectedTableSource)
-				selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.moduleStrings[parameters->waveIndex]);
-
-			currentWaveIndex = parameters->waveIndex;
-		}
+		// --- select the wavetable source by index, lock-free (the indexes were found at reset);
+		//     every update, so that a source replaced at runtime (an imported wavetable) is picked up
+		selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.uniqueIndexes[parameters->waveIndex]);
 
 		// --- select the wavetable based on note number of new osc frequency
 		if(selectedTableSource)
@@ -378,7 +372,6 @@ namespace SynthLab
 		else
 			oscClock.reset(parameters->modKnobValue[MOD_KNOB_C]); // MOD_KNOB_C = start phase
 
-		currentWaveIndex = -1;
 		return true;
 	}
 
@@ -400,21 +393,61 @@ namespace SynthLab
 	}
 
 	/**
-	\brief Table Creation funciont
-	- creates a parabola waveform
-	- bandlimited to each MIDI note's capabilities; calculates harmonic number limit
+	\brief Table selection funciont
+	- selects the shared tables for the sample rate, building them if this is the first
+	request at that rate (from any core)
 
 	\param sampleRate required for bandlimiting operation
 
-	\returns true if successful, false otherwise
+	\returns true if newly selected, false if the tables were already selected
 	*/
 	bool FourierWTCore::createTables(double sampleRate)
 	{
-		if (sampleRate == currentTableRate)
+		if (tables && sampleRate == currentTableRate)
 			return false; // not newly created
 
 		currentTableRate = sampleRate;
+		tables = getSharedTables(sampleRate);
+		return true;
+	}
+
+	/**
+	\brief Shared table cache
+	- one set of tables per sample rate, built on the first request at that rate
+	- sets are kept for the life of the process: the database may still hold the sources of
+	an older rate until a core resets at the new one, and rates are few (44.1k, 48k, 96k ...)
+	- NOT real-time safe; called from reset( )
 
+	\param sampleRate required for bandlimiting operation
+
+	\returns the shared tables
+	*/
+	std::shared_ptr<FourierTables> FourierWTCore::getSharedTables(double sampleRate)
+	{
+		static std::mutex cacheMutex;
+		static std::map<double, std::shared_ptr<FourierTables>> cache;
+
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		std::shared_ptr<FourierTables>& sharedTables = cache[sampleRate];
+		if (!sharedTables)
+		{
+			sharedTables = std::make_shared<FourierTables>();
+			buildTables(*sharedTables, sampleRate);
+		}
+		return sharedTables;
+	}
+
+	/**
+	\brief Table Creation funciont
+	- creates a parabola waveform
+	- bandlimited to each MIDI note's capabilities; calculates harmonic number limit
+
+	\param tables the tables to fill
+	\param sampleRate required for bandlimiting operation
+	*/
+	void FourierWTCore::buildTables(FourierTables& tables, double sampleRate)
+	{
+		DynamicTableSource& dynamicTableSource = tables.dynamicTableSource;
 		dynamicTableSource.clearAllWavetables();
 
 		// --- create the tables
@@ -487,7 +520,6 @@ namespace SynthLab
 			seedMIDINote += 12;
 			endMIDINote = seedMIDINote;
 		}
-		return true;
 	}
 
 
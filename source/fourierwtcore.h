@@ -18,6 +18,20 @@
 // -----------------------------------------------------------------------------
 namespace SynthLab
 {
+	/**
+	\struct FourierTables
+	\ingroup SynthStructures
+	\brief
+	The Fourier core's table sources for one sample rate
+	- built once per sample rate and shared by every FourierWTCore; see FourierWTCore::getSharedTables( )
+	- never changed after they are built
+	*/
+	struct FourierTables
+	{
+		SineTableSource sineTableSource;		///< sine table for very high frequney notes that have only one harmonic (the fundamental)
+		DynamicTableSource dynamicTableSource;	///< dynamic tables come out of this source 
+	};
+
 	/**
 	\class FourierWTCore
 	\ingroup ModuleCores
@@ -27,6 +41,7 @@ namespace SynthLab
 	- demonstrates use of DynamicTableSource object
 	- demonstrates use of  IWavetableSource interface
 	- Dynamic tables: created at runtime rather than static arrays & re-created if sample rate changes
+	- the tables for each sample rate are built once and shared by all instances (and voices)
 
 	Base Class: ModuleCore
 	- Overrides the five (5) common functions plus a special getParameters() method to
@@ -84,7 +99,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class FourierWTCore : public ModuleCore
+	class FourierWTCore : public MemoryAccounted<FourierWTCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -104,10 +119,16 @@ namespace SynthLab
 		double renderSample(SynthClock& clock, double shape = 0.5); 
 		double renderHardSyncSample(SynthClock& clock, double shape);
 
-		/** Dynamic table creation, based on fx */
+		/** Dynamic table creation, based on fx; false if the tables were already selected */
 		bool createTables(double sampleRate = 44100.0);
+
+		/** the shared tables for a sample rate, built on the first request; thread-safe */
+		static std::shared_ptr<FourierTables> getSharedTables(double sampleRate);
 	
 	protected:
+		/** fill the tables for a sample rate */
+		static void buildTables(FourierTables& tables, double sampleRate);
+
 		// --- basic variables
 		double sampleRate = 0.0;		///< sample rate
 		double currentTableRate = 0.0;	///< sample rate
@@ -116,7 +137,6 @@ namespace SynthLab
 		double panLeftGain = 0.707;		///< left channel gain
 		double panRightGain = 0.707;	///< right channel gain
 		double hardSyncRatio = 1.0;		///< for hard sync
-		int32_t currentWaveIndex = -1;  ///< to minimize dictionary (map) lookup iterating
 
 		// --- timebase
 		SynthClock oscClock;	///< timebase
@@ -127,8 +147,7 @@ namespace SynthLab
 		// -- hard sync helper
 		Synchronizer hardSyncronizer;	///< hard sync helper
 
-		SineTableSource sineTableSource;		///< sine table for very high frequney notes that have only one harmonic (the fundamental)
-		DynamicTableSource dynamicTableSource;	///< dynamic tables come out of this source 
+		std::shared_ptr<FourierTables> tables = nullptr;	///< shared tables for currentTableRate
 	};
 
 } // namespace
@@ -0,0 +1,419 @@
+#include "granularcore.h"
+#include "basiclookuptables.h"
+#include "synthkernels.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   granularcore.cpp
+\author Will Pirkle
+\brief  See also Designing Software Synthesizers in C++ 2nd Ed. by Will Pirkle
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Construction: Cores follow the same construction pattern
+	- set the Module type and name parameters
+	- expose the 16 module strings
+	- expose the 4 mod knob label strings
+	- intialize any internal variables
+
+	Core Specific:
+	- Waveform names are the names of folders in the \SynthLabSamples\Mellotron\ container folder
+	- all grains start on the free list
+
+	\returns the newly constructed object
+	*/
+	GranularCore::GranularCore()
+	{
+		moduleType = PCMO_MODULE;
+		moduleName = "Granular";
+		preferredIndex = 3; // ordering for user
+
+		// --- our waveforms, shared with the MellotronCore
+		/*
+			Module Strings, zero-indexed for your GUI Control:
+			- Cello, Choir, M300_Brass, M300A, M300B, MK2_Brass, MK2_Flute, MK2_Violins, String_Section, Woodwinds
+		*/
+		coreData.moduleStrings[0] = "Cello";			coreData.moduleStrings[8] =  "M300A";
+		coreData.moduleStrings[1] = "Choir";			coreData.moduleStrings[9] =  "M300B";
+		coreData.moduleStrings[2] = "M300 Brass";		coreData.moduleStrings[10] = empty_string.c_str();
+		coreData.moduleStrings[3] = "String Section";	coreData.moduleStrings[11] = empty_string.c_str();
+		coreData.moduleStrings[4] = "Woodwinds";		coreData.moduleStrings[12] = empty_string.c_str();
+		coreData.moduleStrings[5] = "MK2 Brass";		coreData.moduleStrings[13] = empty_string.c_str();
+		coreData.moduleStrings[6] = "MK2 Flute";		coreData.moduleStrings[14] = empty_string.c_str();
+		coreData.moduleStrings[7] = "MK2 Violins";		coreData.moduleStrings[15] = empty_string.c_str();
+
+		// --- modulation control knobs
+		coreData.modKnobStrings[MOD_KNOB_A]	 = "Density";
+		coreData.modKnobStrings[MOD_KNOB_B]	 = "Size";
+		coreData.modKnobStrings[MOD_KNOB_C]	 = "Position";
+		coreData.modKnobStrings[MOD_KNOB_D]	 = "Spray";
+
+		// --- the pool
+		for (uint32_t i = 0; i < GRAIN_POOL_SIZE; i++)
+			freeGrains[i] = GRAIN_POOL_SIZE - 1 - i;
+		freeGrainCount = GRAIN_POOL_SIZE;
+	}
+
+	/**
+	\brief Resets object to initialized state
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- finds WAV files in a common folder (name of instrument)
+	- sample sets are loaded into database if not existing already
+	- returns every grain to the free list
+
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool GranularCore::reset(CoreProcData& processInfo)
+	{
+		// --- store
+		sampleRate = processInfo.sampleRate;
+
+		// --- for reduced memory requirements
+		if (processInfo.midiInputData->getAuxDAWDataUINT(kHalfSampleSet) == 1)
+		{
+			for (uint32_t i = HALF_MELLOTRON_STRINGS; i < MODULE_STRINGS; i++)
+				coreData.moduleStrings[i] = empty_string.c_str();
+		}
+
+		// --- initialize samples; same folders as the MellotronCore, see MellotronCore::reset( )
+		std::string pluginFolderPath = processInfo.dllPath;
+		pluginFolderPath += "/SynthLabSamples/Mellotron/";
+
+		uint32_t setLimit = processInfo.midiInputData->getAuxDAWDataUINT(kHalfSampleSet) == 1 ? HALF_MELLOTRON_STRINGS : MODULE_STRINGS;
+		for (uint32_t i = 0; i < setLimit; i++)
+		{
+			std::string sampleFile = concatStrings(pluginFolderPath, coreData.moduleStrings[i]);
+			checkAddSampleSet(sampleFile.c_str(), coreData.moduleStrings[i], processInfo, i);
+		}
+
+		// --- index every set (also those another core added) for the lock-free lookup in update()
+		for (uint32_t i = 0; i < MODULE_STRINGS; i++)
+			coreData.uniqueIndexes[i] = processInfo.sampleDatabase->getSampleSetIndex(coreData.moduleStrings[i]);
+
+		// --- select first one
+		currentIndex = 0;
+		selectedSampleSource = processInfo.sampleDatabase->getSampleSource(coreData.moduleStrings[currentIndex]);
+		selectedSample = PCMSampleData();
+
+		// --- shared, read-only window (built on first use, so not in render)
+		hannTable = BasicLookupTables::getSharedTables().getHannTable();
+
+		// --- empty the pool
+		for (uint32_t i = 0; i < GRAIN_POOL_SIZE; i++)
+			freeGrains[i] = GRAIN_POOL_SIZE - 1 - i;
+		freeGrainCount = GRAIN_POOL_SIZE;
+		activeGrainCount = 0;
+		droppedGrains = 0;
+
+		samplesToNextGrain = 0.0;
+		noteActive = false;
+
+		return true;
+	}
+
+	/**
+	\brief Updates the object for the next block of audio processing
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- modulator inputs are accessied via processInfo.modulationInputs
+	- mod knob values are accessed via parameters->modKnobValue[]
+	Core Specific:
+	- calculates the pitch modulation value from GUI controls, input modulator kBipolarMod,
+	and MIDI pitch bend, and selects the PCM sample; same as the MellotronCore
+	- maps the mod knobs to the grain density, size, position and spray
+	- calculates final gain and pan values; new values apply to grains spawned from now on
+
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool GranularCore::update(CoreProcData& processInfo)
+	{
+		// --- parameters
+		PCMOscParameters* parameters = static_cast<PCMOscParameters*>(processInfo.moduleParameters);
+
+		// --- get the pitch bend value in semitones
+		double midiPitchBend = calculatePitchBend(processInfo.midiInputData);
+
+		// --- get the master tuning multiplier in semitones
+		double masterTuning = calculateMasterTuning(processInfo.midiInputData);
+
+		// --- calculate combined tuning offsets by simply adding values in semitones
+		double freqMod = processInfo.modulationInputs->getModValue(kBipolarMod) * kOscBipolarModRangeSemitones;
+
+		// --- do the portamento
+		double glideMod = glideModulator->getNextModulationValue();
+
+		// --- calculate combined tuning offsets by simply adding values in semitones
+		double currentPitchModSemitones = glideMod +
+			freqMod +
+			midiPitchBend +
+			masterTuning +
+			(parameters->octaveDetune * 12) +	/* octaves =  semitones*12 */
+			(parameters->coarseDetune) +		/* semitones */
+			(parameters->fineDetune / 100.0) +	/* cents/100 = semitones */
+			(processInfo.unisonDetuneCents / 100.0);	/* cents/100 = semitones */
+
+		// --- direct calculation version 2^(n/12) - note that this is equal temperatment
+		double pitchShift = pow(2.0, currentPitchModSemitones / 12.0);
+
+		// --- calculate the moduated pitch value
+		double oscillatorFrequency = midiPitch*pitchShift;
+
+		// --- BOUND the value to our range - in theory, we would bound this to any NYQUIST
+		boundValue(oscillatorFrequency, PCM_OSC_MIN, PCM_OSC_MAX);
+
+		// --- select the sample source by its index, found at reset; lock-free
+		if (currentIndex != parameters->waveIndex)
+		{
+			selectedSampleSource = processInfo.sampleDatabase->getSampleSource((uint32_t)coreData.uniqueIndexes[parameters->waveIndex]);
+			currentIndex = parameters->waveIndex;
+		}
+
+		// --- select sample and calcualte phase inc; grains read the selected buffer directly
+		phaseInc = selectedSampleSource ? selectedSampleSource->selectSample(oscillatorFrequency) : 0.0;
+		if (!selectedSampleSource || !selectedSampleSource->getSelectedSampleData(selectedSample))
+			selectedSample = PCMSampleData();
+
+		// --- grain parameters: density and size are exponential
+		double density = GRAIN_MIN_DENSITY * pow(GRAIN_MAX_DENSITY / GRAIN_MIN_DENSITY, parameters->modKnobValue[MOD_KNOB_A]);
+		double sizeMSec = GRAIN_MIN_SIZE_MSEC * pow(GRAIN_MAX_SIZE_MSEC / GRAIN_MIN_SIZE_MSEC, parameters->modKnobValue[MOD_KNOB_B]);
+		grainInterval = sampleRate / density;
+		grainLength = (uint32_t)msecToSamples(sampleRate, sizeMSec);
+		grainPosition = parameters->modKnobValue[MOD_KNOB_C];
+		grainSpray = parameters->modKnobValue[MOD_KNOB_D];
+
+		// --- overlapping grains add up; keep the level about constant across density and size
+		double overlap = density * sizeMSec / 1000.0;
+		grainGain = 1.0 / sqrt(fmax(1.0, 0.5 * overlap));
+
+		// --- pan
+		double panModulator = processInfo.modulationInputs->getModValue(kUniqueMod);
+		panValue = parameters->panValue + 0.5*panModulator;
+		boundValueBipolar(panValue);
+
+		// --- equal power calculation in synthfunction.h
+		calculatePanValues(panValue, panLeftGain, panRightGain);
+
+		// --- scale from dB
+		outputAmplitude = dB2Raw(parameters->outputAmplitude_dB);
+
+		return true;
+	}
+
+	/**
+	\brief Starts a grain from the free list
+	- the grain length is clamped so that every read is inside the sample, and the start
+	location is placed so that the grain ends inside it; render( ) needs no bounds checks
+	- the spray randomizes the start location and, for mono samples, the pan
+
+	\param startOffset sample offset of the onset in the current block
+
+	\returns true if a grain was started
+	*/
+	bool GranularCore::spawnGrain(uint32_t startOffset)
+	{
+		if (!selectedSample.samples || selectedSample.frames < GRAIN_MIN_SAMPLES || phaseInc <= 0.0)
+			return false;
+
+		if (freeGrainCount == 0)
+		{
+			droppedGrains++;
+			return false;
+		}
+
+		// --- last read is at frame n + 1 with n <= frames - 2
+		double lastFrame = (double)(selectedSample.frames - 2);
+		uint32_t length = grainLength;
+		double maxLength = lastFrame / phaseInc + 1.0;
+		if ((double)length > maxLength)
+			length = (uint32_t)maxLength;
+		if (length < GRAIN_MIN_SAMPLES)
+			return false;
+
+		double position = grainPosition + 0.5 * grainSpray * noiseGenerator.doWhiteNoise();
+		boundValueUnipolar(position);
+		double maxStart = fmax(0.0, lastFrame - (double)(length - 1) * phaseInc);
+
+		Grain& grain = grains[freeGrains[--freeGrainCount]];
+		activeGrains[activeGrainCount++] = (uint32_t)(&grain - grains);
+
+		grain.samples = selectedSample.samples;
+		grain.channels = selectedSample.channels;
+		grain.samplesLeft = length;
+		grain.startOffset = startOffset;
+		grain.readIndex = position * maxStart;
+		grain.readInc = phaseInc;
+		grain.windowPhase = 0.0;
+		grain.windowInc = (double)(DEFAULT_LUT_LENGTH - 1) / (double)length;
+
+		// --- stereo samples keep their image; mono grains are scattered across it
+		double leftGain = panLeftGain;
+		double rightGain = panRightGain;
+		if (grain.channels == 1 && grainSpray > 0.0)
+		{
+			double pan = panValue + grainSpray * noiseGenerator.doWhiteNoise();
+			boundValueBipolar(pan);
+			calculatePanValues(pan, leftGain, rightGain);
+		}
+		grain.gainL = (float)(outputAmplitude * grainGain * leftGain);
+		grain.gainR = (float)(outputAmplitude * grainGain * rightGain);
+
+		return true;
+	}
+
+	/**
+	\brief Renders the output of the module
+	- renders to output buffer using pointers in the CoreProcData argument
+	- does not support FM
+	Core Specific:
+	- starts the grains whose onsets fall in this block at their sample offsets
+	- adds each active grain into the output with the grainAccumulate kernel
+	- returns finished grains to the free list
+
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool GranularCore::render(CoreProcData& processInfo)
+	{
+		// --- buffers
+		float* leftOutBuffer = processInfo.outputBuffers[LEFT_CHANNEL];
+		float* rightOutBuffer = processInfo.outputBuffers[RIGHT_CHANNEL];
+		uint32_t samples = processInfo.samplesToProcess;
+
+		// --- schedule: the onset clock keeps its fraction, so the spacing does not depend on
+		//     the block size
+		if (noteActive && grainInterval > 0.0)
+		{
+			while (samplesToNextGrain < (double)samples)
+			{
+				spawnGrain((uint32_t)samplesToNextGrain);
+				samplesToNextGrain += fmax(1.0, grainInterval * (1.0 + 0.5 * grainSpray * noiseGenerator.doWhiteNoise()));
+			}
+			samplesToNextGrain -= (double)samples;
+		}
+
+		// --- nothing playing: flag the silent block so consumers can skip it
+		if (activeGrainCount == 0 || !hannTable)
+		{
+			memset(leftOutBuffer, 0, samples * sizeof(float));
+			memset(rightOutBuffer, 0, samples * sizeof(float));
+			processInfo.outputSilenceFlags = ALL_CHANNELS_SILENT;
+
+			glideModulator->advanceClock(samples);
+			return true;
+		}
+
+		memset(leftOutBuffer, 0, samples * sizeof(float));
+		memset(rightOutBuffer, 0, samples * sizeof(float));
+
+		const SynthKernelTable& kernels = getSynthKernels();
+		uint32_t g = 0;
+		while (g < activeGrainCount)
+		{
+			Grain& grain = grains[activeGrains[g]];
+			uint32_t count = samples - grain.startOffset;
+			if (count > grain.samplesLeft)
+				count = grain.samplesLeft;
+
+			kernels.grainAccumulate(leftOutBuffer + grain.startOffset, rightOutBuffer + grain.startOffset, count,
+				grain.samples, grain.channels, grain.readIndex, grain.readInc,
+				hannTable, grain.windowPhase, grain.windowInc, grain.gainL, grain.gainR);
+
+			grain.readIndex += count * grain.readInc;
+			grain.windowPhase += count * grain.windowInc;
+			grain.samplesLeft -= count;
+			grain.startOffset = 0;
+
+			// --- finished: back to the free list; the last active grain takes this slot
+			if (grain.samplesLeft == 0)
+			{
+				freeGrains[freeGrainCount++] = activeGrains[g];
+				activeGrains[g] = activeGrains[--activeGrainCount];
+			}
+			else
+				g++;
+		}
+
+		// --- advance the glide modulator
+		glideModulator->advanceClock(samples);
+
+		// --- rendered
+		return true;
+	}
+
+	/**
+	\brief Note-on handler for the ModuleCore
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- MIDI note information is accessed via processInfo.noteEvent
+
+	Core Specific:
+	- saves MIDI pitch for modulation calculation in update() function
+	- the first grain starts with the note; grains of the previous note play out
+
+	\param processInfo is the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool GranularCore::doNoteOn(CoreProcData& processInfo)
+	{
+		midiPitch = processInfo.noteEvent.midiPitch;
+		samplesToNextGrain = 0.0;
+		noteActive = true;
+
+		return true;
+	}
+
+	/**
+	\brief Note-off handler for the ModuleCore
+	- parameters are accessed via the processInfo.moduleParameters pointer
+	- MIDI note information is accessed via processInfo.noteEvent
+
+	Core Specific:
+	- nothing to do; grains keep spawning through the release and the voice's EG fades them
+
+	\param processInfo is the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	bool GranularCore::doNoteOff(CoreProcData& processInfo)
+	{
+		return true;
+	}
+
+	/**
+	\brief Query the database and add a set of PCM samples if not existing already
+
+	\param sampleDirectory folder full of folders of samples
+	\param sampleName name of sub-folder with set of PCM samples
+	\param processInfo the thunk-barrier compliant data structure for passing all needed parameters
+
+	\returns true if successful, false otherwise
+	*/
+	void GranularCore::checkAddSampleSet(std::string sampleDirectory,
+										 std::string sampleName,
+										 CoreProcData& processInfo,
+										 uint32_t index)
+	{
+		// --- there is one and only one PCM source per waveform "patch" or "sample"
+		if (index >= MODULE_STRINGS) return;
+
+		// --- try to find the source, if not existing add it
+		if (!processInfo.sampleDatabase->getSampleSource(sampleName.c_str()))
+		{
+			pcmSources[index].init(sampleDirectory.c_str(), sampleName.c_str(), processInfo.sampleRate);
+			pcmSources[index].setSampleLoopMode(SampleLoopMode::loop);
+			processInfo.sampleDatabase->addSampleSource(sampleName.c_str(), &pcmSources[index]);
+		}
+	}
+
+} // namespace
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "synthbase.h"
+#include "synthfunctions.h"
+#include "synthlabpcmsource.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   granularcore.h
+\author Will Pirkle
+\brief  See also Designing Software Synthesizers in C++ 2nd Ed. by Will Pirkle
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Constants for the granular PCM core
+	*/
+	const uint32_t GRAIN_POOL_SIZE = 256;			///< grains that can overlap in one voice; spawns are dropped when all are busy
+	const double GRAIN_MIN_DENSITY = 1.0;			///< grains per second with the Density knob at 0
+	const double GRAIN_MAX_DENSITY = 500.0;			///< grains per second with the Density knob at 1
+	const double GRAIN_MIN_SIZE_MSEC = 10.0;		///< grain length with the Size knob at 0
+	const double GRAIN_MAX_SIZE_MSEC = 500.0;		///< grain length with the Size knob at 1
+	const uint32_t GRAIN_MIN_SAMPLES = 16;			///< shorter grains are not spawned
+	//@}
+
+	/**
+	\struct Grain
+	\ingroup SynthStructures
+	\brief
+	One grain of the granular core's pool: a Hann windowed, linearly interpolated read of
+	the sample buffer that was selected when the grain was spawned
+	- the read range is checked at spawn time, so rendering needs no bounds checks
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct Grain
+	{
+		const float* samples = nullptr;	///< sample buffer, interleaved if stereo
+		uint32_t channels = 1;			///< 1 or 2
+		uint32_t samplesLeft = 0;		///< grain samples still to render
+		uint32_t startOffset = 0;		///< sample offset of the grain onset in the current block
+		double readIndex = 0.0;			///< frame read location
+		double readInc = 0.0;			///< frames per output sample (pitch)
+		double windowPhase = 0.0;		///< Hann table read location
+		double windowInc = 0.0;			///< Hann table increment per output sample
+		float gainL = 0.0f;				///< left gain, with pan
+		float gainR = 0.0f;				///< right gain, with pan
+	};
+
+	/**
+	\class GranularCore
+	\ingroup ModuleCores
+	\brief
+	Granular PCM oscillator: plays overlapping windowed grains read from the PCM sample
+	database, pitched to the note
+	- draws from the same sample sets as the MellotronCore (and registers them if that core
+	has not), selecting the multi-sample for the note like the other PCM cores
+	- the grains live in a fixed pool of GRAIN_POOL_SIZE; spawning takes a free slot and
+	never allocates
+	- grains are windowed with the shared Hann LUT (BasicLookupTables) and added into the
+	output with the bound grainAccumulate kernel (see synthkernels.h) so they run in SIMD lanes
+	- grain onsets are scheduled at sample accuracy: the onset clock is fractional and the
+	grains that start inside a block start at their sample offset, not at the block boundary
+
+	Base Class: ModuleCore
+	- Overrides the five (5) common functions plus a special getParameters() method to
+	return a shared pointer to the parameters structure.
+	- NOTE: These functions have identical names as the SynthModules that own them,
+	however the arguments are different. ModuleCores use the CoreProcData structure
+	for passing arguments into the cores because they are thunk-barrier compliant.
+	- This means that the owning SynthModule must prepare this structure and populate it prior to
+	function calls. The large majority of this preparation is done in the SynthModule constructor
+	and is one-time in nature.
+
+	GUI Parameters: PCMOscParameters
+	- GUI parameters are delivered into the core via the thunk-barrier compliant CoreProcData
+	argument that is passed into each function identically
+	- processInfo.moduleParameters contains a void* version of the GUI parameter structure pointer
+	- the Core function casts the GUI parameter pointer prior to usage
+
+	Access to Modulators is done via the thunk-barrier compliant CoreProcData argument
+	- processInfo.modulationInputs
+	- processInfo.modulationOutputs
+
+	Access to audio buffers (I/O/FM) is done via the thunk-barrier compliant CoreProcData argument
+	- processInfo.inputBuffers
+	- processInfo.outputBuffers
+	- processInfo.fmBuffers
+
+	Construction: Cores follow the same construction pattern
+	- set the Module type and name parameters
+	- expose the 16 module strings
+	- expose the 4 mod knob label strings
+	- intialize any internal variables
+
+	Standalone Mode:
+	- These objects are designed to be internal members of the outer SynthModule that owns them.
+	They may be used in standalone mode without modification, and you will use the CoreProcData
+	structure to pass information into the functions.
+
+	Module Strings, zero-indexed for your GUI Control:
+	- Cello, Choir, M300_Brass, M300A, M300B, MK2_Brass, MK2_Flute, MK2_Violins, String_Section, Woodwinds
+
+	ModKnob Strings, for fixed GUI controls by index constant
+	- MOD_KNOB_A = "Density" grains per second, 1 -> 500 (exponential)
+	- MOD_KNOB_B = "Size" grain length, 10 -> 500 mSec (exponential)
+	- MOD_KNOB_C = "Position" grain start location in the sample, 0 -> 1
+	- MOD_KNOB_D = "Spray" random position, onset time and pan of each grain
+
+	Render:
+	- renders into the output buffer using pointers in the CoreProcData argument to the render function
+	- renders one block of audio per render cycle
+	- renders in stereo; stereo samples keep their channels, mono samples are panned per grain
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class GranularCore : public MemoryAccounted<GranularCore, ModuleCore>
+	{
+	public:
+		/** simple default constructor */
+		GranularCore();				/* C-TOR */
+
+		/** Destructor is empty: all resources are smart pointers */
+		virtual ~GranularCore() {}		/* D-TOR */
+
+		/** ModuleCore Overrides */
+		virtual bool reset(CoreProcData& processInfo) override;
+		virtual bool update(CoreProcData& processInfo) override;
+		virtual bool render(CoreProcData& processInfo) override;
+		virtual bool doNoteOn(CoreProcData& processInfo) override;
+		virtual bool doNoteOff(CoreProcData& processInfo) override;
+
+		/** grains playing at the end of the last block, and spawns dropped because the pool was full */
+		uint32_t getActiveGrainCount() { return activeGrainCount; }
+		uint32_t getDroppedGrainCount() { return droppedGrains; }
+
+	protected:
+		/** start a grain at a sample offset in the current block; false if the pool is full */
+		bool spawnGrain(uint32_t startOffset);
+
+		// --- local variables
+		double sampleRate = 0.0;		///< sample rate
+		double midiPitch = 0.0;			///< the midi pitch
+		double outputAmplitude = 1.0;	///< amplitude in dB
+		double panLeftGain = 0.707;		///< left channel gain
+		double panRightGain = 0.707;	///< right channel gain
+		double panValue = 0.0;			///< pan of the module, -1 -> +1
+
+		// --- grain parameters, from update( )
+		double grainInterval = 0.0;		///< samples between onsets
+		uint32_t grainLength = 0;		///< samples per grain
+		double grainPosition = 0.0;		///< start location, 0 -> 1
+		double grainSpray = 0.0;		///< randomness, 0 -> 1
+		double grainGain = 1.0;			///< normalizes the overlap
+		double phaseInc = 0.0;			///< frames per output sample for the note
+		PCMSampleData selectedSample;	///< buffer of the selected multi-sample
+
+		// --- scheduling
+		double samplesToNextGrain = 0.0;	///< fractional onset clock
+		bool noteActive = false;			///< spawn only while the note is on
+
+		// --- the pool
+		Grain grains[GRAIN_POOL_SIZE];				///< fixed storage
+		uint32_t activeGrains[GRAIN_POOL_SIZE] = { 0 };	///< indexes of the playing grains
+		uint32_t freeGrains[GRAIN_POOL_SIZE] = { 0 };	///< stack of free indexes
+		uint32_t activeGrainCount = 0;				///< playing
+		uint32_t freeGrainCount = 0;				///< free
+		uint32_t droppedGrains = 0;					///< spawns that found the pool full
+
+		// --- shared Hann LUT
+		const double* hannTable = nullptr;	///< DEFAULT_LUT_LENGTH points, 0 at both ends
+
+		// --- grain randomness
+		NoiseGenerator noiseGenerator;
+
+		// --- unit3
+		uint32_t currentIndex = 0;		///< must persist from update to render
+
+		// --- PCM sample source
+		IPCMSampleSource* selectedSampleSource = nullptr; ///< selected PCM sample
+
+		// --- PCM sources; these are used to register the samples with the database
+		//     if the samples already exist, these won't be used. Notice that the update() function
+		//     ONLY uses PCM sources from the database!
+		SynthLabPCMSource pcmSources[MODULE_STRINGS];
+
+		// --- helper function
+		void checkAddSampleSet(std::string sampleDirectory, std::string sampleName, CoreProcData& processInfo, uint32_t index);
+	};
+
+} // namespace
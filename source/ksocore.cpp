@@ -51,6 +51,19 @@ namespace SynthLab
 		coreData.modKnobStrings[MOD_KNOB_D]	= "Pluck Pos";
 	}
 
+	/**
+	\brief Memory accounting: adds the resonator's delay line to the core's report
+
+	\param report the node for this core
+	*/
+	void KSOCore::getMemoryReport(MemoryReport& report)
+	{
+		ModuleCore::getMemoryReport(report);
+		uint64_t bytes = resonator.getAllocatedBytes();
+		report.ownedBytes += bytes;
+		report.residentBytes += estimateResidentBytes(bytes);
+	}
+
 	/**
 	\brief Resets object to initialized state
 	- parameters are accessed via the processInfo.moduleParameters pointer
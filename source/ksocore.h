@@ -88,7 +88,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class KSOCore : public ModuleCore
+	class KSOCore : public MemoryAccounted<KSOCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -96,6 +96,7 @@ namespace SynthLab
 		
 		/** Destructor is empty: all resources are smart pointers */
 		virtual ~KSOCore() {}		/* D-TOR */
+		virtual void getMemoryReport(MemoryReport& report) override;
 
 		/** ModuleCore Overrides */
 		virtual bool reset(CoreProcData& processInfo) override;
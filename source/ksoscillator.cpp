@@ -16,7 +16,7 @@ namespace SynthLab
 	KSOscillator::KSOscillator(std::shared_ptr<MidiInputData> _midiInputData,
 		std::shared_ptr<KSOscParameters> _parameters,
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -77,25 +77,13 @@ namespace SynthLab
 
 	bool KSOscillator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		coreProcessData.unisonStartPhase = unisonStartPhase; 
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	bool KSOscillator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 
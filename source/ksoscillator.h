@@ -101,7 +101,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class KSOscillator : public SynthModule
+	class KSOscillator : public MemoryAccounted<KSOscillator, SynthModule>
 	{
 	public:
 		// --- constructor/destructor
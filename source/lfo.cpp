@@ -29,7 +29,7 @@ namespace SynthLab
 	SynthLFO::SynthLFO(std::shared_ptr<MidiInputData> _midiInputData, 
 		std::shared_ptr<LFOParameters> _parameters, 
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{	
 		// --- for standalone operation
@@ -50,11 +50,9 @@ namespace SynthLab
 		// --- setup the cores
 		if (midiInputData->getAuxDAWDataUINT(kDMBuild) == 0)
 		{
-			std::shared_ptr<LFOCore> classicCore = std::make_shared<LFOCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(classicCore));
-
-			std::shared_ptr<FMLFOCore> fmCore = std::make_shared<FMLFOCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(fmCore));
+			// --- cores are built on first selection
+			addModuleCoreFactory(createModuleCore<LFOCore>, 0, "ClassicLFO");
+			addModuleCoreFactory(createModuleCore<FMLFOCore>, 1, "FM-LFO");
 		}
 	}
 
@@ -114,35 +112,24 @@ namespace SynthLab
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool SynthLFO::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool SynthLFO::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 } // namespace
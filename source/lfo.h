@@ -101,7 +101,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class SynthLFO : public SynthModule
+	class SynthLFO : public MemoryAccounted<SynthLFO, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
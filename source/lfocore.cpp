@@ -23,8 +23,7 @@ namespace SynthLab
 	- intialize any internal variables
 
 	Core Specific:
-	- creates new lookup table, which are compact in nature
-	(no reason to share the resource)
+	- binds the shared lookup tables; they are read-only so one copy serves every LFO
 
 	\returns the newly constructed object
 	*/
@@ -34,7 +33,7 @@ namespace SynthLab
 		moduleName = "ClassicLFO";
 		preferredIndex = 0; // ordering for user
 
-		lookupTables.reset(new(BasicLookupTables));
+		lookupTables = &BasicLookupTables::getSharedTables();
 
 		// --- our LFO waveforms //"clip sine";//
 		/*
@@ -58,6 +57,20 @@ namespace SynthLab
 
 	}
 
+	/**
+	\brief Memory accounting: adds the shared lookup tables to the core's report (as shared)
+
+	\param report the node for this core
+	*/
+	void LFOCore::getMemoryReport(MemoryReport& report)
+	{
+		ModuleCore::getMemoryReport(report);
+		if (lookupTables)
+		{
+			report.sharedBytes += lookupTables->getAllocatedBytes();
+		}
+	}
+
 	/**
 	\brief Resets object to initialized state
 	- parameters are accessed via the processInfo.moduleParameters pointer
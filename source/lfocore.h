@@ -89,7 +89,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class LFOCore : public ModuleCore
+	class LFOCore : public MemoryAccounted<LFOCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -97,6 +97,7 @@ namespace SynthLab
 		
 		/** Destructor is empty: all resources are smart pointers */
 		virtual ~LFOCore() {}	/* D-TOR */
+		virtual void getMemoryReport(MemoryReport& report) override;
 
 		/** ModuleCore Overrides */
 		virtual bool reset(CoreProcData& processInfo) override;
@@ -106,7 +107,7 @@ namespace SynthLab
 		virtual bool doNoteOff(CoreProcData& processInfo) override;
 
 	protected:
-		std::unique_ptr<BasicLookupTables> lookupTables = nullptr; ///< LUTs for some waveforms
+		const BasicLookupTables* lookupTables = nullptr; ///< LUTs for some waveforms; the shared, read-only instance
 
 		// --- sample rate
 		double sampleRate = 0.0;			///< sample rate
@@ -80,7 +80,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class LinearEGCore : public ModuleCore
+	class LinearEGCore : public MemoryAccounted<LinearEGCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -82,7 +82,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class MellotronCore : public ModuleCore
+	class MellotronCore : public MemoryAccounted<MellotronCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -49,6 +49,10 @@ namespace SynthLab
 		void clearModMatrixArrays();
 		void runModMatrix();
 
+		/** bound source/destination pointers, for analyzing the routing; may be nullptr */
+		double* getModSourcePtr(uint32_t sourceArrayIndex) { return sourceArrayIndex < kNumberModSources ? modSourceData[sourceArrayIndex] : nullptr; }
+		double* getModDestinationPtr(uint32_t destArrayIndex) { return destArrayIndex < kNumberModDestinations ? modDestinationData[destArrayIndex] : nullptr; }
+
 		/** for standalone operation only */
 		std::shared_ptr<ModMatrixParameters> getParameters() { return parameters; }
 
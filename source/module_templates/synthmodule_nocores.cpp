@@ -26,7 +26,7 @@ namespace SynthLab
 	SynthModuleNoCores::SynthModuleNoCores(std::shared_ptr<MidiInputData> _midiInputData,
 		std::shared_ptr<SynthModuleNoCoresParameters> _parameters,
 		uint32_t blockSize) :
-		SynthModule(_midiInputData)
+		MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
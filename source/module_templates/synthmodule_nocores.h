@@ -96,7 +96,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class SynthModuleNoCores : public SynthModule
+	class SynthModuleNoCores : public MemoryAccounted<SynthModuleNoCores, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
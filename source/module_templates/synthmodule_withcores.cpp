@@ -27,7 +27,7 @@ namespace SynthLab
 	SynthModuleWithCores::SynthModuleWithCores(std::shared_ptr<MidiInputData> _midiInputData,
 		std::shared_ptr<SynthModuleWithCores> _parameters,
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -49,6 +49,10 @@ namespace SynthLab
 		//
 		//     std::shared_ptr<OscCore> defaultCore = std::make_shared<OscCore>();
 		//     addModuleCore(std::static_pointer_cast<ModuleCore>(defaultCore));
+		//
+		//     or, to defer construction until the core is needed:
+		//
+		//     addModuleCoreFactory(createModuleCore<OscCore>, 0, "OscCore");
 
 
 		// --- core[0]
@@ -110,36 +114,24 @@ namespace SynthLab
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool SynthModuleWithCores::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		coreProcessData.unisonStartPhase = unisonStartPhase;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool SynthModuleWithCores::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 
@@ -100,7 +100,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class SynthModuleWithCores : public SynthModule
+	class SynthModuleWithCores : public MemoryAccounted<SynthModuleWithCores, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -213,27 +213,10 @@ namespace SynthLab
 		// --- calculate mix values
 		calculateConstPwrMixValues(bipolar(morphFraction), mixValue0, mixValue1);
 
-		// --- select the pair of tables for morph
-		if (currentWaveIndex != parameters->waveIndex)
-		{
-			// --- try to get with index values (fastest)
-			selectedTableSource[0] = processInfo.wavetableDatabase->getTableSource(morphBankData[parameters->waveIndex].tableIndexes[table0]);
-			selectedTableSource[1] = processInfo.wavetableDatabase->getTableSource(morphBankData[parameters->waveIndex].tableIndexes[table1]);
-			currentWaveIndex = parameters->waveIndex;
-		}
-		else
-		{
-			if (table0 != currentTable0)
-			{
-				selectedTableSource[0] = processInfo.wavetableDatabase->getTableSource(morphBankData[parameters->waveIndex].tableIndexes[table0]);
-				currentTable0 = table0;
-			}
-			if (table1 != currentTable1)
-			{
-				selectedTableSource[1] = processInfo.wavetableDatabase->getTableSource(morphBankData[parameters->waveIndex].tableIndexes[table1]);
-				currentTable1 = table1;
-			}
-		}
+		// --- select the pair of tables for morph by index, lock-free; every update, so that a
+		//     source replaced at runtime (an imported wavetable) is picked up
+		selectedTableSource[0] = processInfo.wavetableDatabase->getTableSource(morphBankData[parameters->waveIndex].tableIndexes[table0]);
+		selectedTableSource[1] = processInfo.wavetableDatabase->getTableSource(morphBankData[parameters->waveIndex].tableIndexes[table1]);
 
 		if (morphMod != lastMorphMod)
 			lastMorphMod = morphMod;
@@ -437,7 +420,6 @@ namespace SynthLab
 
 		table0last = -1;
 		table1last = -1;
-		currentWaveIndex = -1;
 		return true;
 	}
 
@@ -486,6 +468,28 @@ namespace SynthLab
 		}
 	}
 
+	/**
+	\brief Residency: the module strings are bank names, so add every table of every bank 
+	using the unique indexes that were found when the banks were added
+
+	\param sources the list to add to
+	\param processInfo is the thunk-barrier compliant data structure for passing all needed parameters
+	*/
+	void MorphWTCore::addReachableSources(ReachableSources& sources, CoreProcData& processInfo)
+	{
+		if (!processInfo.wavetableDatabase)
+			return;
+
+		for (uint32_t bank = 0; bank < MODULE_STRINGS; bank++)
+		{
+			for (uint32_t i = 0; i < morphBankData[bank].numTables && i < MODULE_STRINGS; i++)
+			{
+				if (morphBankData[bank].tableIndexes[i] >= 0)
+					sources.addWavetableSource(processInfo.wavetableDatabase->getTableSource((uint32_t)morphBankData[bank].tableIndexes[i]));
+			}
+		}
+	}
+
 	/**
 	\brief Calls the querying function to check and add a new wavebank (set of wavetables)
 
@@ -526,8 +530,9 @@ namespace SynthLab
 		{
 			tableSource->addSynthLabTableSet(&slTableSet);
 
+			// --- another core may have added it first
 			if (!processInfo.wavetableDatabase->addTableSource(slTableSet.waveformName, tableSource, uniqueIndex))
-				return -1; // could not add should never happen
+				return processInfo.wavetableDatabase->getWaveformIndex(slTableSet.waveformName);
 
 			return uniqueIndex;
 		}
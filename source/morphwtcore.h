@@ -83,7 +83,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class MorphWTCore : public ModuleCore
+	class MorphWTCore : public MemoryAccounted<MorphWTCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -98,6 +98,7 @@ namespace SynthLab
 		virtual bool render(CoreProcData& processInfo) override;
 		virtual bool doNoteOn(CoreProcData& processInfo) override;
 		virtual bool doNoteOff(CoreProcData& processInfo) override;
+		virtual void addReachableSources(ReachableSources& sources, CoreProcData& processInfo) override;
 
 		/** Render helper functions */
 		double renderSample(SynthClock& clock); ///< render a sample
@@ -112,9 +113,6 @@ namespace SynthLab
 		double panLeftGain = 0.707;		///< left channel gain
 		double panRightGain = 0.707;	///< right channel gain
 		double hardSyncRatio = 1.0;		///< hard sync ratio with modulators applied
-		int32_t currentWaveIndex = -1;  ///< to minimize dictionary (map) lookup iterating
-		int32_t currentTable0 = -1;		///< to minimize dictionary (map) lookup iterating
-		int32_t currentTable1 = -1;		///< to minimize dictionary (map) lookup iterating
 		
 		// --- const power summing:
 		double mixValue0 = 0.0;
@@ -95,7 +95,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class NoiseOscillator : public SynthModule
+	class NoiseOscillator : public MemoryAccounted<NoiseOscillator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -103,7 +103,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class Oscillator : public SynthModule
+	class Oscillator : public MemoryAccounted<Oscillator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -104,6 +104,10 @@ namespace SynthLab
 			checkAddSampleSet(sampleFile.c_str(), coreData.moduleStrings[i], processInfo, i);
 		}
 
+		// --- index every set (also those another core added) for the lock-free lookup in update()
+		for (uint32_t i = 0; i < MODULE_STRINGS; i++)
+			coreData.uniqueIndexes[i] = processInfo.sampleDatabase->getSampleSetIndex(coreData.moduleStrings[i]);
+
 		// --- select first one
 		currentIndex = 0;
 		selectedSampleSource = processInfo.sampleDatabase->getSampleSource(coreData.moduleStrings[currentIndex]);
@@ -165,13 +169,10 @@ namespace SynthLab
 		// --- BOUND the value to our range - in theory, we would bound this to any NYQUIST
 		boundValue(oscillatorFrequency, PCM_OSC_MIN, PCM_OSC_MAX);
 
-		// --- select the sample source by unique name
-		//
-		// --- this is a map lookup, so the current index is saved as this value won't change often
+		// --- select the sample source by its index, found at reset; lock-free
 		if (currentIndex != parameters->waveIndex)
 		{
-			const char* wave = coreData.moduleStrings[parameters->waveIndex];
-			selectedSampleSource = processInfo.sampleDatabase->getSampleSource(wave);
+			selectedSampleSource = processInfo.sampleDatabase->getSampleSource((uint32_t)coreData.uniqueIndexes[parameters->waveIndex]);
 			currentIndex = parameters->waveIndex;
 		}
 
@@ -216,6 +217,17 @@ namespace SynthLab
 		float* leftOutBuffer = processInfo.outputBuffers[LEFT_CHANNEL];
 		float* rightOutBuffer = processInfo.outputBuffers[RIGHT_CHANNEL];
 
+		// --- no sample, or one-shot has ended: flag the silent block so consumers can skip it
+		if (!selectedSampleSource || readIndex < 0.0)
+		{
+			memset(leftOutBuffer, 0, processInfo.samplesToProcess * sizeof(float));
+			memset(rightOutBuffer, 0, processInfo.samplesToProcess * sizeof(float));
+			processInfo.outputSilenceFlags = ALL_CHANNELS_SILENT;
+
+			glideModulator->advanceClock(processInfo.samplesToProcess);
+			return true;
+		}
+
 		for (uint32_t i = 0; i < processInfo.samplesToProcess; i++)
 		{
 			// --- read and output samples
@@ -83,7 +83,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class LegacyPCMCore : public ModuleCore
+	class LegacyPCMCore : public MemoryAccounted<LegacyPCMCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
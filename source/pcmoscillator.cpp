@@ -28,7 +28,7 @@ namespace SynthLab
 		std::shared_ptr<PCMOscParameters> _parameters,
 		std::shared_ptr<PCMSampleDatabase> _sampleDatabase,
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- create our audio buffers
@@ -56,14 +56,12 @@ namespace SynthLab
 		// --- setup the cores
 		if (midiInputData->getAuxDAWDataUINT(kDMBuild) == 0)
 		{
-			std::shared_ptr<LegacyPCMCore> defaultCore = std::make_shared<LegacyPCMCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(defaultCore));
-
-			std::shared_ptr<MellotronCore> mellotron = std::make_shared<MellotronCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(mellotron));
-
-			std::shared_ptr<WaveSliceCore> slicedLoops = std::make_shared<WaveSliceCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(slicedLoops));
+			// --- cores are built on first selection; this also defers loading
+			//     their WAV files until a core is actually used
+			addModuleCoreFactory(createModuleCore<LegacyPCMCore>, 0, "Legacy");
+			addModuleCoreFactory(createModuleCore<MellotronCore>, 1, "Mellotron");
+			addModuleCoreFactory(createModuleCore<WaveSliceCore>, 2, "WaveSlices");
+			addModuleCoreFactory(createModuleCore<GranularCore>, 3, "Granular");
 		}
 	
 	}	/* C-TOR */
@@ -123,40 +121,33 @@ namespace SynthLab
 		update();
 		coreProcessData.samplesToProcess = samplesToProcess;
         if(!selectedCore) return false;
-        return selectedCore->render(coreProcessData);
+
+		// --- core may report a silent block (e.g. one-shot has ended)
+		coreProcessData.outputSilenceFlags = 0;
+		bool rendered = selectedCore->render(coreProcessData);
+		audioBuffers->setOutputSilenceFlags(coreProcessData.outputSilenceFlags);
+		return rendered;
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool PCMOscillator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		coreProcessData.unisonStartPhase = unisonStartPhase; 
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool PCMOscillator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 }
@@ -5,6 +5,7 @@
 #include "pcmlegacycore.h"
 #include "mellotroncore.h"
 #include "waveslicecore.h"
+#include "granularcore.h"
 
 // -----------------------------
 //	--- SynthLab SDK File --- // 
@@ -36,7 +37,7 @@ namespace SynthLab
 	1. MellotronCore free (and long) samples from Mellotron tape-based synth
 	2. WaveSliceCore uses slices of waveforms that are made with the aubio software tools
 	(or any other slicing app). 
-	3. --- EMPTY --- (note: there is an unused drumloops folder in the SynthLabSamples directory - use it!)
+	3. GranularCore plays overlapping windowed grains of the Mellotron samples
 
 	Base Class: SynthModule
 	- Overrides the five (5) common functions plus a special getParameters() method to
@@ -117,7 +118,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class PCMOscillator : public SynthModule
+	class PCMOscillator : public MemoryAccounted<PCMOscillator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
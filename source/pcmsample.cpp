@@ -190,10 +190,7 @@ namespace SynthLab
 			}
 
 			// convet to float -1.0 -> +1.0
-			for (uint32_t i = 0; i < nSampleCount; i++)
-			{
-				pcmSampleBuffer[i] = ((float)pShorts[i]) / 32768.f;
-			}
+			getSynthKernels().int16ToFloat(pcmSampleBuffer, pShorts, nSampleCount);
 
 			delete[] pShorts;
             sampleLoaded = true;
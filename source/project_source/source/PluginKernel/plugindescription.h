@@ -0,0 +1,52 @@
+// --- CMAKE generated variables for your plugin
+
+#include "pluginstructures.h"
+
+#ifndef _plugindescription_h
+#define _plugindescription_h
+
+#define QUOTE(name) #name
+#define STR(macro) QUOTE(macro)
+#define AU_COCOA_VIEWFACTORY_STRING STR(AU_COCOA_VIEWFACTORY_NAME)
+#define AU_COCOA_VIEW_STRING STR(AU_COCOA_VIEW_NAME)
+
+// --- AU Plugin Cocoa View Names (flat namespace) 
+#define AU_COCOA_VIEWFACTORY_NAME AUCocoaViewFactory_C93FB995FBF13E05AE237845E4031E5C
+#define AU_COCOA_VIEW_NAME AUCocoaView_C93FB995FBF13E05AE237845E4031E5C
+
+// --- BUNDLE IDs (MacOS Only) 
+const char* kAAXBundleID = "developer.aax.synthlabtestii.bundleID";
+const char* kAUBundleID = "developer.au.synthlabtestii.bundleID";
+const char* kVST3BundleID = "developer.vst3.synthlabtestii.bundleID";
+
+// --- Plugin Names 
+const char* kPluginName = "SynthLabWT";
+const char* kShortPluginName = "SynthLabWT";
+const char* kAUBundleName = "SynthLabTestII";
+
+// --- Plugin Type 
+const pluginType kPluginType = pluginType::kSynthPlugin;
+
+// --- VST3 UUID 
+const char* kVSTFUID = "{c93fb995-fbf1-3e05-ae23-7845e4031e5c}";
+
+// --- 4-char codes 
+const int32_t kFourCharCode = 'syl2';
+const int32_t kAAXProductID = 'syl2';
+const int32_t kManufacturerID = 'WILL';
+
+// --- Vendor information 
+const char* kVendorName = "RackAFX User";
+const char* kVendorURL = "www.yourcompany.com";
+const char* kVendorEmail = "yourname@yourcompany.com";
+
+// --- Plugin Options 
+const bool kWantSidechain = false;
+const uint32_t kLatencyInSamples = 0;
+const double kTailTimeMsec = 0.000000;
+const bool kVSTInfiniteTail = false;
+const bool kVSTSAA = false;
+const uint32_t kVST3SAAGranularity = 1;
+const uint32_t kAAXCategory = aaxPlugInCategory_None;
+
+#endif
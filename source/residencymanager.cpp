@@ -0,0 +1,529 @@
+#include "residencymanager.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#if defined _WIN32 || defined _WIN64
+	#include <windows.h>
+	#include <psapi.h>
+	#if defined(_MSC_VER)
+		#pragma comment(lib, "psapi.lib")
+	#endif
+#else
+	#include <sys/mman.h>
+	#include <sys/resource.h>
+	#include <unistd.h>
+#endif
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   residencymanager.cpp
+\author Will Pirkle
+\brief  Keeps the wavetables and PCM samples of the active patch resident in memory
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	// --- process-wide lock counts per page: the OS lock is not counted, so a page that several
+	//     managers lock (tables shared between engines) is only unlocked by the last one
+	static std::mutex& getPageLockMutex()
+	{
+		static std::mutex pageLockMutex;
+		return pageLockMutex;
+	}
+
+	static std::unordered_map<uintptr_t, uint32_t>& getPageLockCounts()
+	{
+		static std::unordered_map<uintptr_t, uint32_t> pageLockCounts;
+		return pageLockCounts;
+	}
+
+	/**
+	\brief
+	Destruction: unlocks everything this object locked
+	*/
+	ResidencyManager::~ResidencyManager()
+	{
+		releaseAll();
+	}
+
+	/**
+	\brief
+	Makes the sources of the active patch resident:
+	- prefaults every page of every reachable source
+	- locks them if locking is enabled; pages that are already locked are not locked again
+	- unlocks pages that are no longer reachable (or all pages, if locking was turned off)
+	- releases pages that were resident after the last update but are no longer reachable
+	- NOT real-time safe
+
+	\param sources the tables and samples that the active patch can read
+
+	\return true if sucessful, false if any range could not be locked
+	*/
+	bool ResidencyManager::updateResidency(ReachableSources& sources)
+	{
+		stats = ResidencyStats();
+		stats.wavetableSources = (uint32_t)sources.wavetableSources.size();
+		stats.sampleSources = (uint32_t)sources.sampleSources.size();
+
+		// --- page ranges of everything reachable
+		PageRangeList reachableRanges = getSourceRanges(sources);
+
+		// --- prefault
+		for (const PageRange& range : reachableRanges)
+			prefaultRange(range);
+		stats.residentBytes = getRangeBytes(reachableRanges);
+
+		// --- unlock what is no longer needed
+		PageRangeList unlockRanges = subtractRanges(lockedRanges, lockPages ? reachableRanges : PageRangeList());
+		for (const PageRange& range : unlockRanges)
+			unlockRange(range);
+		lockedRanges = subtractRanges(lockedRanges, unlockRanges);
+
+		// --- lock what is new
+		bool success = true;
+		if (lockPages)
+		{
+			PageRangeList newRanges = subtractRanges(reachableRanges, lockedRanges);
+			for (const PageRange& range : newRanges)
+			{
+				if (lockRange(range))
+					lockedRanges.push_back(range);
+				else
+				{
+					stats.lockFailures++;
+					success = false;
+				}
+			}
+			mergeRanges(lockedRanges);
+		}
+		stats.lockedBytes = getRangeBytes(lockedRanges);
+
+		// --- release what is no longer reachable
+		PageRangeList releaseRanges = subtractRanges(residentRanges, reachableRanges);
+		for (const PageRange& range : releaseRanges)
+			releaseRange(range);
+		stats.releasedBytes = getRangeBytes(releaseRanges);
+
+		residentRanges = reachableRanges;
+		return success;
+	}
+
+	/**
+	\brief
+	Makes more sources resident without releasing any:
+	- used while preparing a patch in the background, so its tables are resident before
+	the audio thread switches to it while the current patch's tables stay resident too
+	- the statistics are not changed; the next updateResidency( ) trims back to the active patch
+	- NOT real-time safe
+
+	\param sources the tables and samples to add
+
+	\return true if sucessful, false if any range could not be locked
+	*/
+	bool ResidencyManager::addResidency(ReachableSources& sources)
+	{
+		PageRangeList ranges = getSourceRanges(sources);
+		for (const PageRange& range : ranges)
+			prefaultRange(range);
+
+		bool success = true;
+		if (lockPages)
+		{
+			PageRangeList newRanges = subtractRanges(ranges, lockedRanges);
+			for (const PageRange& range : newRanges)
+			{
+				if (lockRange(range))
+					lockedRanges.push_back(range);
+				else
+					success = false;
+			}
+			mergeRanges(lockedRanges);
+		}
+
+		residentRanges.insert(residentRanges.end(), ranges.begin(), ranges.end());
+		mergeRanges(residentRanges);
+		return success;
+	}
+
+	/**
+	\brief
+	Unlocks and releases everything; the data itself is never discarded
+	*/
+	void ResidencyManager::releaseAll()
+	{
+		for (const PageRange& range : lockedRanges)
+			unlockRange(range);
+		for (const PageRange& range : residentRanges)
+			releaseRange(range);
+
+		lockedRanges.clear();
+		residentRanges.clear();
+	}
+
+	/**
+	\brief
+	Adds the faults since beginRenderFaultCount( ) to the render totals
+	- real-time safe: one system call, no locks or allocations
+	*/
+	void ResidencyManager::endRenderFaultCount()
+	{
+		if (!countRenderFaults)
+			return;
+
+		PageFaultCounts faults = getPageFaultCounts();
+		renderMinorFaults.fetch_add(faults.minorFaults - renderStartFaults.minorFaults, std::memory_order_relaxed);
+		renderMajorFaults.fetch_add(faults.majorFaults - renderStartFaults.majorFaults, std::memory_order_relaxed);
+	}
+
+	/**
+	\return the faults taken while rendering since the last clearRenderFaults( )
+	*/
+	PageFaultCounts ResidencyManager::getRenderFaults()
+	{
+		PageFaultCounts faults;
+		faults.minorFaults = renderMinorFaults.load(std::memory_order_relaxed);
+		faults.majorFaults = renderMajorFaults.load(std::memory_order_relaxed);
+		return faults;
+	}
+
+	/**
+	\brief
+	Zeroes the render fault totals
+	*/
+	void ResidencyManager::clearRenderFaults()
+	{
+		renderMinorFaults.store(0, std::memory_order_relaxed);
+		renderMajorFaults.store(0, std::memory_order_relaxed);
+	}
+
+	/**
+	\return the current page fault counters of the calling thread, or the process
+	(see PageFaultCounts)
+	*/
+	PageFaultCounts ResidencyManager::getPageFaultCounts()
+	{
+		PageFaultCounts faults;
+#if defined _WIN32 || defined _WIN64
+		PROCESS_MEMORY_COUNTERS counters;
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			faults.minorFaults = counters.PageFaultCount;
+#else
+	#if defined(RUSAGE_THREAD)
+		const int who = RUSAGE_THREAD;
+	#else
+		const int who = RUSAGE_SELF;
+	#endif
+		struct rusage usage;
+		if (getrusage(who, &usage) == 0)
+		{
+			faults.minorFaults = (uint64_t)usage.ru_minflt;
+			faults.majorFaults = (uint64_t)usage.ru_majflt;
+		}
+#endif
+		return faults;
+	}
+
+	/**
+	\return the OS page size; queried once
+	*/
+	uint64_t ResidencyManager::getPageSize()
+	{
+		static const uint64_t pageSize = []()
+		{
+#if defined _WIN32 || defined _WIN64
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return (uint64_t)info.dwPageSize;
+#else
+			long size = sysconf(_SC_PAGESIZE);
+			return size > 0 ? (uint64_t)size : (uint64_t)4096;
+#endif
+		}();
+		return pageSize;
+	}
+
+	/**
+	\return the page ranges of all of the sources, sorted and merged
+	*/
+	ResidencyManager::PageRangeList ResidencyManager::getSourceRanges(ReachableSources& sources)
+	{
+		PageRangeList ranges;
+		MemoryRegionList regions;
+		for (IWavetableSource* source : sources.wavetableSources)
+		{
+			regions.clear();
+			source->getMemoryRegions(regions);
+			addRegions(ranges, regions);
+		}
+		for (IPCMSampleSource* source : sources.sampleSources)
+		{
+			regions.clear();
+			source->getMemoryRegions(regions);
+			addRegions(ranges, regions);
+		}
+		mergeRanges(ranges);
+		return ranges;
+	}
+
+	/**
+	\brief
+	Appends the regions as page-aligned ranges (not merged)
+
+	\param ranges the list to add to
+	\param regions the memory regions of a source
+	*/
+	void ResidencyManager::addRegions(PageRangeList& ranges, const MemoryRegionList& regions)
+	{
+		uintptr_t pageMask = (uintptr_t)getPageSize() - 1;
+		for (const MemoryRegion& region : regions)
+		{
+			if (!region.address || region.bytes == 0)
+				continue;
+
+			PageRange range;
+			range.start = (uintptr_t)region.address & ~pageMask;
+			range.end = ((uintptr_t)region.address + (uintptr_t)region.bytes + pageMask) & ~pageMask;
+			ranges.push_back(range);
+		}
+	}
+
+	/**
+	\brief
+	Sorts the ranges and merges any that overlap or touch
+
+	\param ranges the list to merge, in place
+	*/
+	void ResidencyManager::mergeRanges(PageRangeList& ranges)
+	{
+		if (ranges.size() < 2)
+			return;
+
+		std::sort(ranges.begin(), ranges.end(), [](const PageRange& a, const PageRange& b) { return a.start < b.start; });
+
+		size_t last = 0;
+		for (size_t i = 1; i < ranges.size(); i++)
+		{
+			if (ranges[i].start <= ranges[last].end)
+				ranges[last].end = std::max(ranges[last].end, ranges[i].end);
+			else
+				ranges[++last] = ranges[i];
+		}
+		ranges.resize(last + 1);
+	}
+
+	/**
+	\brief
+	Set difference of two sorted, merged lists
+
+	\param a the ranges to keep
+	\param b the ranges to remove from a
+
+	\return the parts of a that are not in b, sorted and merged
+	*/
+	ResidencyManager::PageRangeList ResidencyManager::subtractRanges(const PageRangeList& a, const PageRangeList& b)
+	{
+		PageRangeList result;
+		size_t j = 0;
+		for (PageRange range : a)
+		{
+			// --- skip b ranges that end before this one
+			while (j < b.size() && b[j].end <= range.start)
+				j++;
+
+			// --- cut out every b range that overlaps
+			size_t k = j;
+			while (k < b.size() && b[k].start < range.end)
+			{
+				if (b[k].start > range.start)
+				{
+					PageRange head;
+					head.start = range.start;
+					head.end = b[k].start;
+					result.push_back(head);
+				}
+				range.start = std::max(range.start, b[k].end);
+				k++;
+			}
+
+			if (range.start < range.end)
+				result.push_back(range);
+		}
+		return result;
+	}
+
+	/**
+	\return total bytes of a merged list
+	*/
+	uint64_t ResidencyManager::getRangeBytes(const PageRangeList& ranges)
+	{
+		uint64_t bytes = 0;
+		for (const PageRange& range : ranges)
+			bytes += (uint64_t)(range.end - range.start);
+		return bytes;
+	}
+
+	/**
+	\brief
+	Hints that the range will be needed, then reads one byte of every page so that any fault
+	happens here and not on the audio thread
+
+	\param range the page-aligned range
+	*/
+	void ResidencyManager::prefaultRange(const PageRange& range)
+	{
+#if !(defined _WIN32 || defined _WIN64)
+		posix_madvise((void*)range.start, (size_t)(range.end - range.start), POSIX_MADV_WILLNEED);
+#endif
+		uintptr_t pageSize = (uintptr_t)getPageSize();
+		volatile uint8_t sink = 0;
+		for (uintptr_t page = range.start; page < range.end; page += pageSize)
+			sink ^= *reinterpret_cast<const volatile uint8_t*>(page);
+		(void)sink;
+	}
+
+	/**
+	\brief
+	Locks the range into physical memory and counts the lock on each of its pages
+	- only pages that no manager in the process has locked yet are locked with the OS
+	- all or nothing: if any part fails to lock, the parts locked here are unlocked again
+
+	\param range the page-aligned range
+
+	\return true if sucessful
+	*/
+	bool ResidencyManager::lockRange(const PageRange& range)
+	{
+		std::lock_guard<std::mutex> lock(getPageLockMutex());
+		std::unordered_map<uintptr_t, uint32_t>& lockCounts = getPageLockCounts();
+		uintptr_t pageSize = (uintptr_t)getPageSize();
+
+		// --- runs of pages that are not locked yet
+		PageRangeList newRanges;
+		for (uintptr_t page = range.start; page < range.end; page += pageSize)
+		{
+			if (lockCounts.count(page))
+				continue;
+
+			if (!newRanges.empty() && newRanges.back().end == page)
+				newRanges.back().end = page + pageSize;
+			else
+			{
+				PageRange newRange;
+				newRange.start = page;
+				newRange.end = page + pageSize;
+				newRanges.push_back(newRange);
+			}
+		}
+
+		for (size_t i = 0; i < newRanges.size(); i++)
+		{
+			if (!lockPageRange(newRanges[i]))
+			{
+				for (size_t j = 0; j < i; j++)
+					unlockPageRange(newRanges[j]);
+				return false;
+			}
+		}
+
+		for (uintptr_t page = range.start; page < range.end; page += pageSize)
+			lockCounts[page]++;
+
+		return true;
+	}
+
+	/**
+	\brief
+	Removes this manager's lock from each page of a range that was locked with lockRange( );
+	pages that no other manager has locked are unlocked with the OS
+
+	\param range the page-aligned range
+	*/
+	void ResidencyManager::unlockRange(const PageRange& range)
+	{
+		std::lock_guard<std::mutex> lock(getPageLockMutex());
+		std::unordered_map<uintptr_t, uint32_t>& lockCounts = getPageLockCounts();
+		uintptr_t pageSize = (uintptr_t)getPageSize();
+
+		PageRange lastRange;
+		for (uintptr_t page = range.start; page < range.end; page += pageSize)
+		{
+			std::unordered_map<uintptr_t, uint32_t>::iterator it = lockCounts.find(page);
+			if (it == lockCounts.end() || --it->second > 0)
+				continue;
+			lockCounts.erase(it);
+
+			// --- gather runs of released pages into one call
+			if (lastRange.end == page)
+				lastRange.end = page + pageSize;
+			else
+			{
+				if (lastRange.start < lastRange.end)
+					unlockPageRange(lastRange);
+				lastRange.start = page;
+				lastRange.end = page + pageSize;
+			}
+		}
+		if (lastRange.start < lastRange.end)
+			unlockPageRange(lastRange);
+	}
+
+	/**
+	\brief
+	The OS lock on a range, not counted; see lockRange( )
+
+	\param range the page-aligned range
+
+	\return true if sucessful
+	*/
+	bool ResidencyManager::lockPageRange(const PageRange& range)
+	{
+#if defined _WIN32 || defined _WIN64
+		return VirtualLock((LPVOID)range.start, (SIZE_T)(range.end - range.start)) != 0;
+#else
+		return mlock((const void*)range.start, (size_t)(range.end - range.start)) == 0;
+#endif
+	}
+
+	/**
+	\brief
+	The OS unlock of a range, not counted; see unlockRange( )
+
+	\param range the page-aligned range
+	*/
+	void ResidencyManager::unlockPageRange(const PageRange& range)
+	{
+#if defined _WIN32 || defined _WIN64
+		VirtualUnlock((LPVOID)range.start, (SIZE_T)(range.end - range.start));
+#else
+		munlock((const void*)range.start, (size_t)(range.end - range.start));
+#endif
+	}
+
+	/**
+	\brief
+	Tells the OS that the range is cold so that it may be paged out first
+	- must never discard the data: the pages may be heap memory, or be shared with a
+	neighboring table, so the destructive MADV_DONTNEED/MADV_FREE are not used
+	- Linux 5.4+ uses MADV_COLD; elsewhere POSIX_MADV_DONTNEED, which is only a hint on macOS
+	and ignored by glibc; Windows has no non-destructive equivalent, the unlock is all there is
+
+	\param range the page-aligned range
+	*/
+	void ResidencyManager::releaseRange(const PageRange& range)
+	{
+#if defined _WIN32 || defined _WIN64
+		(void)range;
+#elif defined(MADV_COLD)
+		madvise((void*)range.start, (size_t)(range.end - range.start), MADV_COLD);
+#else
+		posix_madvise((void*)range.start, (size_t)(range.end - range.start), POSIX_MADV_DONTNEED);
+#endif
+	}
+
+} // namespace
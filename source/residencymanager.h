@@ -0,0 +1,158 @@
+#ifndef __residencyManager_h__
+#define __residencyManager_h__
+
+// --- includes
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+
+#include "synthbase.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   residencymanager.h
+\author Will Pirkle
+\brief  Keeps the wavetables and PCM samples of the active patch resident in memory so that
+the audio thread never takes a page fault on them
+- prefaults (touches every page, plus a WILLNEED hint) and optionally locks the pages
+- releases (unlocks and hints as cold) pages of tables and samples that are no longer reachable
+- counts the page faults taken while rendering, to prove that there are none
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\struct PageFaultCounts
+	\ingroup SynthStructures
+	\brief
+	Page fault counters
+	- Linux: counts for the calling thread
+	- macOS: counts for the whole process (an upper bound for the audio thread)
+	- Windows: counts for the whole process, which are not split by type, so all are minor
+	*/
+	struct PageFaultCounts
+	{
+		uint64_t minorFaults = 0;	///< serviced without I/O (e.g. page was in the page cache)
+		uint64_t majorFaults = 0;	///< needed I/O (e.g. read from disk or swap)
+	};
+
+	/**
+	\struct ResidencyStats
+	\ingroup SynthStructures
+	\brief
+	Result of the last ResidencyManager::updateResidency( ) call; all sizes are in whole pages
+	*/
+	struct ResidencyStats
+	{
+		uint32_t wavetableSources = 0;	///< reachable wavetable sources
+		uint32_t sampleSources = 0;		///< reachable PCM sample sources
+		uint64_t residentBytes = 0;		///< prefaulted
+		uint64_t lockedBytes = 0;		///< locked (only if locking is enabled)
+		uint64_t releasedBytes = 0;		///< released because they are no longer reachable
+		uint32_t lockFailures = 0;		///< ranges that could not be locked (e.g. RLIMIT_MEMLOCK)
+	};
+
+	/**
+	\class ResidencyManager
+	\ingroup SynthObjects
+	\brief
+	Keeps the memory of the tables and samples that the active patch can read resident
+	- updateResidency( ) is NOT real-time safe; call it after loading a patch or selecting
+	new cores (the SynthEngine calls it at the end of reset( ))
+	- memory is handled in whole pages; sources that share pages are handled correctly
+	- releasing never discards data: it only unlocks the pages and tells the OS that they
+	are cold, so a later read may fault but always returns the same data
+	- locking is optional because it is limited per process (RLIMIT_MEMLOCK on Linux and macOS,
+	the working set minimum on Windows); a failed lock is counted but the pages are still prefaulted
+	- locks are counted per page across all managers in the process, so tables shared between
+	engines stay locked until the last engine that locked them lets go
+	- beginRenderFaultCount( ) and endRenderFaultCount( ) bracket the render call; they do
+	nothing unless fault counting is enabled
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class ResidencyManager
+	{
+	public:
+		ResidencyManager() {}
+		~ResidencyManager();
+
+		/** lock the resident pages as well as prefaulting them; applies on the next update */
+		void setLockPages(bool _lockPages) { lockPages = _lockPages; }
+		bool getLockPages() { return lockPages; }
+
+		/** prefault (and lock) the reachable sources, release everything else; false if a lock failed */
+		bool updateResidency(ReachableSources& sources);
+
+		/** prefault (and lock) more sources, e.g. for a patch that is about to be swapped in;
+		    releases nothing, the next update trims; false if a lock failed */
+		bool addResidency(ReachableSources& sources);
+
+		/** unlock and release everything */
+		void releaseAll();
+
+		/** statistics of the last update */
+		const ResidencyStats& getResidencyStats() { return stats; }
+
+		/** render fault counting; call from the audio thread */
+		void setCountRenderFaults(bool _countRenderFaults) { countRenderFaults = _countRenderFaults; }
+		inline void beginRenderFaultCount() { if (countRenderFaults) renderStartFaults = getPageFaultCounts(); }
+		void endRenderFaultCount();
+
+		/** faults taken inside begin/endRenderFaultCount( ) since the last clear; any thread */
+		PageFaultCounts getRenderFaults();
+		void clearRenderFaults();
+
+		/** current counters (see PageFaultCounts for the scope on each platform) */
+		static PageFaultCounts getPageFaultCounts();
+
+		/** the OS page size */
+		static uint64_t getPageSize();
+
+	protected:
+		/** a page-aligned address range [start, end) */
+		struct PageRange
+		{
+			uintptr_t start = 0;
+			uintptr_t end = 0;
+		};
+		typedef std::vector<PageRange> PageRangeList;
+
+		// --- range helpers; inputs and outputs are sorted and merged
+		static PageRangeList getSourceRanges(ReachableSources& sources);
+		static void addRegions(PageRangeList& ranges, const MemoryRegionList& regions);
+		static void mergeRanges(PageRangeList& ranges);
+		static PageRangeList subtractRanges(const PageRangeList& a, const PageRangeList& b);
+		static uint64_t getRangeBytes(const PageRangeList& ranges);
+
+		// --- OS operations on one range; locks are counted per page across the process
+		void prefaultRange(const PageRange& range);
+		bool lockRange(const PageRange& range);
+		void unlockRange(const PageRange& range);
+		void releaseRange(const PageRange& range);
+		static bool lockPageRange(const PageRange& range);
+		static void unlockPageRange(const PageRange& range);
+
+		PageRangeList residentRanges;	///< prefaulted by the last update
+		PageRangeList lockedRanges;		///< locked by the last update(s)
+		ResidencyStats stats;			///< results of the last update
+		bool lockPages = false;			///< lock as well as prefault
+
+		// --- render fault counting
+		bool countRenderFaults = false;
+		PageFaultCounts renderStartFaults;
+		std::atomic<uint64_t> renderMinorFaults{ 0 };
+		std::atomic<uint64_t> renderMajorFaults{ 0 };
+	};
+
+} // namespace
+
+#endif /* defined(__residencyManager_h__) */
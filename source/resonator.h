@@ -47,6 +47,9 @@ namespace SynthLab
 		// --- flush out delay
 		void flushDelays();
 
+		/** memory accounting: heap owned by the delay line */
+		uint64_t getAllocatedBytes() { return delayLine.getAllocatedBytes(); }
+
 	protected:
 		// --- sample rate
 		double sampleRate = 0.0;			///< sample rate	
@@ -27,7 +27,7 @@ namespace SynthLab
 	WaveSequencer::WaveSequencer(std::shared_ptr<MidiInputData> _midiInputData, 
 		std::shared_ptr<WaveSequencerParameters> _parameters, 
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		for (uint32_t i = 0; i < MAX_SEQ_STEPS; i++)
@@ -743,7 +743,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class WaveSequencer : public SynthModule
+	class WaveSequencer : public MemoryAccounted<WaveSequencer, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -94,8 +94,10 @@ namespace SynthLab
 		{
 			if (!processInfo.wavetableDatabase->getTableSource(sfxTables[i].getWaveformName()))
 			{
-				processInfo.wavetableDatabase->addTableSource(sfxTables[i].getWaveformName(), &sfxTables[i], uniqueIndex);
-				coreData.uniqueIndexes[i] = uniqueIndex;
+				if (processInfo.wavetableDatabase->addTableSource(sfxTables[i].getWaveformName(), &sfxTables[i], uniqueIndex))
+					coreData.uniqueIndexes[i] = uniqueIndex;
+				else
+					coreData.uniqueIndexes[i] = processInfo.wavetableDatabase->getWaveformIndex(sfxTables[i].getWaveformName());
 			}
 			else
 				coreData.uniqueIndexes[i] = processInfo.wavetableDatabase->getWaveformIndex(sfxTables[i].getWaveformName());
@@ -129,13 +131,9 @@ namespace SynthLab
 		// --- select the wavetable source if changed
 		if (currentWaveIndex != parameters->waveIndex)
 		{
-			// --- try to get the table with a unique index if possible
+			// --- by index, lock-free; the indexes were found at reset
 			selectedTableSource = processInfo.wavetableDatabase->getTableSource(coreData.uniqueIndexes[parameters->waveIndex]);
 
-			// --- use the name (slow)
-			if (!selectedTableSource)
-				selectedTableSource = processInfo.wavetableDatabase->getTableSource(sfxTables[parameters->waveIndex].getWaveformName());
-
 			currentWaveIndex = parameters->waveIndex;
 		}
 
@@ -106,6 +106,17 @@ namespace SynthLab
 		*/
 		virtual uint32_t getWaveTableLength()  override { return sineWavetable.tableLength; }
 
+		/**
+		\return memory accounting: bytes of the compiled-in sine table
+		*/
+		virtual uint64_t getTableMemoryBytes() override { return (uint64_t)sineWavetable.tableLength * sizeof(double); }
+
+		/**
+		\brief
+		Residency: the compiled-in sine table
+		*/
+		virtual void getMemoryRegions(MemoryRegionList& regions) override { regions.push_back(MemoryRegion(sineWavetable.dTable, getTableMemoryBytes())); }
+
 	protected:
 		// --- prefab table valid for all MIDI notes
 		StaticWavetable sineWavetable;///<// --- prefab table valid for all MIDI notes
@@ -1,5 +1,6 @@
 #include "synthbase.h"
 #include "synthfunctions.h"
+#include "synthtrace.h"
 
 // -----------------------------
 //	--- SynthLab SDK File --- // 
@@ -944,6 +945,53 @@ namespace SynthLab
 		return &midiEventQueue[index];
 	}
 
+	/**
+	\brief
+	Add a parameter automation event to the queue
+	- call this once per automation point per audio buffer, at the top of the block render cycle
+	- events are expected in time order, as with MIDI events
+
+	\param event parameter event to push onto the stack
+	*/
+	void SynthProcessInfo::pushParameterEvent(ParameterEvent event)
+	{
+		parameterEventQueue.push_back(event);
+	}
+
+	/**
+	\brief
+	Clear the queue
+	- called after the events are applied
+	*/
+	void SynthProcessInfo::clearParameterEvents()
+	{
+		parameterEventQueue.clear();
+	}
+
+	/**
+	\return the count of events in the queue
+	*/
+	uint64_t SynthProcessInfo::getParameterEventCount()
+	{
+		return parameterEventQueue.size();
+	}
+
+	/**
+	\brief
+	gets a parameter event within the event queue
+
+	\param index location within the vector of the event
+
+	\return a pointer to the event, or nullptr if not found
+	*/
+	ParameterEvent* SynthProcessInfo::getParameterEvent(uint32_t index)
+	{
+		if (index >= getParameterEventCount())
+			return nullptr;
+
+		return &parameterEventQueue[index];
+	}
+
 	// WavetableDatabase --------------------------------------------------------------------- //
 	/**
 	\brief
@@ -970,29 +1018,39 @@ namespace SynthLab
 		if (uniqueTableName == empty_string.c_str() || strlen(uniqueTableName) <= 0)
 			return nullptr;
 
-		IWavetableSource* source = nullptr;
 		std::string name(uniqueTableName);
-		wavetableSourceMap::iterator it = wavetableDatabase.find(name);
-		if (it != wavetableDatabase.end())
-		{
-			source = it->second;
-		}
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		IWavetableSource* source = wavetableSources.getSource(name);
+		if (!source)
+			SYNTHLAB_TRACE_EVENT(TraceEventType::kDatabaseMiss, 0, 0);
 
 		return source;
 	}
 
+	/**
+	\brief
+	selects a table source based on its index; lock-free, for the audio thread
+
+	\param uniqueTableIndex index from addTableSource( ) or getWaveformIndex( )
+
+	\return a pointer to the IWavetableSource, or nullptr if there is none at the index
+	*/
 	IWavetableSource* WavetableDatabase::getTableSource(uint32_t uniqueTableIndex)
 	{
-		if (uniqueTableIndex > wavetableVector.size()-1) return nullptr;
-		return wavetableVector[uniqueTableIndex];
+		IWavetableSource* source = wavetableSources.getSource(uniqueTableIndex);
+		if (!source)
+			SYNTHLAB_TRACE_EVENT(TraceEventType::kDatabaseMiss, 0, uniqueTableIndex);
+		return source;
 	}
 
 	/**
 	\brief
 	add a table source to the database
+	- a name that was removed gets its old index back
 
 	\param uniqueTableName name of the table set, usually the same as the waveform string the user sees
 	\param tableSource IWavetableSource* to add
+	\param uniqueIndex returns the index of the source, for getTableSource(uint32_t)
 
 	\return true if sucessful
 	*/
@@ -1004,72 +1062,101 @@ namespace SynthLab
 		if (uniqueTableName == empty_string.c_str() || strlen(uniqueTableName) <= 0)
 			return false;
 
-		if (getTableSource(uniqueTableName))
+		// --- rejects duplicates
+		std::string name(uniqueTableName);
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		return wavetableSources.addSource(name, tableSource, uniqueIndex);
+	}
+
+	/**
+	\brief
+	remove a table source from the database; its index stays reserved for the name
+
+	\param uniqueTableName name of the table set, usually the same as the waveform string the user sees
+
+	\return true if sucessful
+	*/
+	bool WavetableDatabase::removeTableSource(const char* uniqueTableName)
+	{
+		if (!uniqueTableName)
 			return false;
 
-		// --- map for controlID-indexing
 		std::string name(uniqueTableName);
-		wavetableDatabase.insert(std::make_pair(name, tableSource));
+		std::lock_guard<std::mutex> lock(databaseMutex);
 
-		// --- vector for faster lookup
-		wavetableVector.push_back(tableSource);
-		uniqueIndex = (uint32_t)(wavetableVector.size() - 1);
+		// --- a replaced name keeps its source
+		int32_t index = wavetableSources.findHandle(name);
+		if (index >= 0 && std::find(replacedIndexes.begin(), replacedIndexes.end(), (uint32_t)index) != replacedIndexes.end())
+			return false;
 
-		return true;
+		return wavetableSources.removeSource(name) != nullptr;
 	}
 
 	/**
 	\brief
-	remove a table source from the database
+	put a table source under a name at runtime, replacing the source that has it
+	- the name keeps its index: cores looking it up by index get the new source on their next update( )
+	- the old source is not destroyed, its owner still has it; the audio thread may finish a block with it
+	- from now on removeTableSource( ) is refused for the name, and addTableSource( ) fails as usual
+	for a name that has a source, so a core that resets later does not put its own table back
 
-	\param uniqueTableName name of the table set, usually the same as the waveform string the user sees
+	\param uniqueTableName name of the table set
+	\param tableSource IWavetableSource* to put under the name
+	\param uniqueIndex returns the index of the name
 
 	\return true if sucessful
 	*/
-	bool WavetableDatabase::removeTableSource(const char* uniqueTableName)
+	bool WavetableDatabase::replaceTableSource(const char* uniqueTableName, IWavetableSource* tableSource, uint32_t& uniqueIndex)
 	{
-		if (!getTableSource(uniqueTableName))
+		if (!uniqueTableName || !tableSource)
 			return false;
 
-		std::string name(uniqueTableName);
-		wavetableDatabase.erase(name);
-		
+		if (uniqueTableName == empty_string.c_str() || strlen(uniqueTableName) <= 0)
+			return false;
 
-		//vec.erase(vec.begin() + index);
+		std::string name(uniqueTableName);
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		uniqueIndex = (uint32_t)-1;
+		wavetableSources.replaceSource(name, tableSource, uniqueIndex);
+		if (wavetableSources.getSource(uniqueIndex) != tableSource)
+			return false; // --- table full
+
+		if (std::find(replacedIndexes.begin(), replacedIndexes.end(), uniqueIndex) == replacedIndexes.end())
+			replacedIndexes.push_back(uniqueIndex);
 		return true;
 	}
 
 	/**
 	\brief
-	clear all entries from the std::map
+	clear all sources from the database, including the replaced ones
 	- does not delete or destroy anything
 	\return true if sucessful
 	*/
 	bool WavetableDatabase::clearTableSources()
 	{
-		wavetableDatabase.clear();
-		wavetableVector.clear();
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		wavetableSources.clearSources();
+		replacedIndexes.clear();
 		return true;
 	}
 
 	/**
 	\brief
-	get the vector index of a waveform, use at reset() or startup, not runtime
+	get the index of a waveform, use at reset() or startup, not runtime
 	- does not delete or destroy anything
 	\return index of waveform or -1 if not found
 	*/
 	int32_t WavetableDatabase::getWaveformIndex(const char* uniqueTableName)
 	{
-		IWavetableSource* source = getTableSource(uniqueTableName);
-		if (!source) return -1;
+		if (!uniqueTableName)
+			return -1;
 
-		size_t size = wavetableVector.size();
-		for (uint32_t i = 0; i < size; i++) 
-		{
-			if (wavetableVector[i] == source)
-				return i;
-		}
-		return -1;
+		std::string name(uniqueTableName);
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		int32_t index = wavetableSources.findHandle(name);
+		if (index < 0 || !wavetableSources.getSource((uint32_t)index))
+			return -1;
+		return index;
 	}
 
 	// SampleDatabase --------------------------------------------------------------------- //
@@ -1099,18 +1186,52 @@ namespace SynthLab
 		if (uniqueSampleSetName == empty_string.c_str() || strlen(uniqueSampleSetName) <= 0)
 			return nullptr;
 
-		IPCMSampleSource* source = nullptr;
-
 		std::string name(uniqueSampleSetName);
-		sampleSourceMap::iterator it = sampleDatabase.find(name);
-		if (it != sampleDatabase.end())
-		{
-			source = it->second;
-		}
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		IPCMSampleSource* source = sampleSources.getSource(name);
+		if (!source)
+			SYNTHLAB_TRACE_EVENT(TraceEventType::kDatabaseMiss, 1, 0);
 
 		return source;
 	}
 
+	/**
+	\brief
+	selects a PCM sample source based on its index; lock-free, for the audio thread
+
+	\param uniqueSampleSetIndex index from getSampleSetIndex( )
+
+	\return a pointer to the IPCMSampleSource, or nullptr if there is none at the index
+	*/
+	IPCMSampleSource* PCMSampleDatabase::getSampleSource(uint32_t uniqueSampleSetIndex)
+	{
+		IPCMSampleSource* source = sampleSources.getSource(uniqueSampleSetIndex);
+		if (!source)
+			SYNTHLAB_TRACE_EVENT(TraceEventType::kDatabaseMiss, 1, uniqueSampleSetIndex);
+		return source;
+	}
+
+	/**
+	\brief
+	get the index of a sample set, use at reset() or startup, not runtime
+
+	\param uniqueSampleSetName name of the PCM sample set
+
+	\return index of the sample set or -1 if not found
+	*/
+	int32_t PCMSampleDatabase::getSampleSetIndex(const char* uniqueSampleSetName)
+	{
+		if (!uniqueSampleSetName)
+			return -1;
+
+		std::string name(uniqueSampleSetName);
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		int32_t index = sampleSources.findHandle(name);
+		if (index < 0 || !sampleSources.getSource((uint32_t)index))
+			return -1;
+		return index;
+	}
+
 	/**
 	\brief
 	add a PCM sample source to the database
@@ -1125,23 +1246,19 @@ namespace SynthLab
 		if (!uniqueSampleSetName || !sampleSource)
 			return false;
 
-		if (getSampleSource(uniqueSampleSetName))
-			return false;
-
 		if (sampleSource->getValidSampleCount() <= 0)
 			return false;
 
-		// --- map for controlID-indexing
+		// --- rejects duplicates
 		std::string name(uniqueSampleSetName);
-		sampleDatabase.insert(std::make_pair(name, sampleSource));
-		sources.push_back(sampleSource);
-
-		return true;
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		uint32_t uniqueIndex = 0;
+		return sampleSources.addSource(name, sampleSource, uniqueIndex);
 	}
 
 	/**
 	\brief
-	remove a PCM sample source from the database
+	remove a PCM sample source from the database; its index stays reserved for the name
 
 	\param uniqueSampleSetName name of the PCM sample set, usually the same as the folder that holds the WAV samples
 
@@ -1149,42 +1266,142 @@ namespace SynthLab
 	*/
 	bool PCMSampleDatabase::removeSampleSource(const char* uniqueSampleSetName)
 	{
-		if (!getSampleSource(uniqueSampleSetName))
+		if (!uniqueSampleSetName)
 			return false;
 
-		// --- map for controlID-indexing
-		sampleSourceMap::iterator it = sampleDatabase.find(uniqueSampleSetName);
-		IPCMSampleSource* set = it->second;
-		if (!set) return false;
-
-		// --- find and remove
-		std::vector<IPCMSampleSource*>::iterator toErease = std::find(sources.begin(), sources.end(), set);
-		sampleDatabase.erase(it);              // erasing by iterator
-		sources.erase(toErease);
-
-		return true;
+		std::string name(uniqueSampleSetName);
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		return sampleSources.removeSource(name) != nullptr;
 	}
 
 	/**
 	\brief
-	clear all entries from the std::map
+	clear all sources from the database
 	- this DOES call the sample deleter function on the source as part of the destruction of dynamic data
 
 	\return true if sucessful
 	*/
 	bool PCMSampleDatabase::clearSampleSources()
 	{
-		for (uint32_t i = 0; i < sources.size(); i++)
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		const std::map<std::string, uint32_t>& handles = sampleSources.getHandles();
+		for (std::map<std::string, uint32_t>::const_iterator it = handles.begin(); it != handles.end(); ++it)
 		{
-			sources[i]->deleteSamples();
+			IPCMSampleSource* source = sampleSources.getSource(it->second);
+			if (source)
+				source->deleteSamples();
 		}
-
-		sampleDatabase.clear();
-		sources.clear();
+		sampleSources.clearSources();
 
 		return true;
 	}
 
+	/**
+	\brief
+	memory accounting: the sample data is owned by the database since it deletes it
+	- samples are read as notes play, so only a fraction is resident; reported as owned
+
+	\param report the node for the database
+	*/
+	void PCMSampleDatabase::getMemoryReport(MemoryReport& report)
+	{
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		report.ownedBytes += sizeof(PCMSampleDatabase) + sampleSources.getAllocatedBytes();
+		const std::map<std::string, uint32_t>& handles = sampleSources.getHandles();
+		for (std::map<std::string, uint32_t>::const_iterator it = handles.begin(); it != handles.end(); ++it)
+		{
+			IPCMSampleSource* source = sampleSources.getSource(it->second);
+			if (!source)
+				continue;
+			MemoryReport& child = report.addChild(it->first);
+			child.ownedBytes = source->getSampleMemoryBytes();
+			child.residentBytes = 0; // --- unknown until played
+		}
+		report.residentBytes += estimateResidentBytes(report.ownedBytes);
+	}
+
+	/**
+	\brief
+	memory accounting: the database owns only its dictionary; the wavetables are compiled
+	into the binary and shared by every core and voice
+
+	\param report the node for the database
+	*/
+	void WavetableDatabase::getMemoryReport(MemoryReport& report)
+	{
+		std::lock_guard<std::mutex> lock(databaseMutex);
+		report.ownedBytes += sizeof(WavetableDatabase) + wavetableSources.getAllocatedBytes() + replacedIndexes.capacity() * sizeof(uint32_t);
+		const std::map<std::string, uint32_t>& handles = wavetableSources.getHandles();
+		for (std::map<std::string, uint32_t>::const_iterator it = handles.begin(); it != handles.end(); ++it)
+		{
+			IWavetableSource* source = wavetableSources.getSource(it->second);
+			if (source)
+				report.sharedBytes += source->getTableMemoryBytes();
+		}
+		report.residentBytes += estimateResidentBytes(report.ownedBytes);
+	}
+
+	// --- MemoryReport -------------------------------------------------------------------------------------- //
+	/**
+	\brief
+	sum of owned bytes of this node and all of its children
+
+	\return total owned bytes
+	*/
+	uint64_t MemoryReport::getTotalOwnedBytes() const
+	{
+		uint64_t total = ownedBytes;
+		for (const MemoryReport& child : children)
+			total += child.getTotalOwnedBytes();
+		return total;
+	}
+
+	/**
+	\brief
+	sum of resident estimates of this node and all of its children
+
+	\return total resident bytes
+	*/
+	uint64_t MemoryReport::getTotalResidentBytes() const
+	{
+		uint64_t total = residentBytes;
+		for (const MemoryReport& child : children)
+			total += child.getTotalResidentBytes();
+		return total;
+	}
+
+	/**
+	\brief
+	zero the resident estimate of this node and its children, for objects that are owned
+	but not touched during rendering
+	*/
+	void MemoryReport::clearResidentBytes()
+	{
+		residentBytes = 0;
+		for (MemoryReport& child : children)
+			child.clearResidentBytes();
+	}
+
+	/**
+	\brief
+	indented tree of the report with totals per node, in KB
+
+	\param depth indentation level of this node
+	\return the formatted report
+	*/
+	std::string MemoryReport::getTreeString(uint32_t depth) const
+	{
+		char line[256];
+		std::string indentedName = std::string(depth * 2, ' ') + name;
+		snprintf(line, sizeof(line), "%-48s owned: %10.1f KB  shared: %10.1f KB  resident: %10.1f KB\n",
+			indentedName.c_str(), getTotalOwnedBytes() / 1024.0, sharedBytes / 1024.0, getTotalResidentBytes() / 1024.0);
+
+		std::string tree(line);
+		for (const MemoryReport& child : children)
+			tree += child.getTreeString(depth + 1);
+		return tree;
+	}
+
 
 	// --- MidiInputData -------------------------------------------------------------------------------------- //
 	/**
@@ -1436,9 +1653,12 @@ namespace SynthLab
 	*/
 	bool SynthModule::getModuleStrings(std::vector<std::string>& moduleStrings, std::string ignoreStr)
 	{
-		if (selectedCore)
+		// --- by the published index: selectedCore belongs to the audio thread
+		int32_t selected = selectedCoreIndex.load(std::memory_order_acquire);
+		std::shared_ptr<ModuleCore> core = selected < 0 ? nullptr : getStringsCore((uint32_t)selected);
+		if (core)
 		{
-			ModuleCoreData data = selectedCore->getModuleData();
+			ModuleCoreData data = core->getModuleData();
 			moduleStrings = charArrayToStringVector(data.moduleStrings, MODULE_STRINGS, ignoreStr);
 			return true;
 		}
@@ -1463,9 +1683,11 @@ namespace SynthLab
 	{
 		if (coreIndex > NUM_MODULE_CORES - 1) return false;
 
-		if (moduleCores[coreIndex])
+		// --- strings live on the core; a slot that is not built lends a temporary one
+		std::shared_ptr<ModuleCore> core = getStringsCore(coreIndex);
+		if (core)
 		{
-			ModuleCoreData data = moduleCores[coreIndex]->getModuleData();
+			ModuleCoreData data = core->getModuleData();
 			moduleStrings = charArrayToStringVector(data.moduleStrings, MODULE_STRINGS, ignoreStr);
 			return true;
 		}
@@ -1490,9 +1712,10 @@ namespace SynthLab
 		bool foundStrings = false;
 		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
 		{
-			if (moduleCores[i])
+			std::shared_ptr<ModuleCore> core = getStringsCore(i);
+			if (core)
 			{
-				ModuleCoreData data = moduleCores[i]->getModuleData();
+				ModuleCoreData data = core->getModuleData();
 				appendCharArrayToStringVector(data.moduleStrings, MODULE_STRINGS, moduleStrings, ignoreStr);
 				foundStrings = true;
 			}
@@ -1517,9 +1740,12 @@ namespace SynthLab
 	*/
 	bool SynthModule::getModKnobStrings(std::vector<std::string>& modKnobStrings)
 	{
-		if (selectedCore)
+		// --- by the published index: selectedCore belongs to the audio thread
+		int32_t selected = selectedCoreIndex.load(std::memory_order_acquire);
+		std::shared_ptr<ModuleCore> core = selected < 0 ? nullptr : getStringsCore((uint32_t)selected);
+		if (core)
 		{
-			ModuleCoreData data = selectedCore->getModuleData();
+			ModuleCoreData data = core->getModuleData();
 			modKnobStrings = charArrayToStringVector(data.modKnobStrings, MOD_KNOBS);
 			return true;
 		}
@@ -1546,10 +1772,12 @@ namespace SynthLab
 	{
 		if (coreIndex > NUM_MODULE_CORES - 1) return false;
 
-		if (moduleCores[coreIndex])
+		std::shared_ptr<ModuleCore> core = getStringsCore(coreIndex);
+		if (core)
 		{
-			ModuleCoreData data = moduleCores[coreIndex]->getModuleData();
+			ModuleCoreData data = core->getModuleData();
 			modKnobStrings = charArrayToStringVector(data.modKnobStrings, MOD_KNOBS);
+			return true;
 		}
 
 		// --- use local versions for modules with no cores
@@ -1571,13 +1799,36 @@ namespace SynthLab
 	{
 		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
 		{
-			std::shared_ptr<ModuleCore> core = moduleCores[i];
-			if (core)
-				moduleCoreStrings.push_back(core->getModuleName());
+			// --- lazy slots are named in the factory table, so nothing is built here; a slot is
+			//     only read once its bit is published (see builtCores)
+			if (isModuleCoreInstantiated(i))
+				moduleCoreStrings.push_back(moduleCores[i]->getModuleName());
+			else if (coreFactories[i] && coreFactoryNames[i])
+				moduleCoreStrings.push_back(coreFactoryNames[i]);
 		}
 		return false;
 	}
 
+	/**
+	\brief
+	Core for reading strings: the slot's core, or a temporary core built from the slot's factory
+	that is NOT installed, so that querying strings never changes the module
+	- the slot is only read once its builtCores bit is seen: the audio thread may be installing
+	a core in a slot without one, and never writes a slot that has one
+	- NOT for use on the audio thread; the caller holds the core until its strings are copied
+
+	\param index the slot
+	\return the core, or nullptr for an empty slot
+	*/
+	std::shared_ptr<ModuleCore> SynthModule::getStringsCore(uint32_t index)
+	{
+		if (index > NUM_MODULE_CORES - 1) return nullptr;
+		if (isModuleCoreInstantiated(index)) return moduleCores[index];
+		if (!coreFactories[index]) return nullptr;
+
+		return coreFactories[index]();
+	}
+
 	/**
 	\brief
 	starts the built-in glide modulator 
@@ -1608,11 +1859,14 @@ namespace SynthLab
 
 		if (preferredLoadIndex >= 0 && preferredLoadIndex < NUM_MODULE_CORES)
 		{
-			// --- if not occupied take this slot
-			if (!moduleCores[preferredLoadIndex])
+			// --- if not occupied (or reserved by a lazy core) take this slot
+			if (!moduleCores[preferredLoadIndex] && !coreFactories[preferredLoadIndex])
 			{
 				moduleCores[preferredLoadIndex] = core;
 				core->setModuleIndex(preferredLoadIndex);
+				coreNoteOns &= ~(1u << preferredLoadIndex);
+				coreNoteOffs &= ~(1u << preferredLoadIndex);
+				publishBuiltCores();
 				return true;
 			}
 		}
@@ -1620,16 +1874,188 @@ namespace SynthLab
 		// --- keep looking
 		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
 		{
-			if (!moduleCores[i])
+			if (!moduleCores[i] && !coreFactories[i])
 			{
 				moduleCores[i] = core;
 				core->setModuleIndex(i);
+				coreNoteOns &= ~(1u << i);
+				coreNoteOffs &= ~(1u << i);
+				publishBuiltCores();
 				return true;
 			}
 		}
 		return false;
 	}
 
+	/**
+	\brief
+	reserves a core slot for a core that is constructed lazily
+	- the core is built off the audio thread when it is needed: by instantiateModuleCore( ) at 
+	construction or by buildModuleCore( ) for a new patch or core selection, so modules whose 
+	alternate cores are never used do not pay for them
+	- the slot index should match the core's preferred index, same as with addModuleCore( )
+
+	\param factory function that creates the core, e.g. createModuleCore<ClassicWTCore>
+	\param index the slot to reserve
+	\param coreName the core's module name, for getModuleCoreStrings( )
+	\return true if sucessful
+	*/
+	bool SynthModule::addModuleCoreFactory(ModuleCoreFactory factory, uint32_t index, const char* coreName)
+	{
+		if (!factory || index > NUM_MODULE_CORES - 1) return false;
+		if (moduleCores[index] || coreFactories[index]) return false;
+
+		coreFactories[index] = factory;
+		coreFactoryNames[index] = coreName;
+		return true;
+	}
+
+	/**
+	\brief
+	constructs the core in a lazily-loaded slot, if not already done
+	- if the module has already been reset, the new core is reset with the current sample rate
+	so that it is immediately ready to render
+	- NOT for use on the audio thread: constructing a core may allocate and register tables
+
+	\param index the slot to instantiate
+	\return true if the slot holds a core afterwards
+	*/
+	bool SynthModule::instantiateModuleCore(uint32_t index)
+	{
+		if (index > NUM_MODULE_CORES - 1) return false;
+		if (moduleCores[index]) return true;
+		if (!coreFactories[index]) return false;
+
+		std::shared_ptr<ModuleCore> core = coreFactories[index]();
+		if (!core) return false;
+
+		core->setModuleIndex(index);
+		core->setStandAloneMode(standAloneMode);
+		moduleCores[index] = core;
+		publishBuiltCores();
+
+		// --- a new core has not had the current note
+		coreNoteOns &= ~(1u << index);
+		coreNoteOffs &= ~(1u << index);
+
+		// --- cores are normally reset with the module; catch up if we are late
+		if (coreProcessData.sampleRate > 0.0)
+			core->reset(coreProcessData);
+
+		return true;
+	}
+
+	/**
+	\brief
+	builds the core in a slot if needed, then selects it
+	- for construction and setup; NOT for use on the audio thread, see selectModuleCore( )
+
+	\param index the slot
+	\return true if the core was selected
+	*/
+	bool SynthModule::instantiateAndSelectModuleCore(uint32_t index)
+	{
+		if (!instantiateModuleCore(index))
+			return false;
+
+		return selectModuleCore(index);
+	}
+
+
+	/**
+	\brief
+	builds the core for a lazily-loaded slot WITHOUT installing it, for patch preparation
+	on a background thread
+	- the core is reset with the module's sample rate and shared resources, so building it
+	registers its tables in the databases here rather than on the audio thread
+	- reads only module state that is fixed after reset( ) and the builtCores mask; the slot 
+	itself is not touched, since the audio thread may be installing a core in it
+	- NOT for use on the audio thread
+
+	\param index the slot the core is for
+	\return the new core, or nullptr if the slot is already instantiated or has no factory
+	*/
+	std::shared_ptr<ModuleCore> SynthModule::buildModuleCore(uint32_t index)
+	{
+		if (index > NUM_MODULE_CORES - 1) return nullptr;
+		if (isModuleCoreInstantiated(index) || !coreFactories[index]) return nullptr;
+
+		std::shared_ptr<ModuleCore> core = coreFactories[index]();
+		if (!core) return nullptr;
+
+		core->setModuleIndex(index);
+		core->setStandAloneMode(standAloneMode);
+
+		// --- only the members set up at construction and reset; the per-block 
+		//     members are written by the audio thread
+		if (coreProcessData.sampleRate > 0.0)
+		{
+			CoreProcData processData;
+			processData.modulationInputs = coreProcessData.modulationInputs;
+			processData.modulationOutputs = coreProcessData.modulationOutputs;
+			processData.inputBuffers = coreProcessData.inputBuffers;
+			processData.outputBuffers = coreProcessData.outputBuffers;
+			processData.fmBuffers = coreProcessData.fmBuffers;
+			processData.wavetableDatabase = coreProcessData.wavetableDatabase;
+			processData.sampleDatabase = coreProcessData.sampleDatabase;
+			processData.midiInputData = coreProcessData.midiInputData;
+			processData.moduleParameters = coreProcessData.moduleParameters;
+			processData.dllPath = coreProcessData.dllPath;
+			processData.sampleRate = coreProcessData.sampleRate;
+			core->reset(processData);
+		}
+		return core;
+	}
+
+	/**
+	\brief
+	installs a core made by buildModuleCore( ) into its empty slot
+	- real-time safe: only a reference is added, nothing is allocated or freed; the caller
+	keeps its reference and must release it off the audio thread
+	- a slot that was instantiated in the meantime keeps its core
+
+	\param index the slot
+	\param core the prepared core
+	\return true if the slot holds a core afterwards
+	*/
+	bool SynthModule::installModuleCore(uint32_t index, const std::shared_ptr<ModuleCore>& core)
+	{
+		if (index > NUM_MODULE_CORES - 1) return false;
+		if (moduleCores[index]) return true;
+		if (!core || !coreFactories[index]) return false;
+
+		moduleCores[index] = core;
+		coreNoteOns &= ~(1u << index);
+		coreNoteOffs &= ~(1u << index);
+		publishBuiltCores();
+		return true;
+	}
+
+	/**
+	\brief
+	publishes which slots hold a core (builtCores) after a slot changed
+	- real-time safe: one atomic store
+	*/
+	void SynthModule::publishBuiltCores()
+	{
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
+		{
+			if (moduleCores[i])
+				mask |= 1u << i;
+		}
+		builtCores.store(mask, std::memory_order_release);
+	}
+
+	/**
+	\brief
+	publishes the slot of the selected core (selectedCoreIndex) after the selection changed
+	- real-time safe: one atomic store
+	*/
+	void SynthModule::publishSelectedCore()
+	{
+		selectedCoreIndex.store(selectedCore ? (int32_t)selectedCore->getModuleIndex() : -1, std::memory_order_release);
+	}
 
 	/**
 	\brief
@@ -1639,13 +2065,17 @@ namespace SynthLab
 	*/
 	uint32_t SynthModule::getSelectedCoreIndex()
 	{
-		if (selectedCore) return selectedCore->getModuleIndex();
+		int32_t selected = selectedCoreIndex.load(std::memory_order_acquire);
+		if (selected >= 0) return (uint32_t)selected;
 		return 0; // default core
 	}
 
 	/**
 	\brief
 	Select a core
+	- real-time safe: only a core that is already built can be selected; a lazy slot that
+	is not built yet is refused and the current core stays selected (build it first with 
+	instantiateAndSelectModuleCore( ) at setup, or with buildModuleCore( ) off the audio thread)
 
 	\param index index of core to select
 	\return true if found a core to select
@@ -1656,7 +2086,11 @@ namespace SynthLab
 
 		if (moduleCores[index])
 		{
+			if (selectedCore != moduleCores[index])
+				SYNTHLAB_TRACE_EVENT(TraceEventType::kCoreSwap, index, moduleCores[index]->getModuleType());
 			selectedCore = moduleCores[index];
+			publishSelectedCore();
+			catchUpSelectedCore();
 			return true;
 		}
 		return false;
@@ -1665,42 +2099,147 @@ namespace SynthLab
 	/**
 	\brief
 	Select the default core, which is always the first in the list
+	- for module constructors: builds the core if it is a lazy slot
 
 	\return true if found a core to select
 	*/
 	bool SynthModule::selectDefaultModuleCore()
 	{
-		if (moduleCores[DEFAULT_CORE])
+		if (instantiateModuleCore(DEFAULT_CORE))
 		{
 			selectedCore = moduleCores[DEFAULT_CORE];
+			publishSelectedCore();
+			catchUpSelectedCore();
 			return true;
 		}
 		return false;
 	}
 
+	/**
+	\brief
+	Note-on for the selected core only
+	- the other cores are not rendering, so they do not need the note until they are
+	selected; selectModuleCore( ) delivers it then (see catchUpSelectedCore( )), and
+	cores that are never selected during the note cost nothing
+	- modules call this from doNoteOn( ) after setting up coreProcessData
+
+	\param noteEvent the note
+	\return true if handled
+	*/
+	bool SynthModule::doSelectedCoreNoteOn(MIDINoteEvent& noteEvent)
+	{
+		deferNoteOn(noteEvent);
+		catchUpSelectedCore();
+		return true;
+	}
+
+	/**
+	\brief
+	Note-off for the selected core only; the other cores that had the note-on get it
+	when they are selected
+
+	\param noteEvent the note
+	\return true if handled
+	*/
+	bool SynthModule::doSelectedCoreNoteOff(MIDINoteEvent& noteEvent)
+	{
+		deferNoteOff(noteEvent);
+		catchUpSelectedCore();
+		return true;
+	}
+
+	/**
+	\brief
+	Records a note-on without delivering it to any core; the selected core gets it at the
+	next catchUpSelectedCore( ) or selectModuleCore( ) call
+
+	\param noteEvent the note
+	*/
+	void SynthModule::deferNoteOn(MIDINoteEvent& noteEvent)
+	{
+		noteOnEvent = noteEvent;
+		noteStarted = true;
+		noteReleased = false;
+		coreNoteOns = 0;
+		coreNoteOffs = 0;
+	}
+
+	/**
+	\brief
+	Records a note-off without delivering it to any core
+
+	\param noteEvent the note
+	*/
+	void SynthModule::deferNoteOff(MIDINoteEvent& noteEvent)
+	{
+		noteOffEvent = noteEvent;
+		noteReleased = noteStarted;
+		coreNoteOffs = 0;
+	}
+
+	/**
+	\brief
+	Delivers the current note-on, and its note-off if the note was released, to the selected
+	core if it has not had them; does nothing for a core that is up to date, so this is cheap
+	enough to call on every core selection
+	*/
+	void SynthModule::catchUpSelectedCore()
+	{
+		if (!noteStarted || !selectedCore)
+			return;
+
+		uint32_t coreBit = 1u << selectedCore->getModuleIndex();
+		if (!(coreNoteOns & coreBit))
+		{
+			coreProcessData.noteEvent = noteOnEvent;
+			coreProcessData.unisonStartPhase = unisonStartPhase;
+			selectedCore->doNoteOn(coreProcessData);
+			coreNoteOns |= coreBit;
+		}
+
+		if (noteReleased && !(coreNoteOffs & coreBit))
+		{
+			coreProcessData.noteEvent = noteOffEvent;
+			selectedCore->doNoteOff(coreProcessData);
+			coreNoteOffs |= coreBit;
+		}
+	}
+
 
 	/**
 	\brief
 	packs the cores into non-null ordering
+	- slots reserved for lazy cores count as occupied and move with their factory
 	*/
 	void SynthModule::packCores()
 	{
 		for (uint32_t core = 0; core < NUM_MODULE_CORES; core++)
 		{
-			if (!moduleCores[core])
+			if (!moduleCores[core] && !coreFactories[core])
 			{
 				for (uint32_t i = core+1; i < NUM_MODULE_CORES; i++)
 				{
-					if (moduleCores[i])
+					if (moduleCores[i] || coreFactories[i])
 					{
 						moduleCores[core] = moduleCores[i];
-						moduleCores[core]->setModuleIndex(core);
+						coreFactories[core] = coreFactories[i];
+						coreFactoryNames[core] = coreFactoryNames[i];
+						if (moduleCores[core])
+							moduleCores[core]->setModuleIndex(core);
 						moduleCores[i] = nullptr;
+						coreFactories[i] = nullptr;
+						coreFactoryNames[i] = nullptr;
 						break;
 					}
 				}
 			}
 		}
+
+		// --- the slots moved; the cores get the current note again when selected
+		coreNoteOns = 0;
+		coreNoteOffs = 0;
+		publishBuiltCores();
+		publishSelectedCore();
 	}
 
 
@@ -1712,6 +2251,9 @@ namespace SynthLab
 	*/
 	void SynthModule::setStandAloneMode(bool alone)
 	{
+		// --- for lazily constructed cores
+		standAloneMode = alone;
+
 		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
 		{
 			if (moduleCores[i])
@@ -1720,6 +2262,103 @@ namespace SynthLab
 	}
 
 
+	/**
+	\brief
+	memory accounting for a module and its cores
+	- the module object, modulator arrays and audio buffers are touched every block
+	- each constructed core is a child; only the selected core counts as resident
+	- lazily constructed cores that were never used cost nothing and are not listed
+	- the FM buffer belongs to another operator so it is reported as shared
+
+	\param report the node for this module
+	*/
+	void SynthModule::getMemoryReport(MemoryReport& report)
+	{
+		uint64_t bytes = getObjectSize() + 2 * sizeof(Modulators);
+		if (glideModulator)
+			bytes += sizeof(GlideModulator);
+		if (audioBuffers)
+			bytes += sizeof(SynthProcessInfo) + audioBuffers->getAllocatedBytes();
+
+		report.ownedBytes += bytes;
+		report.residentBytes += estimateResidentBytes(bytes);
+
+		if (fmBuffer)
+			report.sharedBytes += fmBuffer->getAllocatedBytes();
+
+		// --- the published mask and index, not the slots and selectedCore the audio thread writes
+		int32_t selected = selectedCoreIndex.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
+		{
+			if (!isModuleCoreInstantiated(i)) continue;
+
+			MemoryReport& child = report.addChild(moduleCores[i]->getModuleName() ? moduleCores[i]->getModuleName() : "core");
+			moduleCores[i]->getMemoryReport(child);
+			if ((int32_t)i != selected)
+				child.clearResidentBytes();
+		}
+	}
+
+	/**
+	\brief
+	Change detection: every constructed core adds its counters; cores that are not selected
+	do not update, so their counts stand still
+
+	\param counters the sum to add to
+	*/
+	void SynthModule::addUpdateCounters(UpdateCounters& counters)
+	{
+		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
+		{
+			if (isModuleCoreInstantiated(i))
+				moduleCores[i]->addUpdateCounters(counters);
+		}
+	}
+
+	/**
+	\brief
+	Residency: the module strings of wavetable and PCM cores are the waveform and sample set
+	names that they registered in the databases, so any of them can be selected while the core is;
+	other core types read no database
+
+	\param sources the list to add to
+	\param processInfo holds the database pointers
+	*/
+	void ModuleCore::addReachableSources(ReachableSources& sources, CoreProcData& processInfo)
+	{
+		bool wavetableCore = (moduleType == WTO_MODULE || moduleType == FMO_MODULE) && processInfo.wavetableDatabase;
+		bool sampleCore = moduleType == PCMO_MODULE && processInfo.sampleDatabase;
+		if (!wavetableCore && !sampleCore)
+			return;
+
+		for (uint32_t i = 0; i < MODULE_STRINGS; i++)
+		{
+			const char* name = coreData.moduleStrings[i];
+			if (!name || name[0] == 0)
+				continue;
+
+			if (wavetableCore)
+				sources.addWavetableSource(processInfo.wavetableDatabase->getTableSource(name));
+			else
+				sources.addSampleSource(processInfo.sampleDatabase->getSampleSource(name));
+		}
+	}
+
+	/**
+	\brief
+	Residency: adds the sources of the selected core; unselected cores are not reachable
+	until they are selected, which is followed by a new residency update
+
+	\param sources the list to add to
+	*/
+	void SynthModule::addReachableSources(ReachableSources& sources)
+	{
+		// --- runs on the message thread: by the published index, not selectedCore
+		int32_t selected = selectedCoreIndex.load(std::memory_order_acquire);
+		if (selected >= 0 && isModuleCoreInstantiated((uint32_t)selected))
+			moduleCores[selected]->addReachableSources(sources, coreProcessData);
+	}
+
 	/**
 	\brief
 	Clears out the module core pointer list
@@ -1732,7 +2371,14 @@ namespace SynthLab
 		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
 		{
 			moduleCores[i] = nullptr;
+			coreFactories[i] = nullptr;
+			coreFactoryNames[i] = nullptr;
 		}
+		selectedCore = nullptr;
+		coreNoteOns = 0;
+		coreNoteOffs = 0;
+		publishBuiltCores();
+		publishSelectedCore();
 		return true;
 	}
 
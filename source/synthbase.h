@@ -10,9 +10,13 @@
 #include <memory>
 #include <algorithm>
 #include <map>
+#include <mutex>
+#include <atomic>
+#include <cstring>
 
 #include "synthstructures.h"
 #include "synthlabparams.h"
+#include "synthkernels.h"
 
 #define _MATH_DEFINES_DEFINED
 
@@ -42,6 +46,7 @@ namespace SynthLab
 		bool reduced_unison_count = false;
 		bool analog_fgn_filters = false;
 		bool parameterSmoothing = true;
+		const char* kernelISA = nullptr;	///< force "scalar", "sse4.1", "avx2" or "avx512" block kernels; nullptr = detect; process-wide, the first engine's request wins
 	};
 	
 	// ---------------------- SYNTH OBJECTS WITHOUT BASE CLASES --------------------------------------------- //
@@ -105,7 +110,29 @@ namespace SynthLab
 		uint32_t getSamplesInBlock() { return samplesInBlock; }
 		void setSamplesInBlock(uint32_t _samplesInBlock);
 
+		/** silence flags, one bit per channel; producers set them when they know a block is all zeros
+		    and consumers may then skip processing; a cleared bit means "may contain audio" so
+		    producers that never set the flags are always handled correctly */
+		void setInputSilent(uint32_t channel, bool silent) { if (silent) inputSilenceFlags |= (1u << channel); else inputSilenceFlags &= ~(1u << channel); }
+		void setOutputSilent(uint32_t channel, bool silent) { if (silent) outputSilenceFlags |= (1u << channel); else outputSilenceFlags &= ~(1u << channel); }
+		bool isInputSilent(uint32_t channel) { return (inputSilenceFlags & (1u << channel)) != 0; }
+		bool isOutputSilent(uint32_t channel) { return (outputSilenceFlags & (1u << channel)) != 0; }
+		bool allInputsSilent() { return numInputChannels > 0 && (inputSilenceFlags & channelMask(numInputChannels)) == channelMask(numInputChannels); }
+		bool allOutputsSilent() { return numOutputChannels > 0 && (outputSilenceFlags & channelMask(numOutputChannels)) == channelMask(numOutputChannels); }
+		void setInputSilenceFlags(uint32_t flags) { inputSilenceFlags = flags; }
+		void setOutputSilenceFlags(uint32_t flags) { outputSilenceFlags = flags; }
+		uint32_t getInputSilenceFlags() { return inputSilenceFlags; }
+		uint32_t getOutputSilenceFlags() { return outputSilenceFlags; }
+
+		/** heap owned by the buffers (not including this object) */
+		uint64_t getAllocatedBytes() {
+			return (uint64_t)(numInputChannels + numOutputChannels) * (sizeof(float*) + blockSize * sizeof(float));
+		}
+
 	protected:
+		/** bits for the first numChannels channels */
+		static uint32_t channelMask(uint32_t numChannels) { return numChannels >= 32 ? ALL_CHANNELS_SILENT : (1u << numChannels) - 1; }
+
 		void destroyInputBuffers();
 		void destroyOutputBuffers();
 		float** inputBuffer = nullptr;	///< array of input buffer pointers
@@ -114,6 +141,8 @@ namespace SynthLab
 		uint32_t numOutputChannels = 1;
 		uint32_t blockSize = 64;		///< the maximum block size
 		uint32_t samplesInBlock = 64;	///< the number of samples to process in the block (in case of partial blocks)
+		uint32_t inputSilenceFlags = 0;	///< set bit = input channel block is silent
+		uint32_t outputSilenceFlags = 0;///< set bit = output channel block is silent
 	};
 
 
@@ -584,6 +613,23 @@ namespace SynthLab
 	};
 
 	// ---------------------- WAVETABLES --------------------------------------------------------- //
+	/**
+	\struct MemoryRegion
+	\ingroup SynthStructures
+	\brief
+	One block of memory that a wavetable or PCM sample source reads from while rendering;
+	used by the ResidencyManager to prefault and lock the data of the active patch
+	*/
+	struct MemoryRegion
+	{
+		MemoryRegion() {}
+		MemoryRegion(const void* _address, uint64_t _bytes) : address(_address), bytes(_bytes) {}
+
+		const void* address = nullptr;	///< start of the block
+		uint64_t bytes = 0;				///< size of the block
+	};
+	typedef std::vector<MemoryRegion> MemoryRegionList;
+
 	/**
 	\class IWavetableSource
 	\ingroup SynthInterfaces
@@ -645,6 +691,23 @@ namespace SynthLab
 		//\return the table index (unique) for faster iteration (OPTIONAL), or -1 if not found
 		//*/
 		//virtual int32_t getWaveformIndex() { return -1; }
+
+		/**
+		\brief
+		OPTIONAL: bytes of table data this source reads from, for memory accounting
+
+		\return table bytes, or 0 if unknown
+		*/
+		virtual uint64_t getTableMemoryBytes() { return 0; }
+
+		/**
+		\brief
+		OPTIONAL: the memory blocks this source reads from, for the ResidencyManager;
+		sources that do not override this are not prefaulted or locked
+
+		\param regions list to append the blocks to
+		*/
+		virtual void getMemoryRegions(MemoryRegionList& regions) { }
 	};
 
 	/**
@@ -678,6 +741,16 @@ namespace SynthLab
 		\return an IWavetableSource pointer to the source
 		*/
 		virtual IWavetableSource* getTableSource(const char* uniqueTableName) = 0;
+
+		/**
+		\brief
+		OPTIONAL: get a table source by the index returned from addTableSource( ) or getWaveformIndex( );
+		this is the lookup for the audio thread, the name lookup is for setup
+
+		\param uniqueTableIndex the index of the table source
+
+		\return an IWavetableSource pointer to the source, or nullptr if there is none at the index
+		*/
 		virtual IWavetableSource* getTableSource(uint32_t uniqueTableIndex) { return nullptr; }
 
 		/**
@@ -700,6 +773,20 @@ namespace SynthLab
 		*/
 		virtual bool removeTableSource(const char* uniqueTableName) = 0;
 
+		/**
+		\brief
+		OPTIONAL: puts a source under a name at runtime, replacing the source that has it (or adding
+		the name); the name keeps its index, so the cores switch to the new source on their next
+		update( ), and later add/remove calls for the name leave it alone
+
+		\param uniqueTableName the name of the table source
+		\param tableSource the IWavetableSource interface pointer to the object
+		\param uniqueIndex returns the index of the name
+
+		\return true if sucessful, false if not supported
+		*/
+		virtual bool replaceTableSource(const char* uniqueTableName, IWavetableSource* tableSource, uint32_t& uniqueIndex) { return false; }
+
 		/**
 		\brief
 		clear all source pointers
@@ -736,6 +823,26 @@ namespace SynthLab
 		uint32_t numActiveChannels = 0; ///< number of active channels; not used in SynthLab but available
 	};
 
+	/**
+	\struct PCMSampleData
+	\ingroup SynthStructures
+	\brief
+	Read-only view of the buffer of a PCM sample, for cores that read the samples directly
+	(e.g. many grains at once) instead of through IPCMSampleSource::readSample( )
+	- stereo samples are interleaved L, R
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included in Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 05 / 02
+	*/
+	struct PCMSampleData
+	{
+		const float* samples = nullptr;	///< sample buffer
+		uint32_t frames = 0;			///< samples per channel
+		uint32_t channels = 0;			///< 1 or 2
+	};
+
 	/** \ingroup Constants-Enums
 	SampleLoopMode fpr PCM sample read operation */
 	enum class SampleLoopMode { loop, sustain, oneShot };
@@ -814,6 +921,34 @@ namespace SynthLab
 		query for valid samples; needed if WAV parsing fails and we need to delete the entry
 		*/
 		virtual bool haveValidSamples() = 0;
+
+		/**
+		\brief
+		OPTIONAL: bytes of sample data held by this source, for memory accounting
+
+		\return sample bytes, or 0 if unknown
+		*/
+		virtual uint64_t getSampleMemoryBytes() { return 0; }
+
+		/**
+		\brief
+		OPTIONAL: the sample buffers this source reads from, for the ResidencyManager;
+		sources that do not override this are not prefaulted or locked
+
+		\param regions list to append the buffers to
+		*/
+		virtual void getMemoryRegions(MemoryRegionList& regions) { }
+
+		/**
+		\brief
+		OPTIONAL: direct access to the buffer of the sample chosen by the last selectSample( ) call;
+		the buffer stays valid until the samples are deleted
+
+		\param sampleData receives the buffer, frame count and channel count
+
+		\return true if a sample is selected and the source exposes its buffer
+		*/
+		virtual bool getSelectedSampleData(PCMSampleData& sampleData) { return false; }
 	};
 
 	/**
@@ -878,6 +1013,48 @@ namespace SynthLab
 		\return true if sucessful, false otherwise
 		*/
 		virtual bool clearSampleSources() = 0;
+
+		/**
+		\brief
+		OPTIONAL: get a PCM sample source by the index returned from getSampleSetIndex( ); this
+		is the lookup for the audio thread, the name lookup is for setup
+
+		\param uniqueSampleSetIndex the index of the sample set
+
+		\return an IPCMSampleSource pointer to the source, or nullptr if there is none at the index
+		*/
+		virtual IPCMSampleSource* getSampleSource(uint32_t uniqueSampleSetIndex) { return nullptr; }
+
+		/**
+		\return the sample set index (unique) for faster lookup (OPTIONAL), or -1 if not found
+		*/
+		virtual int32_t getSampleSetIndex(const char* uniqueSampleSetName) { return -1; }
+	};
+
+	/**
+	\struct ReachableSources
+	\ingroup SynthStructures
+	\brief
+	The wavetable and PCM sample sources that the active patch can read while rendering;
+	filled in by the voices and modules and handed to the ResidencyManager
+	- each source is listed once; null pointers are ignored
+	*/
+	struct ReachableSources
+	{
+		std::vector<IWavetableSource*> wavetableSources;	///< reachable wavetable sources
+		std::vector<IPCMSampleSource*> sampleSources;		///< reachable PCM sample sources
+
+		/** add a wavetable source if it is not already listed */
+		void addWavetableSource(IWavetableSource* source) {
+			if (source && std::find(wavetableSources.begin(), wavetableSources.end(), source) == wavetableSources.end())
+				wavetableSources.push_back(source);
+		}
+
+		/** add a PCM sample source if it is not already listed */
+		void addSampleSource(IPCMSampleSource* source) {
+			if (source && std::find(sampleSources.begin(), sampleSources.end(), source) == sampleSources.end())
+				sampleSources.push_back(source);
+		}
 	};
 
 	/**
@@ -1093,6 +1270,140 @@ namespace SynthLab
 
 		double BPM = 120.0;			///< current BPM, needed for LFO sync to BPM
 		MIDINoteEvent noteEvent;	///< the MIDI note event for the current audio block
+
+		uint32_t outputSilenceFlags = 0;	///< OPTIONAL: core sets bits (ALL_CHANNELS_SILENT) when it rendered silence
+	};
+
+	/**
+	\ingroup Constants-Enums
+	page size used for resident memory estimates */
+	const uint64_t kMemoryPageSize = 4096;
+
+	/**
+	\brief
+	rounds a byte count up to whole pages; memory that is touched is resident in page units
+
+	\param bytes the byte count
+	\return bytes rounded up to kMemoryPageSize
+	*/
+	inline uint64_t estimateResidentBytes(uint64_t bytes)
+	{
+		return ((bytes + kMemoryPageSize - 1) / kMemoryPageSize) * kMemoryPageSize;
+	}
+
+	/**
+	\struct MemoryReport
+	\ingroup SynthStructures
+	\brief
+	One node of a memory accounting tree (engine -> voices -> modules -> cores, plus the databases)
+	- ownedBytes: memory allocated by and for this object only, including embedded members
+	- sharedBytes: memory this object uses but does not own (e.g. tables in a shared database);
+	it is owned, and counted, elsewhere so it is not added into the totals of the tree
+	- residentBytes: estimate of the owned memory touched while rendering, in whole pages; 
+	unselected cores, for example, are owned but not resident
+	- children are filled in by getMemoryReport( ) on each component
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct MemoryReport
+	{
+		MemoryReport() {}
+		MemoryReport(const std::string& _name) : name(_name) {}
+
+		std::string name;				///< component name
+		uint64_t ownedBytes = 0;		///< owned by this node (not including children)
+		uint64_t sharedBytes = 0;		///< used but owned elsewhere
+		uint64_t residentBytes = 0;		///< page-resident estimate of ownedBytes
+		std::vector<MemoryReport> children;	///< sub-components
+
+		/** add a child node; NOTE: the reference is only valid until the next addChild( ) */
+		MemoryReport& addChild(const std::string& childName) { children.push_back(MemoryReport(childName)); return children.back(); }
+
+		uint64_t getTotalOwnedBytes() const;
+		uint64_t getTotalResidentBytes() const;
+		void clearResidentBytes();
+		std::string getTreeString(uint32_t depth = 0) const;
+	};
+
+	/**
+	\struct UpdateCounters
+	\ingroup SynthStructures
+	\brief
+	Change detection statistics of update( ) calls, summed over cores, modules and voices
+	- updates: calls that checked their inputs
+	- skipped: calls whose inputs had not changed, so the recalculation was skipped
+	- the counts are written by the audio thread and are not atomic; read them between
+	render calls, or accept that the values are approximate
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct UpdateCounters
+	{
+		uint64_t updates = 0;	///< update( ) calls that checked for changes
+		uint64_t skipped = 0;	///< calls that found nothing changed
+
+		/** fraction of the updates that were skipped, 0 -> 1 */
+		double getHitRate() const { return updates > 0 ? (double)skipped / (double)updates : 0.0; }
+
+		/** sum another set of counters into this one */
+		void add(const UpdateCounters& counters) { updates += counters.updates; skipped += counters.skipped; }
+	};
+
+	/**
+	\class UpdateChangeDetector
+	\ingroup SynthObjects
+	\brief
+	Compares a compact key of the inputs of an update( ) function with the key of the last call
+	- the key holds the values the expensive part of the update depends on (parameter values,
+	modulation inputs, pitch bend and tuning), already combined where that is cheap
+	- hasChanged( ) stores the new key and counts the calls and the hits in its UpdateCounters
+	- invalidate( ) forces the next call to recalculate: call it from reset( ) and doNoteOn( )
+	or whenever state outside of the key changes
+	- the comparison is bitwise, so a key value that does not change never recalculates
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	template <uint32_t N>
+	class UpdateChangeDetector
+	{
+	public:
+		/** true if the key differs from the last one, or after invalidate( ) */
+		bool hasChanged(const double(&key)[N])
+		{
+			counters.updates++;
+			if (valid && memcmp(key, lastKey, sizeof(lastKey)) == 0)
+			{
+				counters.skipped++;
+				return false;
+			}
+
+			memcpy(lastKey, key, sizeof(lastKey));
+			valid = true;
+			return true;
+		}
+
+		/** the next hasChanged( ) returns true */
+		void invalidate() { valid = false; }
+
+		/** calls and hits so far */
+		const UpdateCounters& getCounters() const { return counters; }
+
+	protected:
+		double lastKey[N] = { 0.0 };	///< key of the last recalculation
+		bool valid = false;				///< lastKey is from a recalculation
+		UpdateCounters counters;		///< statistics
 	};
 
 	// ----------------------------------- SYNTH OBJECTS ----------------------------------------------------- //
@@ -1285,6 +1596,131 @@ namespace SynthLab
 	};
 
 
+	/**
+	\class InternedSourceTable
+	\ingroup SynthObjects
+	\brief
+	Interns source names to dense integer handles for the databases
+	- a name gets its handle the first time it is added and keeps it for the life of the table,
+	also across removeSource( ) and clearSources( ), so handles stored by cores never change meaning
+	- getSource(handle) is lock-free array indexing for the audio thread: the slots are allocated
+	once at construction and are never moved, and each slot is an atomic pointer
+	- the name functions are for setup; the owning database serializes them with its mutex
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	template <class T>
+	class InternedSourceTable
+	{
+	public:
+		InternedSourceTable(uint32_t _capacity = MAX_DATABASE_SOURCES)
+			: capacity(_capacity), slots(new std::atomic<T*>[_capacity])
+		{
+			for (uint32_t i = 0; i < capacity; i++)
+				slots[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		/** audio thread: the source at a handle, nullptr if none */
+		inline T* getSource(uint32_t handle) const
+		{
+			if (handle >= handleCount.load(std::memory_order_acquire))
+				return nullptr;
+			return slots[handle].load(std::memory_order_acquire);
+		}
+
+		/** setup: the handle of a name, -1 if it was never added */
+		int32_t findHandle(const std::string& name) const
+		{
+			std::map<std::string, uint32_t>::const_iterator it = handles.find(name);
+			return it == handles.end() ? -1 : (int32_t)it->second;
+		}
+
+		/** setup: the source of a name, nullptr if none */
+		T* getSource(const std::string& name) const
+		{
+			int32_t handle = findHandle(name);
+			return handle < 0 ? nullptr : getSource((uint32_t)handle);
+		}
+
+		/** setup: add a source; false if the name has a source or the table is full */
+		bool addSource(const std::string& name, T* source, uint32_t& handle)
+		{
+			int32_t existing = findHandle(name);
+			if (existing >= 0)
+			{
+				// --- a removed name gets its old handle back
+				if (slots[existing].load(std::memory_order_relaxed))
+					return false;
+				handle = (uint32_t)existing;
+			}
+			else
+			{
+				uint32_t count = handleCount.load(std::memory_order_relaxed);
+				if (count >= capacity)
+					return false;
+				handle = count;
+				handles.insert(std::make_pair(name, handle));
+				slots[handle].store(source, std::memory_order_release);
+				handleCount.store(count + 1, std::memory_order_release);
+				return true;
+			}
+			slots[handle].store(source, std::memory_order_release);
+			return true;
+		}
+
+		/** setup: put a source under a name, replacing the one it has; returns the old source */
+		T* replaceSource(const std::string& name, T* source, uint32_t& handle)
+		{
+			int32_t existing = findHandle(name);
+			if (existing < 0)
+			{
+				addSource(name, source, handle);
+				return nullptr;
+			}
+			handle = (uint32_t)existing;
+			return slots[handle].exchange(source, std::memory_order_acq_rel);
+		}
+
+		/** setup: remove the source of a name; the handle stays reserved for the name */
+		T* removeSource(const std::string& name)
+		{
+			int32_t handle = findHandle(name);
+			if (handle < 0)
+				return nullptr;
+			return slots[handle].exchange(nullptr, std::memory_order_acq_rel);
+		}
+
+		/** setup: remove all sources; the handles stay reserved */
+		void clearSources()
+		{
+			uint32_t count = handleCount.load(std::memory_order_relaxed);
+			for (uint32_t i = 0; i < count; i++)
+				slots[i].store(nullptr, std::memory_order_release);
+		}
+
+		/** names and handles, for iteration at setup */
+		const std::map<std::string, uint32_t>& getHandles() const { return handles; }
+
+		/** memory accounting: slots and the name dictionary (roughly key + value + 4 pointers per node) */
+		uint64_t getAllocatedBytes() const
+		{
+			uint64_t bytes = (uint64_t)capacity * sizeof(std::atomic<T*>);
+			for (std::map<std::string, uint32_t>::const_iterator it = handles.begin(); it != handles.end(); ++it)
+				bytes += sizeof(std::string) + it->first.capacity() + sizeof(uint32_t) + 4 * sizeof(void*);
+			return bytes;
+		}
+
+	protected:
+		uint32_t capacity = 0;							///< fixed number of slots
+		std::unique_ptr<std::atomic<T*>[]> slots;		///< source per handle, null if removed
+		std::atomic<uint32_t> handleCount{ 0 };		///< handles in use
+		std::map<std::string, uint32_t> handles;		///< name -> handle
+	};
+
 	/**
 	\struct WavetableDatabase
 	\ingroup SynthObjects
@@ -1294,7 +1730,13 @@ namespace SynthLab
 	- exposes the IWavetableDatabase; your own object only needs to expose this interface
 	- this is an example object to study if you want to roll your own version
 	- the wavetable sources in the database are uniquely identified with their name strings
-	- a std::map is used to make the dictionary of table sources
+	- the names are interned to dense indexes when the sources are added (see InternedSourceTable);
+	cores store the indexes at reset and look sources up by index on the audio thread
+	- thread safe: cores may be built (and add their tables) on a background thread while 
+	the audio thread reads; index lookups are lock-free, the lock is only held for name
+	lookups and inserts
+	- replaceTableSource( ) swaps the source of a name in place (e.g. an imported wavetable under
+	the name of a built-in one); the replaced names are kept from the cores' add/remove calls
 
 	\author Will Pirkle http://www.willpirkle.com
 	\remark This object is included and described in further detail in
@@ -1313,16 +1755,20 @@ namespace SynthLab
 		virtual IWavetableSource* getTableSource(uint32_t uniqueTableIndex) override;
 		virtual bool addTableSource(const char* uniqueTableName, IWavetableSource* tableSource, uint32_t& uniqueIndex) override;
 		virtual bool removeTableSource(const char* uniqueTableName) override;
+		virtual bool replaceTableSource(const char* uniqueTableName, IWavetableSource* tableSource, uint32_t& uniqueIndex) override;
 		virtual bool clearTableSources() override;
         virtual int32_t getWaveformIndex(const char* uniqueTableName) override;
 
 		/** convenience function to return this as interface pointer */
 		IWavetableDatabase* getIWavetableDatabase() { return this; }
 
+		/** memory accounting */
+		void getMemoryReport(MemoryReport& report);
+
 	protected:
-		typedef std::map < std::string, IWavetableSource* > wavetableSourceMap; ///< map that connects wavetable names to source objects
-		wavetableSourceMap wavetableDatabase;
-		std::vector<IWavetableSource*> wavetableVector;
+		InternedSourceTable<IWavetableSource> wavetableSources;	///< name -> index -> source
+		std::vector<uint32_t> replacedIndexes;	///< names given to replaceTableSource( )
+		std::mutex databaseMutex;	///< serializes the name functions
 	};
 
 
@@ -1335,7 +1781,8 @@ namespace SynthLab
 	- exposes the IPCMSampleDatabase; your own object only needs to expose this interface
 	- this is an example object to study if you want to roll your own version
 	- the PCM sources in the database are uniquely identified with their name strings
-	- a std::map is used to make the dictionary of table sources
+	- the names are interned to dense indexes, the same as the WavetableDatabase
+	- thread safe, the same as the WavetableDatabase
 
 	\author Will Pirkle http://www.willpirkle.com
 	\remark This object is included and described in further detail in
@@ -1354,14 +1801,18 @@ namespace SynthLab
 		virtual bool addSampleSource(const char* uniqueSampleSetName, IPCMSampleSource* sampleSource) override;
 		virtual bool removeSampleSource(const char* uniqueSampleSetName) override;
 		virtual bool clearSampleSources() override;
+		virtual IPCMSampleSource* getSampleSource(uint32_t uniqueSampleSetIndex) override;
+		virtual int32_t getSampleSetIndex(const char* uniqueSampleSetName) override;
 
 		/** convenience function to return this as interface pointer */
 		IPCMSampleDatabase* getIPCMSampleDatabase() { return this; }
 
+		/** memory accounting */
+		void getMemoryReport(MemoryReport& report);
+
 	protected:
-		typedef std::map < std::string, IPCMSampleSource* >sampleSourceMap;
-		sampleSourceMap sampleDatabase;///< map that connects PCM sample set names to source objects
-		std::vector<IPCMSampleSource*> sources;
+		InternedSourceTable<IPCMSampleSource> sampleSources;	///< name -> index -> source
+		std::mutex databaseMutex;	///< serializes the name functions
 	};
 
 	/**
@@ -1394,6 +1845,13 @@ namespace SynthLab
 		uint64_t getMidiEventCount();
 		midiEvent* getMidiEvent(uint32_t index);
 
+		/** parameter automation events and functions; the engine splits its render slices at
+		    their offsets just as it does for MIDI events */
+		void pushParameterEvent(ParameterEvent event);
+		void clearParameterEvents();
+		uint64_t getParameterEventCount();
+		ParameterEvent* getParameterEvent(uint32_t index);
+
 		/** Aux information from the DAW */
 		double absoluteBufferTime_Sec = 0.0;			///< the time in seconds of the sample index at top of buffer
 		double BPM = 0.0;								///< beats per minute, aka "tempo"
@@ -1403,6 +1861,9 @@ namespace SynthLab
 	protected:
 		/** set of MIDI events for this audio processing block */
 		std::vector<midiEvent> midiEventQueue;          ///< queue 
+
+		/** set of parameter automation events for this audio processing block */
+		std::vector<ParameterEvent> parameterEventQueue;	///< queue
 	};
 
 	/**
@@ -1563,6 +2024,47 @@ namespace SynthLab
 		*/
 		ModuleCoreData& getModuleData() { return coreData; }
 
+		/**
+		\brief
+		memory accounting: size of the derived object including embedded tables;
+		derived cores get it from MemoryAccounted<Derived, ModuleCore>
+		*/
+		virtual uint64_t getObjectSize() { return sizeof(ModuleCore); }
+
+		/**
+		\brief
+		memory accounting: adds this core's owned memory to the report; cores with 
+		heap members (lookup tables, delay lines, sub-modules) override and call this first
+		- the owning module clears the resident estimate of cores that are not selected
+
+		\param report the node for this core
+		*/
+		virtual void getMemoryReport(MemoryReport& report)
+		{
+			uint64_t bytes = getObjectSize() + (glideModulator ? sizeof(GlideModulator) : 0);
+			report.ownedBytes += bytes;
+			report.residentBytes += estimateResidentBytes(bytes);
+		}
+
+		/**
+		\brief
+		residency: adds the wavetable and PCM sample sources this core can read while rendering;
+		the default looks up the module strings of wavetable and PCM cores in their database, 
+		cores that name their sources differently override this
+
+		\param sources the list to add to
+		\param processInfo holds the database pointers
+		*/
+		virtual void addReachableSources(ReachableSources& sources, CoreProcData& processInfo);
+
+		/**
+		\brief
+		change detection: adds the counters of this core's UpdateChangeDetector, if it has one
+
+		\param counters the sum to add to
+		*/
+		virtual void addUpdateCounters(UpdateCounters& counters) { return; }
+
 	protected:
 		// --- module
 		uint32_t moduleType = UNDEFINED_MODULE; ///< type of module, LFO_MODULE, EG_MODULE, etc...
@@ -1575,6 +2077,24 @@ namespace SynthLab
 		std::unique_ptr<GlideModulator> glideModulator;	///< built-in glide modulator for oscillators
 	};
 
+	/**
+	\brief
+	Factory function that creates a ModuleCore on demand
+	- SynthModules register one factory per core slot and only construct the
+	core the first time it is selected (or its strings are queried)
+	*/
+	typedef std::shared_ptr<ModuleCore>(*ModuleCoreFactory)();
+
+	/**
+	\brief
+	Generic ModuleCore factory; use createModuleCore<ClassicWTCore> etc... as the ModuleCoreFactory
+	*/
+	template <class T>
+	std::shared_ptr<ModuleCore> createModuleCore()
+	{
+		return std::static_pointer_cast<ModuleCore>(std::make_shared<T>());
+	}
+
 	/**
 	\class SynthModule
 	\ingroup SynthObjects
@@ -1645,6 +2165,12 @@ namespace SynthLab
 		virtual bool getModKnobStrings(uint32_t coreIndex, std::vector<std::string>& modKnobStrings);
 		virtual bool getModuleCoreStrings(std::vector<std::string>& moduleCoreStrings);
 		virtual bool addModuleCore(std::shared_ptr<ModuleCore> core);
+		virtual bool addModuleCoreFactory(ModuleCoreFactory factory, uint32_t index, const char* coreName);
+		virtual bool instantiateModuleCore(uint32_t index);
+		bool instantiateAndSelectModuleCore(uint32_t index);
+		virtual std::shared_ptr<ModuleCore> buildModuleCore(uint32_t index);
+		virtual bool installModuleCore(uint32_t index, const std::shared_ptr<ModuleCore>& core);
+		bool isModuleCoreInstantiated(uint32_t index) { return index < NUM_MODULE_CORES && (builtCores.load(std::memory_order_acquire) & (1u << index)) != 0; }
 		virtual uint32_t getSelectedCoreIndex();
 		virtual bool selectModuleCore(uint32_t index);
 		virtual bool selectDefaultModuleCore();
@@ -1652,6 +2178,26 @@ namespace SynthLab
 		virtual bool clearModuleCores();
 		virtual void setStandAloneMode(bool b);
 
+		/** note messages for the cores: only the selected core gets them now; the others get
+		    the current note-on (and note-off) when they are selected, see catchUpSelectedCore( )
+		    - deferNoteOn( ) and deferNoteOff( ) record a note without delivering it, for
+		      modules that are not rendering (e.g. the dormant wave sequencing oscillators) */
+		bool doSelectedCoreNoteOn(MIDINoteEvent& noteEvent);
+		bool doSelectedCoreNoteOff(MIDINoteEvent& noteEvent);
+		void deferNoteOn(MIDINoteEvent& noteEvent);
+		void deferNoteOff(MIDINoteEvent& noteEvent);
+		void catchUpSelectedCore();
+
+		/** memory accounting; derived modules get getObjectSize( ) from MemoryAccounted<Derived, SynthModule> */
+		virtual uint64_t getObjectSize() { return sizeof(SynthModule); }
+		virtual void getMemoryReport(MemoryReport& report);
+
+		/** residency: sources the selected core can read; modules with nested modules override */
+		virtual void addReachableSources(ReachableSources& sources);
+
+		/** change detection: counters of the cores; modules with nested modules or their own detector override */
+		virtual void addUpdateCounters(UpdateCounters& counters);
+
 	protected:
 		/** modulation input bus */
 		std::shared_ptr<Modulators> modulationInput = std::make_shared<Modulators>();
@@ -1675,6 +2221,34 @@ namespace SynthLab
 		std::shared_ptr<ModuleCore> moduleCores[NUM_MODULE_CORES];
 		std::shared_ptr<ModuleCore> selectedCore = nullptr;
 
+		/**  for lazy core construction; a slot with a factory and no core is built off the audio thread
+		     before it is selected, see instantiateModuleCore( ) and buildModuleCore( ) */
+		ModuleCoreFactory coreFactories[NUM_MODULE_CORES] = { nullptr };
+		const char* coreFactoryNames[NUM_MODULE_CORES] = { nullptr };	///< core names, without building the cores
+
+		/** slots that hold a core, one bit each; the preparation and GUI threads read this and never
+		    the moduleCores[ ] pointer of a slot without its bit, since the audio thread writes the
+		    pointer when it installs a core; once the bit is set the slot is not written again
+		    (until clearModuleCores( ) at setup) */
+		std::atomic<uint32_t> builtCores{ 0 };
+		void publishBuiltCores();
+
+		/** slot of the selected core, -1 for none; the GUI thread reads this instead of selectedCore,
+		    which the audio thread writes */
+		std::atomic<int32_t> selectedCoreIndex{ -1 };
+		void publishSelectedCore();
+
+		/** core for reading strings: the slot's core, or a temporary one for a slot that is not built */
+		std::shared_ptr<ModuleCore> getStringsCore(uint32_t index);
+
+		/**  for lazy note delivery: the last note, and a bit per core slot for the cores that have its messages */
+		MIDINoteEvent noteOnEvent;		///< last note-on
+		MIDINoteEvent noteOffEvent;		///< its note-off
+		bool noteStarted = false;		///< a note-on was received
+		bool noteReleased = false;		///< and its note-off
+		uint32_t coreNoteOns = 0;		///< slots whose core had the note-on
+		uint32_t coreNoteOffs = 0;		///< slots whose core had the note-off
+
 		/**  for modules without cores */
 		ModuleCoreData moduleData;	///< modulestrings (16) and mod knob labels (4)
 
@@ -1687,6 +2261,42 @@ namespace SynthLab
 		std::string dllDirectory;
 	};
 
+	/**
+	\struct PreparedCore
+	\ingroup SynthStructures
+	\brief
+	A core built off the audio thread with SynthModule::buildModuleCore( ), waiting to be
+	installed in its module's slot with SynthModule::installModuleCore( )
+	*/
+	struct PreparedCore
+	{
+		SynthModule* module = nullptr;				///< owner of the slot
+		uint32_t index = 0;							///< slot
+		std::shared_ptr<ModuleCore> core = nullptr;	///< built and reset
+	};
+	typedef std::vector<PreparedCore> PreparedCoreList;
+
+	/**
+	\class MemoryAccounted
+	\ingroup SynthObjects
+	\brief
+	CRTP helper that sits between a module or core and its base and reports the derived
+	object's size for memory accounting, e.g. class LFOCore : public MemoryAccounted<LFOCore, ModuleCore>
+	- derived constructors initialize it by its injected name: MemoryAccounted(_midiInputData)
+	- heap memory is not part of sizeof: classes that own some override getMemoryReport( )
+
+	\author Will Pirkle http://www.willpirkle.com
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	template <class Derived, class Base>
+	class MemoryAccounted : public Base
+	{
+	public:
+		using Base::Base;
+		virtual uint64_t getObjectSize() override { return sizeof(Derived); }	///< for memory accounting
+	};
+
 
 	// ----------------------------------- FX-FILTERING OBJECTS ---------------------------------------------- //
 	//
@@ -1743,6 +2353,9 @@ namespace SynthLab
 		/** flush buffer by resetting all values to 0.0 */
 		void flushBuffer() { memset(&buffer[0], 0, bufferLength * sizeof(T)); }
 
+		/** memory accounting: heap owned by the buffer */
+		uint64_t getAllocatedBytes() { return buffer ? (uint64_t)bufferLength * sizeof(T) : 0; }
+
 		/** Create a buffer based on a target maximum in SAMPLES
 		//	   do NOT call from realtime audio thread; do this prior to any processing */
 		void createCircularBuffer(uint32_t _bufferLength)
@@ -1758,6 +2371,10 @@ namespace SynthLab
 			// --- reset to top
 			writeIndex = 0;
 
+			// --- keep the old buffer if it is the same size (e.g. a reset at the same
+			//     sample rate); it only needs flushing
+			bool reallocate = !buffer || _bufferLengthPowerOfTwo != bufferLength;
+
 			// --- find nearest power of 2 for buffer, save it as bufferLength
 			bufferLength = _bufferLengthPowerOfTwo;
 
@@ -1765,7 +2382,8 @@ namespace SynthLab
 			wrapMask = bufferLength - 1;
 
 			// --- create new buffer
-			buffer.reset(new T[bufferLength]);
+			if (reallocate)
+				buffer.reset(new T[bufferLength]);
 
 			// --- flush buffer
 			flushBuffer();
@@ -1862,6 +2480,9 @@ namespace SynthLab
 		/** flush the delay with 0s */
 		void clear(){ delayBuffer.flushBuffer();}
 
+		/** memory accounting: heap owned by the delay */
+		uint64_t getAllocatedBytes() { return delayBuffer.getAllocatedBytes(); }
+
 		/** 
 		\brief
 		reset the delay, calculate a new length based on sample rate and minimum pitch
@@ -2161,6 +2782,17 @@ namespace SynthLab
 			return yn;
 		}
 
+		/** true when the output for a zero input is below kSilenceThreshold, so the state can
+		    be flushed without an audible step */
+		bool isSettled() { return fabs(state[xz1]) < kSilenceThreshold && fabs(state[xz2]) < kSilenceThreshold; }
+
+		/** flush state variables; keeps the coefficients */
+		void flush()
+		{
+			for (uint32_t i = 0; i < numStates; i++)
+				state[i] = 0.0;
+		}
+
 	protected:
 		enum { xz1, xz2, yz1, yz2, numStates };
 		double state[4] = { 0.0, 0.0, 0.0, 0.0 };		///< state variables
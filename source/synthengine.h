@@ -118,7 +118,7 @@ namespace SynthLab
 		std::shared_ptr<MidiOutputData> midiOutputData = std::make_shared<MidiOutputData>();
 
 		// --- array of voice object, via pointers
-		std::unique_ptr<SynthVoice> synthVoices[MAX_VOICES] = { 0, 0, 0, 0, 0, 0, 0, 0,0, 0, 0, 0, 0, 0, 0, 0 };		///< array of voice objects for the engine
+		std::unique_ptr<SynthVoice> synthVoices[MAX_VOICES] = { nullptr };		///< array of voice objects for the engine
 
 		// --- shared tables, in case they are huge or need a long creation time
 		std::shared_ptr<WavetableDatabase> wavetableDatabase = nullptr;
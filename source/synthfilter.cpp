@@ -28,7 +28,7 @@ namespace SynthLab
 	SynthFilter::SynthFilter(std::shared_ptr<MidiInputData> _midiInputData, 
 		std::shared_ptr<FilterParameters> _parameters, 
 		uint32_t blockSize) :
-		SynthModule(_midiInputData)
+		MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- create if missing
@@ -49,11 +49,9 @@ namespace SynthLab
 		// --- setup the cores
 		if (midiInputData->getAuxDAWDataUINT(kDMBuild) == 0)
 		{
-			std::shared_ptr<VAFilterCore> vaCore = std::make_shared<VAFilterCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(vaCore));
-
-			std::shared_ptr<BQFilterCore> bqCore = std::make_shared<BQFilterCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(bqCore));
+			// --- cores are built on first selection
+			addModuleCoreFactory(createModuleCore<VAFilterCore>, 0, "VAFilters");
+			addModuleCoreFactory(createModuleCore<BQFilterCore>, 1, "BQFilters");
 		}
 
 	}
@@ -74,6 +72,8 @@ namespace SynthLab
 		selectDefaultModuleCore();
 		
 		coreProcessData.sampleRate = _sampleRate;
+		tailPeriodSamples = (uint32_t)ceil(_sampleRate / freqModLow);
+		silentTailSamples = 0;
 		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
 		{
 			if (moduleCores[i])
@@ -104,42 +104,57 @@ namespace SynthLab
 	*/
 	bool SynthFilter::render(uint32_t samplesToProcess)
 	{
+		// --- silent input and the filter's ringing has decayed: output is silent too
+		bool inputSilent = audioBuffers->allInputsSilent();
+		if (!inputSilent)
+			silentTailSamples = 0;
+		else if (silentTailSamples >= tailPeriodSamples)
+		{
+			memset(audioBuffers->getOutputBuffer(LEFT_CHANNEL), 0, samplesToProcess * sizeof(float));
+			memset(audioBuffers->getOutputBuffer(RIGHT_CHANNEL), 0, samplesToProcess * sizeof(float));
+			audioBuffers->setOutputSilenceFlags(ALL_CHANNELS_SILENT);
+			return true;
+		}
+
 		// --- update parameters for this block
 		update();
 		coreProcessData.samplesToProcess = samplesToProcess;
         if(!selectedCore) return false;
-        return selectedCore->render(coreProcessData);
+        bool rendered = selectedCore->render(coreProcessData);
+		audioBuffers->setOutputSilenceFlags(0);
+
+		// --- with silent input, keep running until the output tail has stayed below the threshold
+		//     for a full period: one quiet block can be a zero crossing of a low-fc, high-Q ring
+		if (inputSilent)
+		{
+			float* leftOutBuffer = audioBuffers->getOutputBuffer(LEFT_CHANNEL);
+			float* rightOutBuffer = audioBuffers->getOutputBuffer(RIGHT_CHANNEL);
+			float peak = 0.f;
+			for (uint32_t i = 0; i < samplesToProcess; i++)
+				peak = fmax(peak, fmax(fabs(leftOutBuffer[i]), fabs(rightOutBuffer[i])));
+			silentTailSamples = peak < kSilenceThreshold ? silentTailSamples + samplesToProcess : 0;
+		}
+		return rendered;
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool SynthFilter::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool SynthFilter::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 }
 
@@ -106,7 +106,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-class SynthFilter : public SynthModule
+class SynthFilter : public MemoryAccounted<SynthFilter, SynthModule>
 {
 public:
 	/** One and only specialized constructor; pointers may be null for stanalone */
@@ -130,6 +130,12 @@ public:
 protected:
 	/** For standalone operation only; not used in SynthLab synth projects */
 	std::shared_ptr<FilterParameters> parameters = nullptr;
+
+	/** samples of silent input with output below kSilenceThreshold; the render is skipped once
+	    they cover a period at the lowest fc, so a ringing filter's zero crossings do not end it */
+	uint32_t silentTailSamples = 0;
+	uint32_t tailPeriodSamples = 0;	///< one period at freqModLow, the lowest fc of the cores
+
 };
 
 
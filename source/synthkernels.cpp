@@ -0,0 +1,557 @@
+#include "synthkernels.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthkernels.cpp
+\author Will Pirkle
+\brief  Scalar reference block kernels and the kernel dispatcher; see synthkernels.h
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Accumulates a scaled buffer into a mix buffer (SynthVoice, DCA::renderAccumulate( ))
+
+	\param dest mix buffer
+	\param source buffer to add
+	\param count samples to process
+	\param gain scalar applied to source
+	*/
+	void mixAccumulateScalar(float* dest, const float* source, uint32_t count, float gain)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			dest[i] += source[i] * gain;
+	}
+
+	/**
+	\brief
+	Writes a scaled buffer into a mix buffer, overwriting it
+
+	\param dest mix buffer
+	\param source buffer to write
+	\param count samples to process
+	\param gain scalar applied to source
+	*/
+	void mixWriteScalar(float* dest, const float* source, uint32_t count, float gain)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			dest[i] = source[i] * gain;
+	}
+
+	/**
+	\brief
+	Scales a buffer in place (SynthEngine::applyGlobalVolume( ))
+
+	\param buffer buffer to scale
+	\param count samples to process
+	\param gain scalar
+	*/
+	void applyGainScalar(float* buffer, uint32_t count, float gain)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			buffer[i] *= gain;
+	}
+
+	/**
+	\brief
+	Linear interpolated table read with the StaticTableSource::readWaveTable( ) math, clocked
+	like SynthClock (advance, then wrap once)
+
+	\param dest output buffer
+	\param table the table; length must be a power of 2
+	\param tableLength table length
+	\param phase starting phase (0.0 -> 1.0)
+	\param phaseInc phase increment per sample (fo/fs)
+	\param outputComp output scaling
+	\param count samples to render
+
+	\return the phase after the last sample
+	*/
+	double tableReadScalar(float* dest, const double* table, uint32_t tableLength, double phase, double phaseInc, double outputComp, uint32_t count)
+	{
+		uint32_t wrapMask = tableLength - 1;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			// --- location = N(fo/fs)
+			double readLocation = tableLength * phase;
+			uint32_t readIndex = (uint32_t)readLocation;
+			uint32_t nextReadIndex = (readIndex + 1) & wrapMask;
+			double fracPart = readLocation - readIndex;
+
+			double y1 = table[readIndex & wrapMask];
+			double y2 = table[nextReadIndex];
+			dest[i] = (float)(outputComp * (y1 + (y2 - y1) * fracPart));
+
+			// --- advance and wrap
+			phase += phaseInc;
+			if (phase >= 1.0)
+				phase -= 1.0;
+		}
+		return phase;
+	}
+
+	/**
+	\brief
+	Transposed canonical biquad with the BQAudioFilter::processAudioSample( ) math, in place
+
+	\param buffer audio to filter
+	\param count samples to process
+	\param coeffs a0, a1, a2, b1, b2, c0, d0
+	\param state xz1, xz2; updated
+	*/
+	void biquadScalar(float* buffer, uint32_t count, const double* coeffs, double* state)
+	{
+		enum { a0, a1, a2, b1, b2, c0, d0 };
+		enum { xz1, xz2 };
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			double xn = buffer[i];
+			double yn = coeffs[a0] * xn + state[xz1];
+
+			// --- shuffle/update
+			state[xz1] = coeffs[a1] * xn - coeffs[b1] * yn + state[xz2];
+			state[xz2] = coeffs[a2] * xn - coeffs[b2] * yn;
+			buffer[i] = (float)(xn*coeffs[d0] + yn*coeffs[c0]);
+		}
+	}
+
+	/**
+	\brief
+	Renders one linear EG segment (LinearEGCore attack/decay/release steps)
+
+	\param dest output buffer
+	\param count samples to render
+	\param value starting value
+	\param increment step per sample
+
+	\return the value after the last sample
+	*/
+	double linearRampScalar(float* dest, uint32_t count, double value, double increment)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			dest[i] = (float)value;
+			value += increment;
+		}
+		return value;
+	}
+
+	/**
+	\brief
+	Fast white noise, the same generator as NoiseGenerator::doWhiteNoise( )
+	- https://www.musicdsp.org/en/latest/Synthesis/216-fast-whitenoise-generator.html
+	- unsigned arithmetic for the wrap-around that the original relies on
+
+	\param dest output buffer
+	\param count samples to render
+	\param state the two seed words (0x67452301, 0xefcdab89 initially); updated
+	*/
+	void whiteNoiseScalar(float* dest, uint32_t count, int32_t* state)
+	{
+		const float scale = 2.0f / 0xffffffff;
+		uint32_t x1 = (uint32_t)state[0];
+		uint32_t x2 = (uint32_t)state[1];
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			x1 ^= x2;
+			dest[i] = (int32_t)x2 * scale;
+			x2 += x1;
+		}
+
+		state[0] = (int32_t)x1;
+		state[1] = (int32_t)x2;
+	}
+
+	/**
+	\brief
+	16-bit PCM to float with the PCMSample conversion
+
+	\param dest output buffer
+	\param source 16-bit samples
+	\param count samples to convert
+	*/
+	void int16ToFloatScalar(float* dest, const int16_t* source, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			dest[i] = ((float)source[i]) / 32768.f;
+	}
+
+	/**
+	\brief
+	Double to float conversion
+
+	\param dest output buffer
+	\param source double samples
+	\param count samples to convert
+	*/
+	void doubleToFloatScalar(float* dest, const double* source, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+			dest[i] = (float)source[i];
+	}
+
+	/**
+	\brief
+	Bank of complex rotators, the recursive sine oscillators of the AdditiveCore
+	- per sample: the output is the sum of amp * im over the partials, then each rotator
+	turns by its increment and each amplitude takes one ramp step
+	- structure-of-arrays so that the vector versions run one partial per lane; they only
+	differ from this version in the order of the sum
+
+	\param dest output buffer (overwritten)
+	\param count samples to render
+	\param re rotator real parts; updated
+	\param im rotator imaginary parts, the sine outputs; updated
+	\param cosInc cos(w) of each partial
+	\param sinInc sin(w) of each partial
+	\param amp amplitude of each partial; updated
+	\param ampInc amplitude ramp step per sample
+	\param partials number of partials
+	*/
+	void rotatorBankScalar(float* dest, uint32_t count, double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t partials)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			double sum = 0.0;
+			for (uint32_t k = 0; k < partials; k++)
+			{
+				sum += amp[k] * im[k];
+				double nextRe = re[k] * cosInc[k] - im[k] * sinInc[k];
+				im[k] = re[k] * sinInc[k] + im[k] * cosInc[k];
+				re[k] = nextRe;
+				amp[k] += ampInc[k];
+			}
+			dest[i] = (float)sum;
+		}
+	}
+
+	/**
+	\brief
+	One Hann windowed grain of the GranularCore, added into the output
+	- the read locations are computed from the start of the call rather than accumulated, so
+	that the vector versions, which compute several at once, read the same locations
+
+	\param destL left output buffer (accumulated)
+	\param destR right output buffer (accumulated)
+	\param count samples to render
+	\param samples mono or interleaved stereo sample buffer
+	\param channels 1 or 2
+	\param readIndex frame location of the first output sample
+	\param readInc frames per output sample
+	\param window the window table
+	\param windowPhase window table location of the first output sample
+	\param windowInc window table increment per output sample
+	\param gainL left gain
+	\param gainR right gain
+	*/
+	void grainAccumulateScalar(float* destL, float* destR, uint32_t count, const float* samples, uint32_t channels,
+		double readIndex, double readInc, const double* window, double windowPhase, double windowInc, float gainL, float gainR)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			double position = readIndex + (double)i * readInc;
+			uint32_t index = (uint32_t)position;
+			double frac = position - (double)index;
+
+			double windowPosition = windowPhase + (double)i * windowInc;
+			uint32_t windowIndex = (uint32_t)windowPosition;
+			double windowFrac = windowPosition - (double)windowIndex;
+			double w = window[windowIndex] + (window[windowIndex + 1] - window[windowIndex]) * windowFrac;
+
+			double left = 0.0;
+			double right = 0.0;
+			if (channels == 1)
+			{
+				double s0 = samples[index];
+				left = right = s0 + (samples[index + 1] - s0) * frac;
+			}
+			else
+			{
+				double l0 = samples[2 * index];
+				double r0 = samples[2 * index + 1];
+				left = l0 + (samples[2 * index + 2] - l0) * frac;
+				right = r0 + (samples[2 * index + 3] - r0) * frac;
+			}
+
+			destL[i] += (float)(w * left * gainL);
+			destR[i] += (float)(w * right * gainR);
+		}
+	}
+
+	// --- fills the scalar table once, see getScalarKernels( )
+	static SynthKernelTable makeScalarKernels()
+	{
+		SynthKernelTable kernels;
+		kernels.variantName = "scalar";
+		kernels.mixAccumulate = mixAccumulateScalar;
+		kernels.mixWrite = mixWriteScalar;
+		kernels.applyGain = applyGainScalar;
+		kernels.tableRead = tableReadScalar;
+		kernels.biquad = biquadScalar;
+		kernels.linearRamp = linearRampScalar;
+		kernels.whiteNoise = whiteNoiseScalar;
+		kernels.int16ToFloat = int16ToFloatScalar;
+		kernels.doubleToFloat = doubleToFloatScalar;
+		kernels.rotatorBank = rotatorBankScalar;
+		kernels.grainAccumulate = grainAccumulateScalar;
+		return kernels;
+	}
+
+	/**
+	\brief
+	The scalar reference kernel table
+
+	\return the table, valid for the life of the process
+	*/
+	const SynthKernelTable& getScalarKernels()
+	{
+		static const SynthKernelTable scalarKernels = makeScalarKernels();
+		return scalarKernels;
+	}
+
+	// --- Dispatch ------------------------------------------------------------------------------------- //
+	static const char* kernelISANames[static_cast<uint32_t>(KernelISA::kNumKernelISAs)] = { "scalar", "sse4.1", "avx2", "avx512" };
+
+	enum { kMixAccumulate, kMixWrite, kApplyGain, kTableRead, kBiquad, kLinearRamp, kWhiteNoise, kInt16ToFloat, kDoubleToFloat, kRotatorBank, kGrainAccumulate, kNumBoundKernels };
+	static const char* boundKernelNames[kNumBoundKernels] =
+	{ "mixAccumulate", "mixWrite", "applyGain", "tableRead", "biquad", "linearRamp", "whiteNoise", "int16ToFloat", "doubleToFloat", "rotatorBank", "grainAccumulate" };
+
+	/**
+	\struct KernelBinding
+	\brief
+	The bound table plus the ISA each kernel came from, for the report
+	- built once by initSynthKernels( ) and never changed after it is published
+	*/
+	struct KernelBinding
+	{
+		KernelBinding() : table(makeScalarKernels())
+		{
+			for (uint32_t i = 0; i < kNumBoundKernels; i++)
+				kernelISA[i] = KernelISA::kScalar;
+		}
+
+		SynthKernelTable table;
+		KernelISA kernelISA[kNumBoundKernels];
+		KernelISA boundISA = KernelISA::kScalar;
+		std::string request = "none (scalar)";
+	};
+
+	static KernelBinding& getKernelBinding()
+	{
+		static KernelBinding binding;
+		return binding;
+	}
+
+	// --- the published binding; nullptr (scalar) until initSynthKernels( ) has run
+	static std::atomic<const KernelBinding*> boundKernelBinding(nullptr);
+	static std::once_flag kernelBindingFlag;
+
+	// --- replaces the bound kernel when the ISA table has a version of it
+	template <typename KernelType>
+	static void bindKernel(KernelType& bound, KernelISA& boundISA, KernelType candidate, KernelISA isa)
+	{
+		if (!candidate) return;
+		bound = candidate;
+		boundISA = isa;
+	}
+
+	/**
+	\brief
+	The kernel table for an ISA level
+
+	\param isa the ISA level
+	\return the table, or nullptr if not built for this platform
+	*/
+	const SynthKernelTable* getISAKernels(KernelISA isa)
+	{
+		switch (isa)
+		{
+			case KernelISA::kScalar: return &getScalarKernels();
+			case KernelISA::kSSE41: return getSSE41Kernels();
+			case KernelISA::kAVX2: return getAVX2Kernels();
+			case KernelISA::kAVX512: return getAVX512Kernels();
+			default: return nullptr;
+		}
+	}
+
+	/**
+	\brief
+	Checks the CPU (and OS) for an ISA level
+
+	\param isa the ISA level
+	\return true if the kernels of that level can run here
+	*/
+	bool isKernelISASupported(KernelISA isa)
+	{
+		const CPUFeatures& cpu = getCPUFeatures();
+		switch (isa)
+		{
+			case KernelISA::kScalar: return true;
+			case KernelISA::kSSE41: return cpu.sse41 && getSSE41Kernels();
+			case KernelISA::kAVX2: return cpu.avx2 && getAVX2Kernels();
+			case KernelISA::kAVX512: return cpu.avx512f && getAVX512Kernels();
+			default: return false;
+		}
+	}
+
+	/**
+	\return name of an ISA level, as used by initSynthKernels( )
+	*/
+	const char* getKernelISAName(KernelISA isa)
+	{
+		uint32_t index = static_cast<uint32_t>(isa);
+		return index < static_cast<uint32_t>(KernelISA::kNumKernelISAs) ? kernelISANames[index] : "unknown";
+	}
+
+	/**
+	\brief
+	Detects the CPU features and fills the binding; runs once, from initSynthKernels( )
+
+	\param binding the binding to fill, not published yet
+	\param forcedISA OPTIONAL override, "scalar", "sse4.1", "avx2" or "avx512"
+	*/
+	static void bindSynthKernels(KernelBinding& binding, const char* forcedISA)
+	{
+		const char* source = "argument";
+		if (!forcedISA)
+		{
+			forcedISA = getenv("SYNTHLAB_KERNELS");
+			source = "SYNTHLAB_KERNELS";
+		}
+
+		// --- highest supported level, or the forced level if it is supported
+		KernelISA bestISA = KernelISA::kScalar;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(KernelISA::kNumKernelISAs); i++)
+		{
+			if (isKernelISASupported(static_cast<KernelISA>(i)))
+				bestISA = static_cast<KernelISA>(i);
+		}
+
+		KernelISA selectedISA = bestISA;
+		binding.request = "auto";
+		if (forcedISA && *forcedISA)
+		{
+			bool found = false;
+			for (uint32_t i = 0; i < static_cast<uint32_t>(KernelISA::kNumKernelISAs); i++)
+			{
+				if (strcmp(forcedISA, kernelISANames[i]) == 0)
+				{
+					found = true;
+					if (static_cast<uint32_t>(bestISA) >= i)
+						selectedISA = static_cast<KernelISA>(i);
+					break;
+				}
+			}
+			binding.request = std::string(forcedISA) + " (" + source + ")";
+			if (!found)
+				binding.request += " - unknown ISA, ignored";
+			else if (strcmp(forcedISA, kernelISANames[static_cast<uint32_t>(selectedISA)]) != 0)
+				binding.request += " - not supported by this CPU";
+		}
+
+		// --- start from scalar, then each level up to the selected one replaces what it implements
+		binding.table = makeScalarKernels();
+		for (uint32_t i = 0; i < kNumBoundKernels; i++)
+			binding.kernelISA[i] = KernelISA::kScalar;
+
+		for (uint32_t i = 1; i <= static_cast<uint32_t>(selectedISA); i++)
+		{
+			KernelISA isa = static_cast<KernelISA>(i);
+			const SynthKernelTable* kernels = getISAKernels(isa);
+			if (!kernels) continue;
+
+			bindKernel(binding.table.mixAccumulate, binding.kernelISA[kMixAccumulate], kernels->mixAccumulate, isa);
+			bindKernel(binding.table.mixWrite, binding.kernelISA[kMixWrite], kernels->mixWrite, isa);
+			bindKernel(binding.table.applyGain, binding.kernelISA[kApplyGain], kernels->applyGain, isa);
+			bindKernel(binding.table.tableRead, binding.kernelISA[kTableRead], kernels->tableRead, isa);
+			bindKernel(binding.table.biquad, binding.kernelISA[kBiquad], kernels->biquad, isa);
+			bindKernel(binding.table.linearRamp, binding.kernelISA[kLinearRamp], kernels->linearRamp, isa);
+			bindKernel(binding.table.whiteNoise, binding.kernelISA[kWhiteNoise], kernels->whiteNoise, isa);
+			bindKernel(binding.table.int16ToFloat, binding.kernelISA[kInt16ToFloat], kernels->int16ToFloat, isa);
+			bindKernel(binding.table.doubleToFloat, binding.kernelISA[kDoubleToFloat], kernels->doubleToFloat, isa);
+			bindKernel(binding.table.rotatorBank, binding.kernelISA[kRotatorBank], kernels->rotatorBank, isa);
+			bindKernel(binding.table.grainAccumulate, binding.kernelISA[kGrainAccumulate], kernels->grainAccumulate, isa);
+		}
+
+		binding.boundISA = selectedISA;
+		binding.table.variantName = kernelISANames[static_cast<uint32_t>(selectedISA)];
+	}
+
+	/**
+	\brief
+	Binds the kernels for the process; see synthkernels.h
+	- the first call builds the table and publishes it; it is immutable from then on, so 
+	engines that are already rendering never see it change
+	- later calls (e.g. from other engines) return the bound level; their forcedISA is ignored
+
+	\param forcedISA OPTIONAL override, "scalar", "sse4.1", "avx2" or "avx512"
+
+	\return the bound ISA level
+	*/
+	KernelISA initSynthKernels(const char* forcedISA)
+	{
+		std::call_once(kernelBindingFlag, [forcedISA]
+		{
+			KernelBinding& binding = getKernelBinding();
+			bindSynthKernels(binding, forcedISA);
+			boundKernelBinding.store(&binding, std::memory_order_release);
+		});
+
+		return boundKernelBinding.load(std::memory_order_acquire)->boundISA;
+	}
+
+	/**
+	\brief
+	The bound kernels; call through this from the render functions
+
+	\return the bound kernel table, or the scalar table before initSynthKernels( )
+	*/
+	const SynthKernelTable& getSynthKernels()
+	{
+		const KernelBinding* binding = boundKernelBinding.load(std::memory_order_acquire);
+		return binding ? binding->table : getScalarKernels();
+	}
+
+	/**
+	\brief
+	Human readable dispatch report: CPU features, the requested and bound ISA and the
+	version of each kernel
+
+	\return the report, one item per line
+	*/
+	std::string getSynthKernelsReport()
+	{
+		// --- the unpublished binding still holds the scalar defaults
+		const KernelBinding* bound = boundKernelBinding.load(std::memory_order_acquire);
+		const KernelBinding& binding = bound ? *bound : getKernelBinding();
+		const CPUFeatures& cpu = getCPUFeatures();
+
+		std::string report = "cpu features:";
+		if (cpu.sse41) report += " sse4.1";
+		if (cpu.avx) report += " avx";
+		if (cpu.avx2) report += " avx2";
+		if (cpu.avx512f) report += " avx512f";
+		if (!cpu.sse41 && !cpu.avx) report += " (none used)";
+		report += "\nrequest: " + binding.request;
+		report += "\nbound: " + std::string(kernelISANames[static_cast<uint32_t>(binding.boundISA)]) + "\n";
+
+		for (uint32_t i = 0; i < kNumBoundKernels; i++)
+			report += "  " + std::string(boundKernelNames[i]) + ": " + kernelISANames[static_cast<uint32_t>(binding.kernelISA[i])] + "\n";
+
+		return report;
+	}
+
+} // namespace
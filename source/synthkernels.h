@@ -0,0 +1,171 @@
+#ifndef __synthKernels_h__
+#define __synthKernels_h__
+
+// --- includes
+#include <stdint.h>
+#include <string>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthkernels.h
+\author Will Pirkle
+\brief  The inner loops of the engine as stand-alone block kernels
+- each kernel is a free function working on raw arrays so that it can be swapped for an
+optimized (e.g. vectorized) version through a SynthKernelTable
+- the scalar versions are the reference: they are the loops the engine always used, moved
+here unchanged; optimized versions are checked against them with the kernel checker
+in examples/synthlab_kernelcheck
+- x86 SSE4.1, AVX2 and AVX-512 versions are in synthkernelsx86.cpp; one binary holds all of
+them and initSynthKernels( ) binds the best set for the CPU it is running on
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/** dest[i] += source[i] * gain; voice and DCA accumulation into mix buffers */
+	typedef void(*MixAccumulateKernel)(float* dest, const float* source, uint32_t count, float gain);
+
+	/** dest[i] = source[i] * gain; voice mix buffer write */
+	typedef void(*MixWriteKernel)(float* dest, const float* source, uint32_t count, float gain);
+
+	/** buffer[i] *= gain; global volume */
+	typedef void(*ApplyGainKernel)(float* buffer, uint32_t count, float gain);
+
+	/** linear interpolated wavetable read of a power-of-2 length table; returns the final phase */
+	typedef double(*TableReadKernel)(float* dest, const double* table, uint32_t tableLength, double phase, double phaseInc, double outputComp, uint32_t count);
+
+	/** transposed canonical biquad, in place; coeffs are BQCoeffs order a0, a1, a2, b1, b2, c0, d0; state is xz1, xz2 */
+	typedef void(*BiquadKernel)(float* buffer, uint32_t count, const double* coeffs, double* state);
+
+	/** linear EG segment: dest[i] = value, value += increment; returns the final value */
+	typedef double(*LinearRampKernel)(float* dest, uint32_t count, double value, double increment);
+
+	/** fast white noise (the NoiseGenerator::doWhiteNoise( ) generator); state is the two seed words */
+	typedef void(*WhiteNoiseKernel)(float* dest, uint32_t count, int32_t* state);
+
+	/** 16-bit PCM to float, -1.0 -> +1.0 */
+	typedef void(*Int16ToFloatKernel)(float* dest, const int16_t* source, uint32_t count);
+
+	/** double to float, for double precision core outputs */
+	typedef void(*DoubleToFloatKernel)(float* dest, const double* source, uint32_t count);
+
+	/** bank of complex rotators (recursive sine oscillators), structure-of-arrays with one entry per partial:
+	    dest[i] = sum(amp[k] * im[k]), then each rotator turns by (cosInc[k], sinInc[k]) and amp[k] += ampInc[k] */
+	typedef void(*RotatorBankKernel)(float* dest, uint32_t count, double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t partials);
+
+	/** one windowed grain added into a stereo output; for output sample i the sample is read at frame
+	    readIndex + i*readInc and the window at windowPhase + i*windowInc, both with linear interpolation:
+	    destL[i] += w * sL * gainL, destR[i] += w * sR * gainR (mono samples: sL = sR)
+	    - samples is mono or interleaved stereo; the caller keeps every read (and read + 1) inside the buffers */
+	typedef void(*GrainAccumulateKernel)(float* destL, float* destR, uint32_t count, const float* samples, uint32_t channels,
+		double readIndex, double readInc, const double* window, double windowPhase, double windowInc, float gainL, float gainR);
+
+	/**
+	\struct SynthKernelTable
+	\ingroup SynthStructures
+	\brief
+	One complete set of block kernels; the scalar set is the reference, optimized sets
+	provide the same functions with the same results (within the tolerance of the kernel checker)
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct SynthKernelTable
+	{
+		const char* variantName = "scalar";		///< shown in reports
+		MixAccumulateKernel mixAccumulate = nullptr;
+		MixWriteKernel mixWrite = nullptr;
+		ApplyGainKernel applyGain = nullptr;
+		TableReadKernel tableRead = nullptr;
+		BiquadKernel biquad = nullptr;
+		LinearRampKernel linearRamp = nullptr;
+		WhiteNoiseKernel whiteNoise = nullptr;
+		Int16ToFloatKernel int16ToFloat = nullptr;
+		DoubleToFloatKernel doubleToFloat = nullptr;
+		RotatorBankKernel rotatorBank = nullptr;
+		GrainAccumulateKernel grainAccumulate = nullptr;
+	};
+
+	/** the scalar reference kernels */
+	void mixAccumulateScalar(float* dest, const float* source, uint32_t count, float gain);
+	void mixWriteScalar(float* dest, const float* source, uint32_t count, float gain);
+	void applyGainScalar(float* buffer, uint32_t count, float gain);
+	double tableReadScalar(float* dest, const double* table, uint32_t tableLength, double phase, double phaseInc, double outputComp, uint32_t count);
+	void biquadScalar(float* buffer, uint32_t count, const double* coeffs, double* state);
+	double linearRampScalar(float* dest, uint32_t count, double value, double increment);
+	void whiteNoiseScalar(float* dest, uint32_t count, int32_t* state);
+	void int16ToFloatScalar(float* dest, const int16_t* source, uint32_t count);
+	void doubleToFloatScalar(float* dest, const double* source, uint32_t count);
+	void rotatorBankScalar(float* dest, uint32_t count, double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t partials);
+	void grainAccumulateScalar(float* destL, float* destR, uint32_t count, const float* samples, uint32_t channels,
+		double readIndex, double readInc, const double* window, double windowPhase, double windowInc, float gainL, float gainR);
+
+	/** the scalar reference table */
+	const SynthKernelTable& getScalarKernels();
+
+	/**
+	\enum KernelISA
+	\ingroup Constants-Enums
+	\brief
+	Instruction set levels of the kernel tables, lowest to highest
+	*/
+	enum class KernelISA : uint32_t { kScalar, kSSE41, kAVX2, kAVX512, kNumKernelISAs };
+
+	/**
+	\struct CPUFeatures
+	\ingroup SynthStructures
+	\brief
+	The CPU features that the kernel tables depend on; AVX levels also require OS support
+	for saving the wider registers
+	*/
+	struct CPUFeatures
+	{
+		bool sse41 = false;
+		bool avx = false;
+		bool avx2 = false;
+		bool avx512f = false;
+	};
+
+	/** detected once, on first call */
+	const CPUFeatures& getCPUFeatures();
+
+	/** the ISA tables; entries are nullptr for kernels that have no version for that ISA
+	    (e.g. the recursive biquad), the table is nullptr if not built for this platform */
+	const SynthKernelTable* getSSE41Kernels();
+	const SynthKernelTable* getAVX2Kernels();
+	const SynthKernelTable* getAVX512Kernels();
+	const SynthKernelTable* getISAKernels(KernelISA isa);
+	bool isKernelISASupported(KernelISA isa);
+	const char* getKernelISAName(KernelISA isa);
+
+	/**
+	\brief
+	Dispatch: detect the CPU and bind the fastest supported version of each kernel
+	- forcedISA ("scalar", "sse4.1", "avx2", "avx512") overrides the detection, for testing;
+	if null, the SYNTHLAB_KERNELS environment variable is used if it is set
+	- a forced ISA that the CPU does not support falls back to the best one it does
+	- process-wide and once only: the first call binds an immutable table, later calls return
+	the bound level and ignore their forcedISA
+	- NOT real-time safe; call before rendering (the SynthEngine constructor calls it)
+
+	\return the ISA level that was bound
+	*/
+	KernelISA initSynthKernels(const char* forcedISA = nullptr);
+
+	/** the bound kernels; the scalar table until initSynthKernels( ) is called */
+	const SynthKernelTable& getSynthKernels();
+
+	/** which version of each kernel was bound, and why; one line per kernel */
+	std::string getSynthKernelsReport();
+
+} // namespace
+
+#endif /* defined(__synthKernels_h__) */
@@ -0,0 +1,715 @@
+#include "synthkernels.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthkernelsx86.cpp
+\author Will Pirkle
+\brief  x86 CPU feature detection and the SSE4.1, AVX2 and AVX-512 block kernels
+- compiled for the baseline target; each kernel enables its own instruction set with a
+function target attribute (GCC/Clang) so the binary runs on any x64 CPU and the
+dispatcher only calls what the CPU supports
+- MSVC needs no attribute to use the intrinsics
+- avx512f implies FMA, so GCC would fuse the multiplies and adds of the AVX-512 kernels;
+they are compiled with fp-contract off to round the same way as the scalar reference
+(Clang does not contract across the intrinsics)
+- the recursive kernels (biquad, white noise) have no vector versions; the dispatcher
+keeps the scalar versions for them
+- on other platforms this file only reports "no features" and all tables are nullptr
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SYNTHLAB_KERNELS_X86 1
+#endif
+
+#ifdef SYNTHLAB_KERNELS_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SYNTHLAB_TARGET_SSE41
+#define SYNTHLAB_TARGET_AVX2
+#define SYNTHLAB_TARGET_AVX512
+#elif defined(__clang__)
+#define SYNTHLAB_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define SYNTHLAB_TARGET_AVX2 __attribute__((target("avx2")))
+#define SYNTHLAB_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SYNTHLAB_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define SYNTHLAB_TARGET_AVX2 __attribute__((target("avx2")))
+#define SYNTHLAB_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+#endif
+
+namespace SynthLab
+{
+#ifdef SYNTHLAB_KERNELS_X86
+	// --- CPUID and XGETBV ----------------------------------------------------------------------------- //
+	static void readCPUID(uint32_t info[4], uint32_t leaf, uint32_t subLeaf)
+	{
+#if defined(_MSC_VER)
+		int regs[4] = { 0, 0, 0, 0 };
+		__cpuidex(regs, (int)leaf, (int)subLeaf);
+		for (uint32_t i = 0; i < 4; i++)
+			info[i] = (uint32_t)regs[i];
+#else
+		__cpuid_count(leaf, subLeaf, info[0], info[1], info[2], info[3]);
+#endif
+	}
+
+	// --- XCR0: which register states the OS saves on a context switch
+	static uint64_t readXCR0()
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		uint32_t eax = 0, edx = 0;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((uint64_t)edx << 32) | eax;
+#endif
+	}
+
+	static CPUFeatures detectCPUFeatures()
+	{
+		CPUFeatures features;
+		uint32_t info[4] = { 0, 0, 0, 0 };
+		readCPUID(info, 0, 0);
+		uint32_t maxLeaf = info[0];
+		if (maxLeaf < 1)
+			return features;
+
+		// --- leaf 1: ECX bit 19 = SSE4.1, 27 = OSXSAVE, 28 = AVX
+		readCPUID(info, 1, 0);
+		features.sse41 = (info[2] & (1u << 19)) != 0;
+		bool osxsave = (info[2] & (1u << 27)) != 0;
+		bool avx = (info[2] & (1u << 28)) != 0;
+
+		// --- the OS must save XMM/YMM (bits 1, 2) for AVX and also opmask/ZMM (bits 5, 6, 7) for AVX-512
+		uint64_t xcr0 = osxsave ? readXCR0() : 0;
+		bool osAVX = (xcr0 & 0x06) == 0x06;
+		bool osAVX512 = (xcr0 & 0xE6) == 0xE6;
+		features.avx = avx && osAVX;
+
+		// --- leaf 7: EBX bit 5 = AVX2, 16 = AVX-512F
+		if (maxLeaf >= 7)
+		{
+			readCPUID(info, 7, 0);
+			features.avx2 = features.avx && (info[1] & (1u << 5)) != 0;
+			features.avx512f = features.avx2 && osAVX512 && (info[1] & (1u << 16)) != 0;
+		}
+		return features;
+	}
+
+	// --- rotator bank: the partials left over after the vector lanes, same arithmetic as the scalar version
+	static inline double rotatorBankRemainder(double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t start, uint32_t partials)
+	{
+		double sum = 0.0;
+		for (uint32_t k = start; k < partials; k++)
+		{
+			sum += amp[k] * im[k];
+			double nextRe = re[k] * cosInc[k] - im[k] * sinInc[k];
+			im[k] = re[k] * sinInc[k] + im[k] * cosInc[k];
+			re[k] = nextRe;
+			amp[k] += ampInc[k];
+		}
+		return sum;
+	}
+
+	// --- SSE4.1 --------------------------------------------------------------------------------------- //
+	SYNTHLAB_TARGET_SSE41 static void mixAccumulateSSE41(float* dest, const float* source, uint32_t count, float gain)
+	{
+		__m128 g = _mm_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(_mm_loadu_ps(source + i), g)));
+		for (; i < count; i++)
+			dest[i] += source[i] * gain;
+	}
+
+	SYNTHLAB_TARGET_SSE41 static void mixWriteSSE41(float* dest, const float* source, uint32_t count, float gain)
+	{
+		__m128 g = _mm_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dest + i, _mm_mul_ps(_mm_loadu_ps(source + i), g));
+		for (; i < count; i++)
+			dest[i] = source[i] * gain;
+	}
+
+	SYNTHLAB_TARGET_SSE41 static void applyGainSSE41(float* buffer, uint32_t count, float gain)
+	{
+		__m128 g = _mm_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), g));
+		for (; i < count; i++)
+			buffer[i] *= gain;
+	}
+
+	SYNTHLAB_TARGET_SSE41 static double linearRampSSE41(float* dest, uint32_t count, double value, double increment)
+	{
+		__m128d values = _mm_set_pd(value + increment, value);
+		__m128d step = _mm_set1_pd(2.0 * increment);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 lo = _mm_cvtpd_ps(values);
+			values = _mm_add_pd(values, step);
+			__m128 hi = _mm_cvtpd_ps(values);
+			values = _mm_add_pd(values, step);
+			_mm_storeu_ps(dest + i, _mm_movelh_ps(lo, hi));
+		}
+		value = _mm_cvtsd_f64(values);
+		for (; i < count; i++)
+		{
+			dest[i] = (float)value;
+			value += increment;
+		}
+		return value;
+	}
+
+	SYNTHLAB_TARGET_SSE41 static void int16ToFloatSSE41(float* dest, const int16_t* source, uint32_t count)
+	{
+		// --- x/32768 == x*(1/32768) exactly; power of 2
+		__m128 scale = _mm_set1_ps(1.0f / 32768.f);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + i));
+			_mm_storeu_ps(dest + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(shorts)), scale));
+		}
+		for (; i < count; i++)
+			dest[i] = ((float)source[i]) / 32768.f;
+	}
+
+	SYNTHLAB_TARGET_SSE41 static void doubleToFloatSSE41(float* dest, const double* source, uint32_t count)
+	{
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(source + i));
+			__m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(source + i + 2));
+			_mm_storeu_ps(dest + i, _mm_movelh_ps(lo, hi));
+		}
+		for (; i < count; i++)
+			dest[i] = (float)source[i];
+	}
+
+	SYNTHLAB_TARGET_SSE41 static void rotatorBankSSE41(float* dest, uint32_t count, double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t partials)
+	{
+		// --- two partials per lane group; no FMA, so the rotators match the scalar version exactly
+		uint32_t vectorPartials = partials & ~1u;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			__m128d sum = _mm_setzero_pd();
+			for (uint32_t k = 0; k < vectorPartials; k += 2)
+			{
+				__m128d r = _mm_loadu_pd(re + k);
+				__m128d m = _mm_loadu_pd(im + k);
+				__m128d c = _mm_loadu_pd(cosInc + k);
+				__m128d s = _mm_loadu_pd(sinInc + k);
+				__m128d a = _mm_loadu_pd(amp + k);
+				sum = _mm_add_pd(sum, _mm_mul_pd(a, m));
+				_mm_storeu_pd(re + k, _mm_sub_pd(_mm_mul_pd(r, c), _mm_mul_pd(m, s)));
+				_mm_storeu_pd(im + k, _mm_add_pd(_mm_mul_pd(r, s), _mm_mul_pd(m, c)));
+				_mm_storeu_pd(amp + k, _mm_add_pd(a, _mm_loadu_pd(ampInc + k)));
+			}
+			double total = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+			total += rotatorBankRemainder(re, im, cosInc, sinInc, amp, ampInc, vectorPartials, partials);
+			dest[i] = (float)total;
+		}
+	}
+
+	// --- AVX2 ----------------------------------------------------------------------------------------- //
+	SYNTHLAB_TARGET_AVX2 static void mixAccumulateAVX2(float* dest, const float* source, uint32_t count, float gain)
+	{
+		__m256 g = _mm256_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(dest + i, _mm256_add_ps(_mm256_loadu_ps(dest + i), _mm256_mul_ps(_mm256_loadu_ps(source + i), g)));
+		for (; i < count; i++)
+			dest[i] += source[i] * gain;
+	}
+
+	SYNTHLAB_TARGET_AVX2 static void mixWriteAVX2(float* dest, const float* source, uint32_t count, float gain)
+	{
+		__m256 g = _mm256_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(dest + i, _mm256_mul_ps(_mm256_loadu_ps(source + i), g));
+		for (; i < count; i++)
+			dest[i] = source[i] * gain;
+	}
+
+	SYNTHLAB_TARGET_AVX2 static void applyGainAVX2(float* buffer, uint32_t count, float gain)
+	{
+		__m256 g = _mm256_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(buffer + i, _mm256_mul_ps(_mm256_loadu_ps(buffer + i), g));
+		for (; i < count; i++)
+			buffer[i] *= gain;
+	}
+
+	SYNTHLAB_TARGET_AVX2 static double tableReadAVX2(float* dest, const double* table, uint32_t tableLength, double phase, double phaseInc, double outputComp, uint32_t count)
+	{
+		const __m256d laneOffsets = _mm256_set_pd(3.0 * phaseInc, 2.0 * phaseInc, phaseInc, 0.0);
+		const __m256d length = _mm256_set1_pd((double)tableLength);
+		const __m256d comp = _mm256_set1_pd(outputComp);
+		const __m128i wrapMask = _mm_set1_epi32((int)(tableLength - 1));
+		const __m128i one = _mm_set1_epi32(1);
+		const double blockInc = 4.0 * phaseInc;
+
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			// --- four phases, each wrapped like the SynthClock
+			__m256d p = _mm256_add_pd(_mm256_set1_pd(phase), laneOffsets);
+			p = _mm256_sub_pd(p, _mm256_floor_pd(p));
+
+			// --- location = N(fo/fs), split into int.frac
+			__m256d location = _mm256_mul_pd(length, p);
+			__m128i readIndex = _mm256_cvttpd_epi32(location);
+			__m256d fracPart = _mm256_sub_pd(location, _mm256_cvtepi32_pd(readIndex));
+			__m128i nextReadIndex = _mm_and_si128(_mm_add_epi32(readIndex, one), wrapMask);
+			readIndex = _mm_and_si128(readIndex, wrapMask);
+
+			// --- two gathers, interpolate, scale
+			__m256d y1 = _mm256_i32gather_pd(table, readIndex, 8);
+			__m256d y2 = _mm256_i32gather_pd(table, nextReadIndex, 8);
+			__m256d output = _mm256_mul_pd(comp, _mm256_add_pd(y1, _mm256_mul_pd(_mm256_sub_pd(y2, y1), fracPart)));
+			_mm_storeu_ps(dest + i, _mm256_cvtpd_ps(output));
+
+			phase += blockInc;
+			while (phase >= 1.0)
+				phase -= 1.0;
+		}
+
+		// --- remainder, same as the scalar version
+		if (i < count)
+			phase = tableReadScalar(dest + i, table, tableLength, phase, phaseInc, outputComp, count - i);
+		return phase;
+	}
+
+	SYNTHLAB_TARGET_AVX2 static double linearRampAVX2(float* dest, uint32_t count, double value, double increment)
+	{
+		__m256d values = _mm256_add_pd(_mm256_set1_pd(value), _mm256_set_pd(3.0 * increment, 2.0 * increment, increment, 0.0));
+		__m256d step = _mm256_set1_pd(4.0 * increment);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(dest + i, _mm256_cvtpd_ps(values));
+			values = _mm256_add_pd(values, step);
+		}
+		value = _mm_cvtsd_f64(_mm256_castpd256_pd128(values));
+		for (; i < count; i++)
+		{
+			dest[i] = (float)value;
+			value += increment;
+		}
+		return value;
+	}
+
+	SYNTHLAB_TARGET_AVX2 static void int16ToFloatAVX2(float* dest, const int16_t* source, uint32_t count)
+	{
+		__m256 scale = _mm256_set1_ps(1.0f / 32768.f);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i shorts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+			_mm256_storeu_ps(dest + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts)), scale));
+		}
+		for (; i < count; i++)
+			dest[i] = ((float)source[i]) / 32768.f;
+	}
+
+	SYNTHLAB_TARGET_AVX2 static void doubleToFloatAVX2(float* dest, const double* source, uint32_t count)
+	{
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dest + i, _mm256_cvtpd_ps(_mm256_loadu_pd(source + i)));
+		for (; i < count; i++)
+			dest[i] = (float)source[i];
+	}
+
+	SYNTHLAB_TARGET_AVX2 static void rotatorBankAVX2(float* dest, uint32_t count, double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t partials)
+	{
+		// --- four partials per lane group; no FMA, so the rotators match the scalar version exactly
+		uint32_t vectorPartials = partials & ~3u;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			__m256d sum = _mm256_setzero_pd();
+			for (uint32_t k = 0; k < vectorPartials; k += 4)
+			{
+				__m256d r = _mm256_loadu_pd(re + k);
+				__m256d m = _mm256_loadu_pd(im + k);
+				__m256d c = _mm256_loadu_pd(cosInc + k);
+				__m256d s = _mm256_loadu_pd(sinInc + k);
+				__m256d a = _mm256_loadu_pd(amp + k);
+				sum = _mm256_add_pd(sum, _mm256_mul_pd(a, m));
+				_mm256_storeu_pd(re + k, _mm256_sub_pd(_mm256_mul_pd(r, c), _mm256_mul_pd(m, s)));
+				_mm256_storeu_pd(im + k, _mm256_add_pd(_mm256_mul_pd(r, s), _mm256_mul_pd(m, c)));
+				_mm256_storeu_pd(amp + k, _mm256_add_pd(a, _mm256_loadu_pd(ampInc + k)));
+			}
+			__m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+			double total = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+			total += rotatorBankRemainder(re, im, cosInc, sinInc, amp, ampInc, vectorPartials, partials);
+			dest[i] = (float)total;
+		}
+	}
+
+	SYNTHLAB_TARGET_AVX2 static void grainAccumulateAVX2(float* destL, float* destR, uint32_t count, const float* samples, uint32_t channels,
+		double readIndex, double readInc, const double* window, double windowPhase, double windowInc, float gainL, float gainR)
+	{
+		// --- four output samples per pass: gathered sample and window reads, no FMA, so the
+		//     result matches the scalar version
+		const __m256d lanes = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+		const __m256d readStart = _mm256_set1_pd(readIndex);
+		const __m256d readStep = _mm256_set1_pd(readInc);
+		const __m256d windowStart = _mm256_set1_pd(windowPhase);
+		const __m256d windowStep = _mm256_set1_pd(windowInc);
+		const __m256d leftGain = _mm256_set1_pd((double)gainL);
+		const __m256d rightGain = _mm256_set1_pd((double)gainR);
+
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m256d n = _mm256_add_pd(_mm256_set1_pd((double)i), lanes);
+
+			// --- window
+			__m256d windowPosition = _mm256_add_pd(windowStart, _mm256_mul_pd(n, windowStep));
+			__m128i windowIndex = _mm256_cvttpd_epi32(windowPosition);
+			__m256d windowFrac = _mm256_sub_pd(windowPosition, _mm256_cvtepi32_pd(windowIndex));
+			__m256d w0 = _mm256_i32gather_pd(window, windowIndex, 8);
+			__m256d w1 = _mm256_i32gather_pd(window + 1, windowIndex, 8);
+			__m256d w = _mm256_add_pd(w0, _mm256_mul_pd(_mm256_sub_pd(w1, w0), windowFrac));
+
+			// --- samples
+			__m256d position = _mm256_add_pd(readStart, _mm256_mul_pd(n, readStep));
+			__m128i index = _mm256_cvttpd_epi32(position);
+			__m256d frac = _mm256_sub_pd(position, _mm256_cvtepi32_pd(index));
+			__m256d left;
+			__m256d right;
+			if (channels == 1)
+			{
+				__m256d s0 = _mm256_cvtps_pd(_mm_i32gather_ps(samples, index, 4));
+				__m256d s1 = _mm256_cvtps_pd(_mm_i32gather_ps(samples + 1, index, 4));
+				left = right = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_sub_pd(s1, s0), frac));
+			}
+			else
+			{
+				__m128i frameIndex = _mm_slli_epi32(index, 1);
+				__m256d l0 = _mm256_cvtps_pd(_mm_i32gather_ps(samples, frameIndex, 4));
+				__m256d r0 = _mm256_cvtps_pd(_mm_i32gather_ps(samples + 1, frameIndex, 4));
+				__m256d l1 = _mm256_cvtps_pd(_mm_i32gather_ps(samples + 2, frameIndex, 4));
+				__m256d r1 = _mm256_cvtps_pd(_mm_i32gather_ps(samples + 3, frameIndex, 4));
+				left = _mm256_add_pd(l0, _mm256_mul_pd(_mm256_sub_pd(l1, l0), frac));
+				right = _mm256_add_pd(r0, _mm256_mul_pd(_mm256_sub_pd(r1, r0), frac));
+			}
+
+			__m128 outL = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_mul_pd(w, left), leftGain));
+			__m128 outR = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_mul_pd(w, right), rightGain));
+			_mm_storeu_ps(destL + i, _mm_add_ps(_mm_loadu_ps(destL + i), outL));
+			_mm_storeu_ps(destR + i, _mm_add_ps(_mm_loadu_ps(destR + i), outR));
+		}
+
+		// --- remainder, same as the scalar version
+		if (i < count)
+			grainAccumulateScalar(destL + i, destR + i, count - i, samples, channels, readIndex + (double)i * readInc, readInc,
+				window, windowPhase + (double)i * windowInc, windowInc, gainL, gainR);
+	}
+
+	// --- AVX-512 -------------------------------------------------------------------------------------- //
+	SYNTHLAB_TARGET_AVX512 static void mixAccumulateAVX512(float* dest, const float* source, uint32_t count, float gain)
+	{
+		__m512 g = _mm512_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 16 <= count; i += 16)
+			_mm512_storeu_ps(dest + i, _mm512_add_ps(_mm512_loadu_ps(dest + i), _mm512_mul_ps(_mm512_loadu_ps(source + i), g)));
+		for (; i < count; i++)
+			dest[i] += source[i] * gain;
+	}
+
+	SYNTHLAB_TARGET_AVX512 static void mixWriteAVX512(float* dest, const float* source, uint32_t count, float gain)
+	{
+		__m512 g = _mm512_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 16 <= count; i += 16)
+			_mm512_storeu_ps(dest + i, _mm512_mul_ps(_mm512_loadu_ps(source + i), g));
+		for (; i < count; i++)
+			dest[i] = source[i] * gain;
+	}
+
+	SYNTHLAB_TARGET_AVX512 static void applyGainAVX512(float* buffer, uint32_t count, float gain)
+	{
+		__m512 g = _mm512_set1_ps(gain);
+		uint32_t i = 0;
+		for (; i + 16 <= count; i += 16)
+			_mm512_storeu_ps(buffer + i, _mm512_mul_ps(_mm512_loadu_ps(buffer + i), g));
+		for (; i < count; i++)
+			buffer[i] *= gain;
+	}
+
+	SYNTHLAB_TARGET_AVX512 static double tableReadAVX512(float* dest, const double* table, uint32_t tableLength, double phase, double phaseInc, double outputComp, uint32_t count)
+	{
+		const __m512d laneOffsets = _mm512_set_pd(7.0 * phaseInc, 6.0 * phaseInc, 5.0 * phaseInc, 4.0 * phaseInc,
+												  3.0 * phaseInc, 2.0 * phaseInc, phaseInc, 0.0);
+		const __m512d length = _mm512_set1_pd((double)tableLength);
+		const __m512d comp = _mm512_set1_pd(outputComp);
+		const __m256i wrapMask = _mm256_set1_epi32((int)(tableLength - 1));
+		const __m256i one = _mm256_set1_epi32(1);
+		const double blockInc = 8.0 * phaseInc;
+
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			// --- eight phases, each wrapped like the SynthClock (round toward -inf = floor)
+			__m512d p = _mm512_add_pd(_mm512_set1_pd(phase), laneOffsets);
+			p = _mm512_sub_pd(p, _mm512_roundscale_pd(p, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+
+			__m512d location = _mm512_mul_pd(length, p);
+			__m256i readIndex = _mm512_cvttpd_epi32(location);
+			__m512d fracPart = _mm512_sub_pd(location, _mm512_cvtepi32_pd(readIndex));
+			__m256i nextReadIndex = _mm256_and_si256(_mm256_add_epi32(readIndex, one), wrapMask);
+			readIndex = _mm256_and_si256(readIndex, wrapMask);
+
+			__m512d y1 = _mm512_i32gather_pd(readIndex, table, 8);
+			__m512d y2 = _mm512_i32gather_pd(nextReadIndex, table, 8);
+			__m512d output = _mm512_mul_pd(comp, _mm512_add_pd(y1, _mm512_mul_pd(_mm512_sub_pd(y2, y1), fracPart)));
+			_mm256_storeu_ps(dest + i, _mm512_cvtpd_ps(output));
+
+			phase += blockInc;
+			while (phase >= 1.0)
+				phase -= 1.0;
+		}
+
+		if (i < count)
+			phase = tableReadScalar(dest + i, table, tableLength, phase, phaseInc, outputComp, count - i);
+		return phase;
+	}
+
+	SYNTHLAB_TARGET_AVX512 static double linearRampAVX512(float* dest, uint32_t count, double value, double increment)
+	{
+		__m512d values = _mm512_add_pd(_mm512_set1_pd(value), _mm512_set_pd(7.0 * increment, 6.0 * increment, 5.0 * increment, 4.0 * increment,
+																			3.0 * increment, 2.0 * increment, increment, 0.0));
+		__m512d step = _mm512_set1_pd(8.0 * increment);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(dest + i, _mm512_cvtpd_ps(values));
+			values = _mm512_add_pd(values, step);
+		}
+		value = _mm_cvtsd_f64(_mm512_castpd512_pd128(values));
+		for (; i < count; i++)
+		{
+			dest[i] = (float)value;
+			value += increment;
+		}
+		return value;
+	}
+
+	SYNTHLAB_TARGET_AVX512 static void int16ToFloatAVX512(float* dest, const int16_t* source, uint32_t count)
+	{
+		__m512 scale = _mm512_set1_ps(1.0f / 32768.f);
+		uint32_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m256i shorts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+			_mm512_storeu_ps(dest + i, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(shorts)), scale));
+		}
+		for (; i < count; i++)
+			dest[i] = ((float)source[i]) / 32768.f;
+	}
+
+	SYNTHLAB_TARGET_AVX512 static void doubleToFloatAVX512(float* dest, const double* source, uint32_t count)
+	{
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(dest + i, _mm512_cvtpd_ps(_mm512_loadu_pd(source + i)));
+		for (; i < count; i++)
+			dest[i] = (float)source[i];
+	}
+
+	SYNTHLAB_TARGET_AVX512 static void rotatorBankAVX512(float* dest, uint32_t count, double* re, double* im, const double* cosInc, const double* sinInc,
+		double* amp, const double* ampInc, uint32_t partials)
+	{
+		// --- eight partials per lane group; AVX-512 includes FMA and the compiler may fuse the
+		//     multiply-adds, so the rotators can differ from the scalar version in the last bits
+		uint32_t vectorPartials = partials & ~7u;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			__m512d sum = _mm512_setzero_pd();
+			for (uint32_t k = 0; k < vectorPartials; k += 8)
+			{
+				__m512d r = _mm512_loadu_pd(re + k);
+				__m512d m = _mm512_loadu_pd(im + k);
+				__m512d c = _mm512_loadu_pd(cosInc + k);
+				__m512d s = _mm512_loadu_pd(sinInc + k);
+				__m512d a = _mm512_loadu_pd(amp + k);
+				sum = _mm512_add_pd(sum, _mm512_mul_pd(a, m));
+				_mm512_storeu_pd(re + k, _mm512_sub_pd(_mm512_mul_pd(r, c), _mm512_mul_pd(m, s)));
+				_mm512_storeu_pd(im + k, _mm512_add_pd(_mm512_mul_pd(r, s), _mm512_mul_pd(m, c)));
+				_mm512_storeu_pd(amp + k, _mm512_add_pd(a, _mm512_loadu_pd(ampInc + k)));
+			}
+			double total = _mm512_reduce_add_pd(sum);
+			total += rotatorBankRemainder(re, im, cosInc, sinInc, amp, ampInc, vectorPartials, partials);
+			dest[i] = (float)total;
+		}
+	}
+
+	SYNTHLAB_TARGET_AVX512 static void grainAccumulateAVX512(float* destL, float* destR, uint32_t count, const float* samples, uint32_t channels,
+		double readIndex, double readInc, const double* window, double windowPhase, double windowInc, float gainL, float gainR)
+	{
+		// --- eight output samples per pass; the compiler may fuse the interpolations, so the
+		//     output can differ from the scalar version in the last bits
+		const __m512d lanes = _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+		const __m512d readStart = _mm512_set1_pd(readIndex);
+		const __m512d readStep = _mm512_set1_pd(readInc);
+		const __m512d windowStart = _mm512_set1_pd(windowPhase);
+		const __m512d windowStep = _mm512_set1_pd(windowInc);
+		const __m512d leftGain = _mm512_set1_pd((double)gainL);
+		const __m512d rightGain = _mm512_set1_pd((double)gainR);
+
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m512d n = _mm512_add_pd(_mm512_set1_pd((double)i), lanes);
+
+			// --- window
+			__m512d windowPosition = _mm512_add_pd(windowStart, _mm512_mul_pd(n, windowStep));
+			__m256i windowIndex = _mm512_cvttpd_epi32(windowPosition);
+			__m512d windowFrac = _mm512_sub_pd(windowPosition, _mm512_cvtepi32_pd(windowIndex));
+			__m512d w0 = _mm512_i32gather_pd(windowIndex, window, 8);
+			__m512d w1 = _mm512_i32gather_pd(windowIndex, window + 1, 8);
+			__m512d w = _mm512_add_pd(w0, _mm512_mul_pd(_mm512_sub_pd(w1, w0), windowFrac));
+
+			// --- samples
+			__m512d position = _mm512_add_pd(readStart, _mm512_mul_pd(n, readStep));
+			__m256i index = _mm512_cvttpd_epi32(position);
+			__m512d frac = _mm512_sub_pd(position, _mm512_cvtepi32_pd(index));
+			__m512d left;
+			__m512d right;
+			if (channels == 1)
+			{
+				__m512d s0 = _mm512_cvtps_pd(_mm256_i32gather_ps(samples, index, 4));
+				__m512d s1 = _mm512_cvtps_pd(_mm256_i32gather_ps(samples + 1, index, 4));
+				left = right = _mm512_add_pd(s0, _mm512_mul_pd(_mm512_sub_pd(s1, s0), frac));
+			}
+			else
+			{
+				__m256i frameIndex = _mm256_slli_epi32(index, 1);
+				__m512d l0 = _mm512_cvtps_pd(_mm256_i32gather_ps(samples, frameIndex, 4));
+				__m512d r0 = _mm512_cvtps_pd(_mm256_i32gather_ps(samples + 1, frameIndex, 4));
+				__m512d l1 = _mm512_cvtps_pd(_mm256_i32gather_ps(samples + 2, frameIndex, 4));
+				__m512d r1 = _mm512_cvtps_pd(_mm256_i32gather_ps(samples + 3, frameIndex, 4));
+				left = _mm512_add_pd(l0, _mm512_mul_pd(_mm512_sub_pd(l1, l0), frac));
+				right = _mm512_add_pd(r0, _mm512_mul_pd(_mm512_sub_pd(r1, r0), frac));
+			}
+
+			__m256 outL = _mm512_cvtpd_ps(_mm512_mul_pd(_mm512_mul_pd(w, left), leftGain));
+			__m256 outR = _mm512_cvtpd_ps(_mm512_mul_pd(_mm512_mul_pd(w, right), rightGain));
+			_mm256_storeu_ps(destL + i, _mm256_add_ps(_mm256_loadu_ps(destL + i), outL));
+			_mm256_storeu_ps(destR + i, _mm256_add_ps(_mm256_loadu_ps(destR + i), outR));
+		}
+
+		// --- remainder, same as the scalar version
+		if (i < count)
+			grainAccumulateScalar(destL + i, destR + i, count - i, samples, channels, readIndex + (double)i * readInc, readInc,
+				window, windowPhase + (double)i * windowInc, windowInc, gainL, gainR);
+	}
+
+	// --- tables --------------------------------------------------------------------------------------- //
+	static SynthKernelTable makeSSE41Kernels()
+	{
+		SynthKernelTable kernels;
+		kernels.variantName = "sse4.1";
+		kernels.mixAccumulate = mixAccumulateSSE41;
+		kernels.mixWrite = mixWriteSSE41;
+		kernels.applyGain = applyGainSSE41;
+		kernels.linearRamp = linearRampSSE41;
+		kernels.int16ToFloat = int16ToFloatSSE41;
+		kernels.doubleToFloat = doubleToFloatSSE41;
+		kernels.rotatorBank = rotatorBankSSE41;
+		return kernels;
+	}
+
+	static SynthKernelTable makeAVX2Kernels()
+	{
+		SynthKernelTable kernels;
+		kernels.variantName = "avx2";
+		kernels.mixAccumulate = mixAccumulateAVX2;
+		kernels.mixWrite = mixWriteAVX2;
+		kernels.applyGain = applyGainAVX2;
+		kernels.tableRead = tableReadAVX2;
+		kernels.linearRamp = linearRampAVX2;
+		kernels.int16ToFloat = int16ToFloatAVX2;
+		kernels.doubleToFloat = doubleToFloatAVX2;
+		kernels.rotatorBank = rotatorBankAVX2;
+		kernels.grainAccumulate = grainAccumulateAVX2;
+		return kernels;
+	}
+
+	static SynthKernelTable makeAVX512Kernels()
+	{
+		SynthKernelTable kernels;
+		kernels.variantName = "avx512";
+		kernels.mixAccumulate = mixAccumulateAVX512;
+		kernels.mixWrite = mixWriteAVX512;
+		kernels.applyGain = applyGainAVX512;
+		kernels.tableRead = tableReadAVX512;
+		kernels.linearRamp = linearRampAVX512;
+		kernels.int16ToFloat = int16ToFloatAVX512;
+		kernels.doubleToFloat = doubleToFloatAVX512;
+		kernels.rotatorBank = rotatorBankAVX512;
+		kernels.grainAccumulate = grainAccumulateAVX512;
+		return kernels;
+	}
+
+	const CPUFeatures& getCPUFeatures()
+	{
+		static const CPUFeatures features = detectCPUFeatures();
+		return features;
+	}
+
+	const SynthKernelTable* getSSE41Kernels()
+	{
+		static const SynthKernelTable kernels = makeSSE41Kernels();
+		return &kernels;
+	}
+
+	const SynthKernelTable* getAVX2Kernels()
+	{
+		static const SynthKernelTable kernels = makeAVX2Kernels();
+		return &kernels;
+	}
+
+	const SynthKernelTable* getAVX512Kernels()
+	{
+		static const SynthKernelTable kernels = makeAVX512Kernels();
+		return &kernels;
+	}
+
+#else
+	// --- not x86: scalar only
+	const CPUFeatures& getCPUFeatures()
+	{
+		static const CPUFeatures features;
+		return features;
+	}
+
+	const SynthKernelTable* getSSE41Kernels() { return nullptr; }
+	const SynthKernelTable* getAVX2Kernels() { return nullptr; }
+	const SynthKernelTable* getAVX512Kernels() { return nullptr; }
+#endif
+
+} // namespace
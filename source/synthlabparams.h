@@ -994,5 +994,37 @@ namespace SynthLab
 		double leftDelay_mSec = 2000.0;		///< left delay time
 		double rightDelay_mSec = 2000.0;	///< right delay time
 	};
+
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Constants for the convolver used as the master FX
+	*/
+	const uint32_t CONVOLVER_AUDIO_INPUTS = 2;
+	const uint32_t CONVOLVER_AUDIO_OUTPUTS = 2;
+	const double CONVOLVER_LEVEL_OFF_DB = -96.0;	///< levels at or below this are off
+	//@}
+
+	/**
+	\struct ConvolverParameters
+	\ingroup SynthParameters
+	\brief
+	Custom parameter structure for the Convolver object.
+	- the impulse response is not a parameter; it is loaded with Convolver::loadImpulseResponse( )
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct ConvolverParameters
+	{
+		ConvolverParameters() {}
+
+		// --- individual parameters
+		double wetLevel_dB = 0.0;			///< convolved output level in dB
+		double dryLevel_dB = CONVOLVER_LEVEL_OFF_DB;	///< dry output level in dB; off by default for cabinets
+	};
 } // namespace
 
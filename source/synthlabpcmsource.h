@@ -117,6 +117,47 @@ namespace SynthLab
 			}
 		}
 
+		/**
+		\brief
+		Memory accounting: bytes of the parsed sample buffers; a sample that is mapped
+		across multiple MIDI notes is only counted once (same rule as deleteSamples( ))
+
+		\return sample bytes
+		*/
+		inline virtual uint64_t getSampleMemoryBytes() override
+		{
+			uint64_t bytes = 0;
+			PCMSample* pCountedSample = nullptr;
+			for (uint32_t i = 0; i < NUM_MIDI_NOTES; i++)
+			{
+				if (sampleSet[i] && sampleSet[i] != pCountedSample)
+				{
+					pCountedSample = sampleSet[i];
+					bytes += sizeof(PCMSample) + (uint64_t)pCountedSample->getSampleCount() * sizeof(float);
+				}
+			}
+			return bytes;
+		}
+
+		/**
+		\brief
+		Residency: the parsed sample buffers, once each (same rule as getSampleMemoryBytes( ))
+
+		\param regions list to append the buffers to
+		*/
+		inline virtual void getMemoryRegions(MemoryRegionList& regions) override
+		{
+			PCMSample* pListedSample = nullptr;
+			for (uint32_t i = 0; i < NUM_MIDI_NOTES; i++)
+			{
+				if (sampleSet[i] && sampleSet[i] != pListedSample)
+				{
+					pListedSample = sampleSet[i];
+					regions.push_back(MemoryRegion(pListedSample->getSampleBuffer(), (uint64_t)pListedSample->getSampleCount() * sizeof(float)));
+				}
+			}
+		}
+
 		/**
 		\brief
 		query for valid sample count (not used in SynthLab but avialable)
@@ -178,6 +219,25 @@ namespace SynthLab
 			return inc;
 		}
 
+		/**
+		\brief
+		Direct access to the selected sample's buffer; see IPCMSampleSource::getSelectedSampleData( )
+
+		\param sampleData receives the buffer, frame count and channel count
+
+		\return true if a sample is selected
+		*/
+		inline virtual bool getSelectedSampleData(PCMSampleData& sampleData) override
+		{
+			if (!selectedSample || !selectedSample->getSampleBuffer() || selectedSample->getNumChannels() == 0 || selectedSample->getNumChannels() > 2)
+				return false;
+
+			sampleData.samples = selectedSample->getSampleBuffer();
+			sampleData.channels = selectedSample->getNumChannels();
+			sampleData.frames = selectedSample->getSampleCount() / sampleData.channels;
+			return true;
+		}
+
 		/**
 		\brief
 		Read and interpolate the table; uses linear interpolation but could be changed to
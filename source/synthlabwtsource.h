@@ -126,6 +126,45 @@ namespace SynthLab
 			selectedTable = wavetableSet[MIDI_NOTE_A4]; 
 		}
 
+		/**
+		\brief
+		Memory accounting: bytes of the compiled-in tables this set points to; neighboring
+		MIDI notes share tables so each table is only counted once
+
+		\return table bytes
+		*/
+		virtual uint64_t getTableMemoryBytes() override
+		{
+			uint64_t bytes = 0;
+			for (uint32_t i = 0; i < NUM_MIDI_NOTES; i++)
+			{
+				if (i > 0 && wavetableSet[i].uTable == wavetableSet[i - 1].uTable 
+						  && wavetableSet[i].dTable == wavetableSet[i - 1].dTable)
+					continue;
+				bytes += (uint64_t)wavetableSet[i].tableLength * sizeof(uint64_t);
+			}
+			return bytes;
+		}
+
+		/**
+		\brief
+		Residency: the compiled-in tables this set points to, once each (same rule as
+		getTableMemoryBytes( ))
+
+		\param regions list to append the tables to
+		*/
+		virtual void getMemoryRegions(MemoryRegionList& regions) override
+		{
+			for (uint32_t i = 0; i < NUM_MIDI_NOTES; i++)
+			{
+				if (i > 0 && wavetableSet[i].uTable == wavetableSet[i - 1].uTable 
+						  && wavetableSet[i].dTable == wavetableSet[i - 1].dTable)
+					continue;
+				const void* table = wavetableSet[i].uTable ? (const void*)wavetableSet[i].uTable : (const void*)wavetableSet[i].dTable;
+				regions.push_back(MemoryRegion(table, (uint64_t)wavetableSet[i].tableLength * sizeof(uint64_t)));
+			}
+		}
+
 	protected:
 		// --- 128 wavetables
 		StaticWavetable wavetableSet[NUM_MIDI_NOTES];///<--- prefab table valid for all MIDI notes
@@ -200,6 +239,17 @@ namespace SynthLab
 		*/
 		virtual uint32_t getWaveTableLength() override { return drumTable.tableLength; }
 
+		/**
+		\return memory accounting: bytes of the compiled-in drum table
+		*/
+		virtual uint64_t getTableMemoryBytes() override { return (uint64_t)drumTable.tableLength * sizeof(double); }
+
+		/**
+		\brief
+		Residency: the compiled-in drum table
+		*/
+		virtual void getMemoryRegions(MemoryRegionList& regions) override { regions.push_back(MemoryRegion(drumTable.dTable, getTableMemoryBytes())); }
+
 		/**
 		\brief
 		Adds a new wavetable to the array of 128 tables, one for each MIDI note
@@ -0,0 +1,230 @@
+#include "synthpatch.h"
+
+#include <string.h>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthpatch.cpp
+\author Will Pirkle
+\brief  Compact, versioned binary patch format
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Construction: writes the header
+
+	\param variantID identifies the synth that wrote the patch; readers reject other variants
+	*/
+	PatchWriter::PatchWriter(uint32_t variantID)
+	{
+		writeUINT32(getPatchMagic());
+		writeUINT32(kPatchFormatVersion);
+		writeUINT32(variantID);
+	}
+
+	/**
+	\brief
+	Starts a chunk; the size is a placeholder until endChunk( )
+
+	\param tag the chunk tag
+	\param version the chunk version
+	*/
+	void PatchWriter::beginChunk(uint32_t tag, uint32_t version)
+	{
+		chunkStart = data.size();
+		chunkVersion = version;
+		writeUINT32(tag);
+		writeUINT32(version);
+		writeUINT32(0);
+	}
+
+	/**
+	\brief
+	Ends the open chunk and fills in its payload size
+	*/
+	void PatchWriter::endChunk()
+	{
+		uint32_t size = (uint32_t)(data.size() - chunkStart - kPatchChunkHeaderBytes);
+		for (uint32_t i = 0; i < 4; i++)
+			data[chunkStart + 8 + i] = (uint8_t)(size >> (8 * i));
+	}
+
+	bool PatchWriter::value(double& v)
+	{
+		uint64_t bits = 0;
+		memcpy(&bits, &v, sizeof(bits));
+		writeUINT64(bits);
+		return true;
+	}
+
+	bool PatchWriter::value(uint32_t& v)
+	{
+		writeUINT32(v);
+		return true;
+	}
+
+	bool PatchWriter::value(int32_t& v)
+	{
+		writeUINT32((uint32_t)v);
+		return true;
+	}
+
+	bool PatchWriter::value(bool& v)
+	{
+		data.push_back(v ? 1 : 0);
+		return true;
+	}
+
+	void PatchWriter::writeUINT32(uint32_t v)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+			data.push_back((uint8_t)(v >> (8 * i)));
+	}
+
+	void PatchWriter::writeUINT64(uint64_t v)
+	{
+		for (uint32_t i = 0; i < 8; i++)
+			data.push_back((uint8_t)(v >> (8 * i)));
+	}
+
+	// --- PatchChunkReader --------------------------------------------------------------------- //
+	bool PatchChunkReader::value(double& v)
+	{
+		uint64_t bits = 0;
+		if (!readUINT64(bits))
+			return false;
+		memcpy(&v, &bits, sizeof(bits));
+		return true;
+	}
+
+	bool PatchChunkReader::value(uint32_t& v)
+	{
+		return readUINT32(v);
+	}
+
+	bool PatchChunkReader::value(int32_t& v)
+	{
+		uint32_t bits = 0;
+		if (!readUINT32(bits))
+			return false;
+		v = (int32_t)bits;
+		return true;
+	}
+
+	bool PatchChunkReader::value(bool& v)
+	{
+		if (position + 1 > size)
+			return false;
+		v = data[position++] != 0;
+		return true;
+	}
+
+	bool PatchChunkReader::readUINT32(uint32_t& v)
+	{
+		if (position + 4 > size)
+		{
+			position = size;
+			return false;
+		}
+		v = 0;
+		for (uint32_t i = 0; i < 4; i++)
+			v |= (uint32_t)data[position++] << (8 * i);
+		return true;
+	}
+
+	bool PatchChunkReader::readUINT64(uint64_t& v)
+	{
+		if (position + 8 > size)
+		{
+			position = size;
+			return false;
+		}
+		v = 0;
+		for (uint32_t i = 0; i < 8; i++)
+			v |= (uint64_t)data[position++] << (8 * i);
+		return true;
+	}
+
+	// --- PatchReader -------------------------------------------------------------------------- //
+	/**
+	\brief
+	Checks the header and indexes the chunks
+	- a truncated last chunk is dropped; everything before it is still readable
+	- if a tag appears more than once, the first one is used
+
+	\param _data the patch; must remain valid while reading
+	\param _size size of the patch in bytes
+	\param variantID the reading synth's variant
+
+	\return true if the patch can be read
+	*/
+	bool PatchReader::open(const uint8_t* _data, uint32_t _size, uint32_t variantID)
+	{
+		data = nullptr;
+		formatVersion = 0;
+		chunks.clear();
+
+		if (!_data || _size < kPatchHeaderBytes)
+			return false;
+
+		PatchChunkReader header(_data, kPatchHeaderBytes, 0);
+		uint32_t magic = 0;
+		uint32_t variant = 0;
+		header.value(magic);
+		header.value(formatVersion);
+		header.value(variant);
+
+		if (magic != getPatchMagic() || formatVersion == 0 || formatVersion > kPatchFormatVersion || variant != variantID)
+			return false;
+
+		uint32_t offset = kPatchHeaderBytes;
+		while (_size - offset >= kPatchChunkHeaderBytes)
+		{
+			PatchChunkReader chunkHeader(_data + offset, kPatchChunkHeaderBytes, 0);
+			ChunkInfo info;
+			chunkHeader.value(info.tag);
+			chunkHeader.value(info.version);
+			chunkHeader.value(info.size);
+			offset += kPatchChunkHeaderBytes;
+
+			if (info.size > _size - offset)
+				break;
+
+			info.offset = offset;
+			chunks.push_back(info);
+			offset += info.size;
+		}
+
+		data = _data;
+		return true;
+	}
+
+	/**
+	\brief
+	Finds a chunk
+
+	\param tag the chunk tag
+	\param chunk set up to read the chunk's payload if found
+
+	\return true if found
+	*/
+	bool PatchReader::findChunk(uint32_t tag, PatchChunkReader& chunk)
+	{
+		for (const ChunkInfo& info : chunks)
+		{
+			if (info.tag == tag)
+			{
+				chunk = PatchChunkReader(data + info.offset, info.size, info.version);
+				return true;
+			}
+		}
+		return false;
+	}
+
+} // namespace
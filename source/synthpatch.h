@@ -0,0 +1,691 @@
+#ifndef __synthPatch_h__
+#define __synthPatch_h__
+
+// --- includes
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include "synthbase.h"
+#include "sequencer.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthpatch.h
+\author Will Pirkle
+\brief  Compact, versioned binary patch format
+- a header (magic, format version, synth variant) followed by tagged chunks, one per
+parameter structure; each chunk has its own version and size so that readers skip
+chunks they do not know
+- all numbers are little-endian; doubles are written as their 64-bit IEEE pattern
+- each parameter structure has one serializePatch( ) function used for both writing and
+reading, so the two can never disagree on the field order
+- fields are only ever appended to a structure's serializePatch( ); a reader that runs out of
+chunk data leaves the remaining fields at their defaults, and trailing data it does not
+know is ignored, so old patches load in new builds and new patches load in old builds
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Builds a chunk tag (or the magic number) from four characters; stored little-endian
+	so the characters appear in order in the file
+	*/
+	inline uint32_t makePatchTag(char a, char b, char c, char d)
+	{
+		return (uint32_t)(uint8_t)a | ((uint32_t)(uint8_t)b << 8) | ((uint32_t)(uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+	}
+
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Patch file header constants; the format version only changes if the header or chunk
+	layout changes, never for new parameters
+	*/
+	const uint32_t kPatchFormatVersion = 1;
+	const uint32_t kPatchChunkVersion = 1;
+	const uint32_t kPatchHeaderBytes = 12;		///< magic, format version, variant
+	const uint32_t kPatchChunkHeaderBytes = 12;	///< tag, chunk version, payload size
+	//@}
+
+	/** the magic number, "SLPT" */
+	inline uint32_t getPatchMagic() { return makePatchTag('S', 'L', 'P', 'T'); }
+
+	/**
+	\class PatchWriter
+	\ingroup SynthObjects
+	\brief
+	Writes a patch: the header, then one chunk per parameter structure
+	- use writePatchChunk( ) to write a structure as a chunk
+	- NOT real-time safe; the data grows as it is written
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class PatchWriter
+	{
+	public:
+		PatchWriter(uint32_t variantID);
+
+		/** used by serializePatch( ) for parts that differ between writing and reading */
+		static bool isReading() { return false; }
+		uint32_t getVersion() { return chunkVersion; }
+
+		/** chunks; the payload size is filled in by endChunk( ) */
+		void beginChunk(uint32_t tag, uint32_t version);
+		void endChunk();
+
+		/** fields; always return true */
+		bool value(double& v);
+		bool value(uint32_t& v);
+		bool value(int32_t& v);
+		bool value(bool& v);
+
+		template <class T, size_t N>
+		bool value(T(&v)[N])
+		{
+			for (size_t i = 0; i < N; i++)
+				value(v[i]);
+			return true;
+		}
+
+		/** the patch */
+		const std::vector<uint8_t>& getData() { return data; }
+
+	protected:
+		void writeUINT32(uint32_t v);
+		void writeUINT64(uint64_t v);
+
+		std::vector<uint8_t> data;
+		size_t chunkStart = 0;		///< offset of the open chunk's header
+		uint32_t chunkVersion = 0;	///< version of the open chunk
+	};
+
+	/**
+	\class PatchChunkReader
+	\ingroup SynthObjects
+	\brief
+	Reads the fields of one chunk, in order
+	- a field past the end of the chunk is left unchanged (its default) and value( ) returns false
+	- real-time safe, but patches are normally read on a background thread
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class PatchChunkReader
+	{
+	public:
+		PatchChunkReader() {}
+		PatchChunkReader(const uint8_t* _data, uint32_t _size, uint32_t _version)
+			: data(_data), size(_size), version(_version) {}
+
+		/** used by serializePatch( ) for parts that differ between writing and reading */
+		static bool isReading() { return true; }
+		uint32_t getVersion() { return version; }
+
+		/** fields; false if the chunk has no more data */
+		bool value(double& v);
+		bool value(uint32_t& v);
+		bool value(int32_t& v);
+		bool value(bool& v);
+
+		template <class T, size_t N>
+		bool value(T(&v)[N])
+		{
+			for (size_t i = 0; i < N; i++)
+			{
+				if (!value(v[i]))
+					return false;
+			}
+			return true;
+		}
+
+		/** true once every byte of the chunk has been read */
+		bool isExhausted() { return position >= size; }
+
+	protected:
+		bool readUINT32(uint32_t& v);
+		bool readUINT64(uint64_t& v);
+
+		const uint8_t* data = nullptr;
+		uint32_t size = 0;
+		uint32_t position = 0;
+		uint32_t version = 0;
+	};
+
+	/**
+	\class PatchReader
+	\ingroup SynthObjects
+	\brief
+	Validates a patch and finds its chunks
+	- open( ) checks the header and indexes the chunks; it does not copy the data, which
+	must stay valid while the reader is in use
+	- use readPatchChunk( ) to read a structure from its chunk
+	- NOT real-time safe (the index allocates)
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class PatchReader
+	{
+	public:
+		PatchReader() {}
+
+		/** false if the data is not a patch, is from a newer format or from another synth variant */
+		bool open(const uint8_t* _data, uint32_t _size, uint32_t variantID);
+
+		/** false if the patch has no chunk with this tag */
+		bool findChunk(uint32_t tag, PatchChunkReader& chunk);
+
+		uint32_t getFormatVersion() { return formatVersion; }
+
+	protected:
+		struct ChunkInfo
+		{
+			uint32_t tag = 0;
+			uint32_t version = 0;
+			uint32_t offset = 0;	///< payload offset
+			uint32_t size = 0;		///< payload size
+		};
+
+		const uint8_t* data = nullptr;
+		uint32_t formatVersion = 0;
+		std::vector<ChunkInfo> chunks;
+	};
+
+	/**
+	\brief
+	Writes a parameter structure as one chunk
+
+	\param writer the patch being written
+	\param tag the chunk tag, see makePatchTag( )
+	\param params the structure; must have a serializePatch( ) overload
+	*/
+	template <class T>
+	void writePatchChunk(PatchWriter& writer, uint32_t tag, T& params)
+	{
+		writer.beginChunk(tag, kPatchChunkVersion);
+		serializePatch(writer, params);
+		writer.endChunk();
+	}
+
+	/**
+	\brief
+	Reads a parameter structure from its chunk; if the chunk is missing the structure is unchanged
+
+	\param reader the open patch
+	\param tag the chunk tag, see makePatchTag( )
+	\param params the structure; must have a serializePatch( ) overload
+
+	\return true if the chunk was found
+	*/
+	template <class T>
+	bool readPatchChunk(PatchReader& reader, uint32_t tag, T& params)
+	{
+		PatchChunkReader chunk;
+		if (!reader.findChunk(tag, chunk))
+			return false;
+
+		serializePatch(chunk, params);
+		return true;
+	}
+
+	/**
+	\brief
+	Writes or reads a chunk, so that one function can list the chunks of a patch for both 
+	PatchWriter and PatchReader
+	*/
+	template <class T>
+	void serializePatchChunk(PatchWriter& writer, uint32_t tag, T& params) { writePatchChunk(writer, tag, params); }
+
+	template <class T>
+	void serializePatchChunk(PatchReader& reader, uint32_t tag, T& params) { readPatchChunk(reader, tag, params); }
+
+	// --- serializePatch( ) for the SDK parameter structures; APPEND new fields only
+	//
+	template <class Archive>
+	void serializePatch(Archive& archive, WTOscParameters& params)
+	{
+		archive.value(params.waveIndex);
+		archive.value(params.octaveDetune);
+		archive.value(params.coarseDetune);
+		archive.value(params.fineDetune);
+		archive.value(params.unisonDetuneCents);
+		archive.value(params.oscSpecificDetune);
+		archive.value(params.outputAmplitude_dB);
+		archive.value(params.oscillatorShape);
+		archive.value(params.hardSyncRatio);
+		archive.value(params.panValue);
+		archive.value(params.phaseModIndex);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+		archive.value(params.forceLoop);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, WSOscParameters& params)
+	{
+		archive.value(params.detuneSemis);
+		archive.value(params.detuneCents);
+		archive.value(params.oscillatorShape);
+		archive.value(params.hardSyncRatio);
+		archive.value(params.morphIntensity);
+		archive.value(params.panValue);
+		archive.value(params.doubleOscillator);
+		archive.value(params.soloWaveWSIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, VAOscParameters& params)
+	{
+		archive.value(params.waveIndex);
+		archive.value(params.octaveDetune);
+		archive.value(params.coarseDetune);
+		archive.value(params.fineDetune);
+		archive.value(params.unisonDetune);
+		archive.value(params.pulseWidth_Pct);
+		archive.value(params.outputAmplitude_dB);
+		archive.value(params.oscillatorShape);
+		archive.value(params.hardSyncRatio);
+		archive.value(params.panValue);
+		archive.value(params.phaseModIndex);
+		archive.value(params.waveformMix);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, PCMOscParameters& params)
+	{
+		archive.value(params.waveIndex);
+		archive.value(params.octaveDetune);
+		archive.value(params.coarseDetune);
+		archive.value(params.fineDetune);
+		archive.value(params.unisonDetune);
+		archive.value(params.outputAmplitude_dB);
+		archive.value(params.oscillatorShape);
+		archive.value(params.hardSyncRatio);
+		archive.value(params.phaseModIndex);
+		archive.value(params.freqModIndex);
+		archive.value(params.panValue);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, KSOscParameters& params)
+	{
+		archive.value(params.algorithmIndex);
+		archive.value(params.attackTime_mSec);
+		archive.value(params.holdTime_mSec);
+		archive.value(params.releaseTime_mSec);
+		archive.value(params.octaveDetune);
+		archive.value(params.coarseDetune);
+		archive.value(params.fineDetune);
+		archive.value(params.unisonDetune);
+		archive.value(params.outputAmplitude_dB);
+		archive.value(params.oscillatorShape);
+		archive.value(params.hardSyncRatio);
+		archive.value(params.phaseModIndex);
+		archive.value(params.freqModIndex);
+		archive.value(params.panValue);
+		archive.value(params.decay);
+		archive.value(params.pluckPosition);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, EGParameters& params)
+	{
+		archive.value(params.egContourIndex);
+		archive.value(params.resetToZero);
+		archive.value(params.legatoMode);
+		archive.value(params.velocityToAttackScaling);
+		archive.value(params.noteNumberToDecayScaling);
+		archive.value(params.attackTime_mSec);
+		archive.value(params.decayTime_mSec);
+		archive.value(params.slopeTime_mSec);
+		archive.value(params.releaseTime_mSec);
+		archive.value(params.startLevel);
+		archive.value(params.endLevel);
+		archive.value(params.decayLevel);
+		archive.value(params.sustainLevel);
+		archive.value(params.curvature);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, FMOperatorParameters& params)
+	{
+		archive.value(params.waveIndex);
+		archive.value(params.octaveDetune);
+		archive.value(params.coarseDetune);
+		archive.value(params.fineDetune);
+		archive.value(params.unisonDetune);
+		archive.value(params.outputAmplitude_dB);
+		archive.value(params.oscillatorShape);
+		archive.value(params.panValue);
+		archive.value(params.phaseModIndex);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+		archive.value(params.ratio);
+
+		// --- embedded EG last so that it can grow with EGParameters
+		serializePatch(archive, params.dxEGParameters);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, FilterParameters& params)
+	{
+		archive.value(params.filterIndex);
+		archive.value(params.fc);
+		archive.value(params.Q);
+		archive.value(params.filterOutputGain_dB);
+		archive.value(params.filterDrive);
+		archive.value(params.bassGainComp);
+		archive.value(params.analogFGN);
+		archive.value(params.enableKeyTrack);
+		archive.value(params.keyTrackSemis);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, DCAParameters& params)
+	{
+		archive.value(params.gainValue_dB);
+		archive.value(params.panValue);
+		archive.value(params.ampEGIntensity);
+		archive.value(params.ampModIntensity);
+		archive.value(params.panModIntensity);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, LFOParameters& params)
+	{
+		archive.value(params.waveformIndex);
+		archive.value(params.modeIndex);
+		archive.value(params.frequency_Hz);
+		archive.value(params.outputAmplitude);
+		archive.value(params.quantize);
+		archive.value(params.modKnobValue);
+		archive.value(params.moduleIndex);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, AudioDelayParameters& params)
+	{
+		archive.value(params.wetLevel_dB);
+		archive.value(params.dryLevel_dB);
+		archive.value(params.feedback_Pct);
+		archive.value(params.leftDelay_mSec);
+		archive.value(params.rightDelay_mSec);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, ConvolverParameters& params)
+	{
+		archive.value(params.wetLevel_dB);
+		archive.value(params.dryLevel_dB);
+	}
+
+	template <class Archive>
+	void serializePatch(Archive& archive, WaveSequencerParameters& params)
+	{
+		archive.value(params.haltSequencer);
+		archive.value(params.BPM);
+		archive.value(params.timeStretch);
+		archive.value(params.interpolateStepSeqMod);
+		archive.value(params.randomizeStepOrder);
+		archive.value(params.randomizePitchOrder);
+		archive.value(params.randomizeWaveOrder);
+		archive.value(params.randomizeSSModOrder);
+		archive.value(params.timingLoopStart);
+		archive.value(params.timingLoopEnd);
+		archive.value(params.timingLoopDirIndex);
+		archive.value(params.stepDurationMilliSec);
+		archive.value(params.stepDurationNoteIndex);
+		archive.value(params.stepType);
+		archive.value(params.xfadeDurationMilliSec);
+		archive.value(params.xfadeDurationNoteIndex);
+		archive.value(params.modLoopStart);
+		archive.value(params.modLoopEnd);
+		archive.value(params.modLoopDirIndex);
+		archive.value(params.waveLaneAmp_dB);
+		archive.value(params.waveLaneValue);
+		archive.value(params.waveLaneProbability_pct);
+		archive.value(params.pitchLaneValue);
+		archive.value(params.pitchLaneProbability_pct);
+		archive.value(params.stepSeqValue);
+		archive.value(params.stepSeqProbability_pct);
+	}
+
+	/**
+	\brief
+	Mod matrix routing; written sparsely because the channel count depends on the engine
+	configuration and most of the matrix is empty
+	- source count, then each source intensity
+	- destination count, then for each destination its controls and a list of
+	(channel, enable, intensity, hardwire, hardwire intensity) for the channels in use
+	- sources, destinations and channels beyond this build's sizes are read and dropped
+	*/
+	template <class Archive>
+	void serializePatch(Archive& archive, ModMatrixParameters& params)
+	{
+		uint32_t sourceCount = kNumberModSources;
+		if (!archive.value(sourceCount))
+			return;
+
+		for (uint32_t i = 0; i < sourceCount; i++)
+		{
+			double intensity = i < kNumberModSources ? params.modSourceRows->at(i).intensity : 1.0;
+			if (!archive.value(intensity))
+				return;
+			if (i < kNumberModSources)
+				params.modSourceRows->at(i).intensity = intensity;
+		}
+
+		uint32_t destinationCount = kNumberModDestinations;
+		if (!archive.value(destinationCount))
+			return;
+
+		ModDestination unusedDestination;
+		for (uint32_t i = 0; i < destinationCount; i++)
+		{
+			ModDestination& destination = i < kNumberModDestinations ? params.modDestinationColumns->at(i) : unusedDestination;
+			archive.value(destination.intensity);
+			archive.value(destination.defautValue);
+			archive.value(destination.enableChannelIntensity);
+			archive.value(destination.priorityModulation);
+
+			// --- channels in use
+			uint32_t channelCount = 0;
+			if (!archive.isReading())
+			{
+				for (uint32_t channel = 0; channel < MAX_MODULATION_CHANNELS; channel++)
+				{
+					if (destination.channelEnable[channel] || destination.channelHardwire[channel] ||
+						destination.channelIntensity[channel] != 0.0 || destination.hardwireIntensity[channel] != 0.0)
+						channelCount++;
+				}
+			}
+			if (!archive.value(channelCount))
+				return;
+
+			uint32_t channel = 0;
+			for (uint32_t j = 0; j < channelCount; j++)
+			{
+				if (!archive.isReading())
+				{
+					while (!(destination.channelEnable[channel] || destination.channelHardwire[channel] ||
+						destination.channelIntensity[channel] != 0.0 || destination.hardwireIntensity[channel] != 0.0))
+						channel++;
+				}
+				if (!archive.value(channel))
+					return;
+
+				uint32_t enable = 0;
+				double intensity = 0.0;
+				bool hardwire = false;
+				double hardwireIntensity = 0.0;
+				if (channel < MAX_MODULATION_CHANNELS)
+				{
+					enable = destination.channelEnable[channel];
+					intensity = destination.channelIntensity[channel];
+					hardwire = destination.channelHardwire[channel];
+					hardwireIntensity = destination.hardwireIntensity[channel];
+				}
+				archive.value(enable);
+				archive.value(intensity);
+				archive.value(hardwire);
+				archive.value(hardwireIntensity);
+				if (channel < MAX_MODULATION_CHANNELS)
+				{
+					destination.channelEnable[channel] = enable;
+					destination.channelIntensity[channel] = intensity;
+					destination.channelHardwire[channel] = hardwire;
+					destination.hardwireIntensity[channel] = hardwireIntensity;
+				}
+				channel++;
+			}
+		}
+	}
+
+	// --- validatePatch( ) for the SDK parameter structures: the chunk sizes of a patch are checked
+	//     when it is read, the values in them are not, and the index fields are used as array
+	//     indexes on the audio thread; run on the loader thread after the chunks are read
+	//
+	/** bounds an index field read from a patch to [0, count - 1] */
+	inline void boundPatchIndex(uint32_t& index, uint32_t count)
+	{
+		if (index >= count)
+			index = count - 1;
+	}
+
+	/** bounds a signed index field read from a patch to [first, count - 1] */
+	inline void boundPatchIndex(int32_t& index, int32_t first, int32_t count)
+	{
+		if (index < first)
+			index = first;
+		else if (index >= count)
+			index = count - 1;
+	}
+
+	/** bounds a value that is turned into an index to [0, maximum]; NaN goes to 0 */
+	inline void boundPatchIndex(double& index, double maximum)
+	{
+		if (!(index >= 0.0))
+			index = 0.0;
+		else if (index > maximum)
+			index = maximum;
+	}
+
+	inline void validatePatch(WTOscParameters& params)
+	{
+		boundPatchIndex(params.waveIndex, MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(WSOscParameters& params)
+	{
+		// --- -1 = no solo; otherwise an index into the waves of all cores
+		boundPatchIndex(params.soloWaveWSIndex, -1, (int32_t)(NUM_MODULE_CORES * MODULE_STRINGS));
+	}
+
+	inline void validatePatch(VAOscParameters& params)
+	{
+		boundPatchIndex(params.waveIndex, MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(PCMOscParameters& params)
+	{
+		boundPatchIndex(params.waveIndex, MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(KSOscParameters& params)
+	{
+		boundPatchIndex(params.algorithmIndex, MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(EGParameters& params)
+	{
+		boundPatchIndex(params.egContourIndex, 0, (int32_t)MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(FMOperatorParameters& params)
+	{
+		boundPatchIndex(params.waveIndex, MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+		validatePatch(params.dxEGParameters);
+	}
+
+	inline void validatePatch(FilterParameters& params)
+	{
+		boundPatchIndex(params.filterIndex, 0, (int32_t)MODULE_STRINGS);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(DCAParameters& params)
+	{
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(LFOParameters& params)
+	{
+		boundPatchIndex(params.waveformIndex, 0, (int32_t)MODULE_STRINGS);
+		boundPatchIndex(params.modeIndex, 0, enumToInt(LFOMode::kFreeRun) + 1);
+		boundPatchIndex(params.moduleIndex, NUM_MODULE_CORES);
+	}
+
+	inline void validatePatch(WaveSequencerParameters& params)
+	{
+		// --- loop points are 1-based steps
+		const uint32_t loopDirections = enumToInt(LoopDirection::kForwardBackward) + 1;
+		params.timingLoopStart = std::max(params.timingLoopStart, 1u);
+		params.timingLoopEnd = std::max(params.timingLoopEnd, 1u);
+		boundPatchIndex(params.timingLoopStart, MAX_SEQ_STEPS + 1);
+		boundPatchIndex(params.timingLoopEnd, MAX_SEQ_STEPS + 1);
+		boundPatchIndex(params.timingLoopDirIndex, loopDirections);
+
+		for (uint32_t i = 0; i < MAX_SEQ_STEPS; i++)
+		{
+			boundPatchIndex(params.stepDurationNoteIndex[i], enumToInt(NoteDuration::kNumNoteDurations));
+			boundPatchIndex(params.xfadeDurationNoteIndex[i], enumToInt(NoteDuration::kNumNoteDurations));
+			boundPatchIndex(params.stepType[i], enumToInt(StepMode::kGate) + 1);
+			boundPatchIndex(params.waveLaneValue[i], (double)(NUM_MODULE_CORES * MODULE_STRINGS - 1));
+		}
+
+		for (uint32_t i = 0; i < NUM_MOD_LANES; i++)
+		{
+			params.modLoopStart[i] = std::max(params.modLoopStart[i], 1u);
+			params.modLoopEnd[i] = std::max(params.modLoopEnd[i], 1u);
+			boundPatchIndex(params.modLoopStart[i], MAX_SEQ_STEPS + 1);
+			boundPatchIndex(params.modLoopEnd[i], MAX_SEQ_STEPS + 1);
+			boundPatchIndex(params.modLoopDirIndex[i], loopDirections);
+		}
+	}
+
+} // namespace
+
+#endif /* defined(__synthPatch_h__) */
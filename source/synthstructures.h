@@ -198,6 +198,32 @@ namespace SynthLab
 		uint32_t    midiSampleOffset = 0;		///< sample offset of midi event within audio buffer
 	};
 
+	/**
+	\struct ParameterEvent
+	\ingroup SynthStructures
+	\brief
+	Information about a host parameter automation event; the parameter is identified by
+	an engine-specific ID (see SynthEngine::applyParameterEvent( ))
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included in Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 05 / 02
+	*/
+	struct ParameterEvent
+	{
+		ParameterEvent() {}
+
+		ParameterEvent(uint32_t _parameterID, double _value, uint32_t _sampleOffset = 0)
+			: parameterID(_parameterID)
+			, value(_value)
+			, sampleOffset(_sampleOffset) {}
+
+		uint32_t parameterID = 0;		///< engine-specific parameter identifier
+		double value = 0.0;				///< new value, in the parameter's own units
+		uint32_t sampleOffset = 0;		///< sample offset of the change within audio buffer
+	};
+
 	/**
 	\struct MIDINoteEvent
 	\ingroup SynthStructures
@@ -0,0 +1,167 @@
+#include "synthtelemetry.h"
+
+#include <algorithm>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthtelemetry.cpp
+\author Will Pirkle
+\brief  Lock-free telemetry from the audio thread to the GUI
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Constructs the bus, disabled; all storage is part of the object
+	*/
+	SynthTelemetry::SynthTelemetry()
+	{
+		enabled.store(false);
+		scopeDecimation.store(4);
+	}
+
+	/**
+	\brief
+	Restarts the telemetry clock and the partial scope block; sets the status interval
+	- audio thread (or while the engine is not rendering)
+
+	\param _sampleRate the engine sample rate
+	*/
+	void SynthTelemetry::reset(double _sampleRate)
+	{
+		sampleRate = _sampleRate;
+		statusInterval = (uint32_t)std::max(1.0, sampleRate / TELEMETRY_STATUS_RATE_HZ);
+
+		sampleTime = 0;
+		scopeSamples = 0;
+		scopeCountdown = 0;
+		statusSamples = 0;
+		renderSeconds = 0.0;
+		audioSeconds = 0.0;
+		peakLoad = 0.0;
+	}
+
+	/**
+	\brief
+	Decimates a block of engine output into the scope block and pushes each block that fills
+	- audio thread; call before addRenderLoad( ) which advances the telemetry clock
+
+	\param left left output channel
+	\param right right output channel; may be the left channel for mono
+	\param samples samples in the block
+	*/
+	void SynthTelemetry::writeScope(const float* left, const float* right, uint32_t samples)
+	{
+		uint32_t decimation = scopeDecimation.load(std::memory_order_relaxed);
+		for (uint32_t i = 0; i < samples; i++)
+		{
+			if (scopeCountdown > 0)
+			{
+				scopeCountdown--;
+				continue;
+			}
+			scopeCountdown = decimation - 1;
+
+			// --- start of a new block
+			if (scopeSamples == 0)
+			{
+				scopeBlock.sampleTime = sampleTime + i;
+				scopeBlock.decimation = decimation;
+			}
+
+			scopeBlock.left[scopeSamples] = left[i];
+			scopeBlock.right[scopeSamples] = right[i];
+			if (++scopeSamples == TELEMETRY_SCOPE_SAMPLES)
+			{
+				scopeChannel.push(scopeBlock);
+				scopeSamples = 0;
+			}
+		}
+	}
+
+	/**
+	\brief
+	Accumulates the render load of one render( ) call and advances the telemetry clock
+	- audio thread; call once per render( )
+
+	\param blockRenderSeconds time spent rendering the block
+	\param samples samples in the block
+	*/
+	void SynthTelemetry::addRenderLoad(double blockRenderSeconds, uint32_t samples)
+	{
+		double blockAudioSeconds = (double)samples / sampleRate;
+		if (blockAudioSeconds > 0.0)
+			peakLoad = std::max(peakLoad, blockRenderSeconds / blockAudioSeconds);
+
+		renderSeconds += blockRenderSeconds;
+		audioSeconds += blockAudioSeconds;
+		sampleTime += samples;
+		statusSamples += samples;
+	}
+
+	/**
+	\brief
+	Checks (and restarts) the status interval
+	- audio thread
+
+	\return true if the status items are due; write them, then writeLoad( )
+	*/
+	bool SynthTelemetry::isStatusDue()
+	{
+		if (statusSamples < statusInterval)
+			return false;
+
+		statusSamples = 0;
+		return true;
+	}
+
+	/**
+	\brief
+	Pushes a voice activity item, stamped with the telemetry clock
+	- audio thread
+
+	\param voices the voice activity and modulator values
+	*/
+	void SynthTelemetry::writeVoices(VoiceTelemetry& voices)
+	{
+		voices.sampleTime = sampleTime;
+		voiceChannel.push(voices);
+	}
+
+	/**
+	\brief
+	Pushes a sequencer LED item, stamped with the telemetry clock
+	- audio thread
+
+	\param sequencer the lane LEDs
+	*/
+	void SynthTelemetry::writeSequencer(SequencerTelemetry& sequencer)
+	{
+		sequencer.sampleTime = sampleTime;
+		sequencerChannel.push(sequencer);
+	}
+
+	/**
+	\brief
+	Pushes the load of the status interval and starts a new one
+	- audio thread
+	*/
+	void SynthTelemetry::writeLoad()
+	{
+		LoadTelemetry load;
+		load.sampleTime = sampleTime;
+		load.averageLoad = audioSeconds > 0.0 ? (float)(renderSeconds / audioSeconds) : 0.f;
+		load.peakLoad = (float)peakLoad;
+		loadChannel.push(load);
+
+		renderSeconds = 0.0;
+		audioSeconds = 0.0;
+		peakLoad = 0.0;
+	}
+
+} // namespace
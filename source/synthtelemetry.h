@@ -0,0 +1,281 @@
+#ifndef __synthTelemetry_h__
+#define __synthTelemetry_h__
+
+// --- includes
+#include "synthconstants.h"
+
+#include <stdint.h>
+#include <atomic>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthtelemetry.h
+\author Will Pirkle
+\brief  Lock-free telemetry from the audio thread to the GUI: scope blocks, voice activity,
+EG/LFO values, sequencer step LEDs and CPU load
+- the audio thread never allocates, locks or waits; when the GUI falls behind, the oldest
+items are overwritten
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Telemetry sizes and rates
+	*/
+	const uint32_t TELEMETRY_SCOPE_SAMPLES = 128;	///< samples per channel in a scope block
+	const uint32_t TELEMETRY_SCOPE_BLOCKS = 16;		///< scope channel depth (power of 2)
+	const uint32_t TELEMETRY_STATUS_ITEMS = 32;		///< status channel depth (power of 2)
+	const double TELEMETRY_STATUS_RATE_HZ = 60.0;	///< status updates per second, about one per GUI frame
+	//@}
+
+	/**
+	\struct ScopeTelemetry
+	\ingroup SynthStructures
+	\brief
+	A block of decimated engine output for an oscilloscope display
+	*/
+	struct ScopeTelemetry
+	{
+		uint64_t sampleTime = 0;	///< engine sample count at the first sample
+		uint32_t decimation = 1;	///< engine samples per scope sample
+		float left[TELEMETRY_SCOPE_SAMPLES] = { 0 };	///< left output
+		float right[TELEMETRY_SCOPE_SAMPLES] = { 0 };	///< right output
+	};
+
+	/**
+	\struct VoiceTelemetry
+	\ingroup SynthStructures
+	\brief
+	Voice activity, plus the EG and LFO outputs of the most recently started voice
+	*/
+	struct VoiceTelemetry
+	{
+		uint64_t sampleTime = 0;		///< engine sample count
+		uint64_t activeVoices = 0;		///< one bit per voice (first 64 voices)
+		uint32_t activeVoiceCount = 0;	///< number of active voices
+		int32_t newestVoice = -1;		///< voice the modulator values come from, -1 = none
+		float egValue[3] = { 0 };		///< amp, filter and aux EG outputs
+		float lfoValue[NUM_LFO] = { 0 };///< LFO outputs
+	};
+
+	/**
+	\struct SequencerTelemetry
+	\ingroup SynthStructures
+	\brief
+	Wave sequencer step LEDs, one bit per step for each lane
+	*/
+	struct SequencerTelemetry
+	{
+		uint64_t sampleTime = 0;		///< engine sample count
+		uint32_t timingLaneLEDs = 0;	///< timing lane
+		uint32_t waveLaneLEDs = 0;		///< wave lane
+		uint32_t pitchLaneLEDs = 0;		///< pitch lane
+		uint32_t stepSeqLaneLEDs = 0;	///< step sequencer lane
+	};
+
+	/**
+	\struct LoadTelemetry
+	\ingroup SynthStructures
+	\brief
+	Render CPU load over one status interval: render time / audio time
+	*/
+	struct LoadTelemetry
+	{
+		uint64_t sampleTime = 0;	///< engine sample count
+		float averageLoad = 0.f;	///< over the interval, 1.0 = all of the available time
+		float peakLoad = 0.f;		///< worst block in the interval
+	};
+
+	/**
+	\class TelemetryChannel
+	\ingroup SynthObjects
+	\brief
+	Fixed-size single-producer, single-consumer channel with drop-oldest semantics
+	- push( ) is wait-free and never fails: when the channel is full it overwrites the oldest item
+	- each slot carries a sequence number (a per-slot seqlock) so that the reader can detect an
+	item that was overwritten while it was copying it, and skips it
+	- the storage is part of the object; nothing is allocated
+	- T must be trivially copyable
+
+	\author Will Pirkle http://www.willpirkle.com
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	template <typename T, uint32_t SIZE>
+	class TelemetryChannel
+	{
+		static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "TelemetryChannel size must be a power of 2");
+
+	public:
+		TelemetryChannel()
+		{
+			writeIndex.store(0);
+			droppedItems.store(0);
+			for (uint32_t i = 0; i < SIZE; i++)
+				slots[i].sequence.store(0);
+		}
+
+		/**
+		\brief
+		Writes an item, overwriting the oldest one if the reader has fallen behind
+		- writer thread only
+		*/
+		void push(const T& item)
+		{
+			uint64_t write = writeIndex.load(std::memory_order_relaxed);
+			Slot& slot = slots[write & (SIZE - 1)];
+
+			// --- mark busy, write, then publish with the item's sequence number
+			slot.sequence.store(0, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			slot.item = item;
+			slot.sequence.store(write + 1, std::memory_order_release);
+			writeIndex.store(write + 1, std::memory_order_release);
+		}
+
+		/**
+		\brief
+		Reads the oldest item that has not been overwritten
+		- reader thread only
+
+		\param item the item, returned by reference
+		\return false if there is nothing new
+		*/
+		bool pop(T& item)
+		{
+			uint64_t write = writeIndex.load(std::memory_order_acquire);
+			while (readIndex < write)
+			{
+				// --- the writer lapped us: skip to the oldest item still in the channel
+				if (write - readIndex > SIZE)
+				{
+					droppedItems.fetch_add(write - SIZE - readIndex, std::memory_order_relaxed);
+					readIndex = write - SIZE;
+				}
+
+				Slot& slot = slots[readIndex & (SIZE - 1)];
+				uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+				if (sequence == readIndex + 1)
+				{
+					item = slot.item;
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (slot.sequence.load(std::memory_order_relaxed) == sequence)
+					{
+						readIndex++;
+						return true;
+					}
+				}
+
+				// --- overwritten while we were reading it
+				droppedItems.fetch_add(1, std::memory_order_relaxed);
+				readIndex++;
+				write = writeIndex.load(std::memory_order_acquire);
+			}
+			return false;
+		}
+
+		/**
+		\brief
+		Reads the newest item and discards the older ones; for meters that only show the present
+		- reader thread only
+
+		\param item the item, returned by reference
+		\return false if there is nothing new
+		*/
+		bool popLatest(T& item)
+		{
+			uint64_t write = writeIndex.load(std::memory_order_acquire);
+			if (write > readIndex + 1)
+				readIndex = write - 1;
+			return pop(item);
+		}
+
+		/** items the reader never saw because the writer overwrote them */
+		uint64_t getDroppedItems() { return droppedItems.load(std::memory_order_relaxed); }
+
+	protected:
+		struct Slot
+		{
+			std::atomic<uint64_t> sequence;	///< write index + 1 of the item, 0 = being written
+			T item;							///< payload
+		};
+
+		Slot slots[SIZE];						///< ring storage
+		std::atomic<uint64_t> writeIndex;		///< items written; writer thread
+		uint64_t readIndex = 0;					///< items consumed; reader thread
+		std::atomic<uint64_t> droppedItems;		///< overwritten before they were read
+	};
+
+	/**
+	\class SynthTelemetry
+	\ingroup SynthObjects
+	\brief
+	The telemetry bus between an engine's audio thread and its GUI
+	- the audio thread writes scope data every render( ) and the status items (voices, sequencer,
+	load) at TELEMETRY_STATUS_RATE_HZ; it does nothing at all while the bus is disabled
+	- the GUI thread enables the bus and drains the channels at its own pace
+	- one writer and one reader per channel
+
+	\author Will Pirkle http://www.willpirkle.com
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class SynthTelemetry
+	{
+	public:
+		SynthTelemetry();
+		~SynthTelemetry() {}
+
+		/** GUI thread: turn publishing on or off, set the scope decimation (engine samples per scope sample) */
+		void setEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+		bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+		void setScopeDecimation(uint32_t decimation) { scopeDecimation.store(decimation > 0 ? decimation : 1, std::memory_order_relaxed); }
+
+		/** audio thread */
+		void reset(double _sampleRate);
+		void writeScope(const float* left, const float* right, uint32_t samples);
+		void addRenderLoad(double renderSeconds, uint32_t samples);
+		bool isStatusDue();
+		void writeVoices(VoiceTelemetry& voices);
+		void writeSequencer(SequencerTelemetry& sequencer);
+		void writeLoad();
+
+		/** GUI thread: the channels to drain */
+		TelemetryChannel<ScopeTelemetry, TELEMETRY_SCOPE_BLOCKS>& getScopeChannel() { return scopeChannel; }
+		TelemetryChannel<VoiceTelemetry, TELEMETRY_STATUS_ITEMS>& getVoiceChannel() { return voiceChannel; }
+		TelemetryChannel<SequencerTelemetry, TELEMETRY_STATUS_ITEMS>& getSequencerChannel() { return sequencerChannel; }
+		TelemetryChannel<LoadTelemetry, TELEMETRY_STATUS_ITEMS>& getLoadChannel() { return loadChannel; }
+
+	protected:
+		// --- the channels
+		TelemetryChannel<ScopeTelemetry, TELEMETRY_SCOPE_BLOCKS> scopeChannel;
+		TelemetryChannel<VoiceTelemetry, TELEMETRY_STATUS_ITEMS> voiceChannel;
+		TelemetryChannel<SequencerTelemetry, TELEMETRY_STATUS_ITEMS> sequencerChannel;
+		TelemetryChannel<LoadTelemetry, TELEMETRY_STATUS_ITEMS> loadChannel;
+
+		// --- GUI settings
+		std::atomic<bool> enabled;
+		std::atomic<uint32_t> scopeDecimation;
+
+		// --- audio thread state
+		double sampleRate = 44100.0;
+		uint64_t sampleTime = 0;			///< samples rendered since reset
+		ScopeTelemetry scopeBlock;			///< block being filled
+		uint32_t scopeSamples = 0;			///< samples in scopeBlock
+		uint32_t scopeCountdown = 0;		///< engine samples until the next scope sample
+		uint32_t statusInterval = 735;		///< samples between status items
+		uint32_t statusSamples = 0;			///< samples since the last status item
+		double renderSeconds = 0.0;			///< render time in the status interval
+		double audioSeconds = 0.0;			///< audio time in the status interval
+		double peakLoad = 0.0;				///< worst block in the status interval
+	};
+
+} // namespace
+
+#endif /* defined(__synthTelemetry_h__) */
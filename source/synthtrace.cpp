@@ -0,0 +1,338 @@
+#include "synthtrace.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthtrace.cpp
+\author Will Pirkle
+\brief  Real-time safe tracing of engine activity with Chrome trace-event JSON export
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	// --- ring index of the calling thread, -1 = not registered
+	static thread_local int32_t traceThreadIndex = -1;
+
+	// --- names of the TraceEventType values, and the Chrome trace phase for each
+	static const char* traceEventNames[static_cast<uint32_t>(TraceEventType::kNumTraceEventTypes)] =
+	{ "block", "block", "voice", "voice", "note-on", "note-off", "voice-steal", "core-swap", "database-miss" };
+
+	static const char traceEventPhases[static_cast<uint32_t>(TraceEventType::kNumTraceEventTypes)] =
+	{ 'B', 'E', 'B', 'E', 'i', 'i', 'i', 'i', 'i' };
+
+	// --- TraceRingBuffer --------------------------------------------------------------------------------- //
+	/**
+	\brief
+	Constructs the ring; the only allocation it will ever do
+
+	\param _size number of events, rounded up to a power of 2
+	*/
+	TraceRingBuffer::TraceRingBuffer(uint32_t _size)
+	{
+		uint32_t size = 2;
+		while (size < _size)
+			size <<= 1;
+
+		events.reset(new TraceEvent[size]);
+		mask = size - 1;
+		writeIndex.store(0);
+		readIndex.store(0);
+		droppedEvents.store(0);
+	}
+
+	/**
+	\brief
+	Writes an event; wait-free
+
+	\param event the event to store
+	\return false if the ring was full and the event was dropped
+	*/
+	bool TraceRingBuffer::push(const TraceEvent& event)
+	{
+		uint32_t write = writeIndex.load(std::memory_order_relaxed);
+		if (write - readIndex.load(std::memory_order_acquire) > mask)
+		{
+			droppedEvents.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		events[write & mask] = event;
+		writeIndex.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	\brief
+	Reads the oldest event
+
+	\param event the event, returned by reference
+	\return false if the ring is empty
+	*/
+	bool TraceRingBuffer::pop(TraceEvent& event)
+	{
+		uint32_t read = readIndex.load(std::memory_order_relaxed);
+		if (read == writeIndex.load(std::memory_order_acquire))
+			return false;
+
+		event = events[read & mask];
+		readIndex.store(read + 1, std::memory_order_release);
+		return true;
+	}
+
+	// --- SynthTracer ------------------------------------------------------------------------------------- //
+	/**
+	\brief
+	The process-wide tracer; constructed on first use
+
+	\return the tracer
+	*/
+	SynthTracer& SynthTracer::getInstance()
+	{
+		static SynthTracer tracer;
+		return tracer;
+	}
+
+	SynthTracer::SynthTracer()
+	{
+		threadCount.store(0);
+		unregisteredEvents.store(0);
+		enabled.store(false);
+		draining.store(false);
+	}
+
+	SynthTracer::~SynthTracer()
+	{
+		stopSession();
+	}
+
+	/**
+	\brief
+	Gives the calling thread its own ring buffer
+	- call from the thread itself, before it starts rendering
+	- NOT real-time safe: allocates the ring
+
+	\param threadName name shown on the trace timeline
+	\return the ring index or -1 if all rings are taken
+	*/
+	int32_t SynthTracer::registerThread(const char* threadName)
+	{
+		if (traceThreadIndex >= 0)
+			return traceThreadIndex;
+
+		std::lock_guard<std::mutex> lock(registerMutex);
+		uint32_t index = threadCount.load(std::memory_order_relaxed);
+		if (index >= MAX_TRACE_THREADS)
+			return -1;
+
+		rings[index].reset(new TraceRingBuffer(TRACE_RING_SIZE));
+		if (threadName)
+			threadNames[index] = threadName;
+		else
+			threadNames[index] = "thread " + std::to_string(index);
+
+		// --- publish the ring to the drainer
+		threadCount.store(index + 1, std::memory_order_release);
+		traceThreadIndex = (int32_t)index;
+		return traceThreadIndex;
+	}
+
+	/**
+	\brief
+	Records an event on the calling thread's ring
+	- no locks, no formatting, no allocation
+	- the thread must have called registerThread( ); otherwise the event is dropped and counted
+
+	\param type the event type
+	\param arg0 event specific argument, see TraceEventType
+	\param arg1 event specific argument, see TraceEventType
+	*/
+	void SynthTracer::writeEvent(TraceEventType type, uint32_t arg0, uint32_t arg1)
+	{
+		if (!enabled.load(std::memory_order_relaxed))
+			return;
+
+		// --- registering here would lock and allocate on the audio thread
+		if (traceThreadIndex < 0)
+		{
+			unregisteredEvents.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		TraceEvent event;
+		event.timestamp = readTraceClock();
+		event.type = static_cast<uint32_t>(type);
+		event.arg0 = arg0;
+		event.arg1 = arg1;
+		rings[traceThreadIndex]->push(event);
+	}
+
+	/**
+	\brief
+	Opens the JSON file, calibrates the clock and starts the drainer thread
+
+	\param jsonFilePath the output file
+	\return true if sucessful
+	*/
+	bool SynthTracer::startSession(const char* jsonFilePath)
+	{
+		std::lock_guard<std::mutex> lock(registerMutex);
+		if (traceFile || !jsonFilePath)
+			return false;
+
+		traceFile = fopen(jsonFilePath, "w");
+		if (!traceFile)
+			return false;
+
+		fprintf(traceFile, "{\"traceEvents\":[\n");
+		firstJSONEvent = true;
+
+		// --- discard anything left over from a previous session
+		TraceEvent event;
+		uint32_t count = threadCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			while (rings[i]->pop(event)) {}
+		}
+
+		// --- calibrate ticks to microseconds against the steady clock
+#ifdef SYNTHLAB_TRACE_TSC
+		auto steadyStart = std::chrono::steady_clock::now();
+		uint64_t tickStart = readTraceClock();
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		uint64_t tickEnd = readTraceClock();
+		double usec = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - steadyStart).count() / 1000.0;
+		ticksPerMicrosecond = usec > 0.0 ? (double)(tickEnd - tickStart) / usec : 1000.0;
+#else
+		ticksPerMicrosecond = 1000.0; // --- nanoseconds
+#endif
+		startTicks = readTraceClock();
+
+		draining.store(true);
+		drainerThread = std::thread(&SynthTracer::drainerThreadFunction, this);
+		enabled.store(true, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	\brief
+	Stops recording, drains the remaining events and closes the JSON file
+
+	\return true if a session was running
+	*/
+	bool SynthTracer::stopSession()
+	{
+		enabled.store(false, std::memory_order_release);
+
+		if (draining.exchange(false) && drainerThread.joinable())
+			drainerThread.join();
+
+		std::lock_guard<std::mutex> lock(registerMutex);
+		if (!traceFile)
+			return false;
+
+		// --- last events, then thread names as metadata
+		drainRings();
+		uint32_t count = threadCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			fprintf(traceFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+				firstJSONEvent ? "" : ",\n", i, threadNames[i].c_str());
+			firstJSONEvent = false;
+		}
+
+		fprintf(traceFile, "\n],\"otherData\":{\"droppedEvents\":%u}}\n", getDroppedEvents());
+		fclose(traceFile);
+		traceFile = nullptr;
+		return true;
+	}
+
+	/**
+	\brief
+	Total events dropped because a ring was full or the thread was not registered
+
+	\return drop count across all threads
+	*/
+	uint32_t SynthTracer::getDroppedEvents()
+	{
+		uint32_t dropped = unregisteredEvents.load(std::memory_order_relaxed);
+		uint32_t count = threadCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++)
+			dropped += rings[i]->getDroppedEvents();
+		return dropped;
+	}
+
+	/**
+	\brief
+	Drainer thread: empties the rings every few milliseconds
+	*/
+	void SynthTracer::drainerThreadFunction()
+	{
+		while (draining.load(std::memory_order_acquire))
+		{
+			if (!drainRings())
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+	}
+
+	/**
+	\brief
+	Converts all pending events to JSON
+
+	\return true if any events were written
+	*/
+	bool SynthTracer::drainRings()
+	{
+		if (!traceFile) return false;
+
+		bool wroteEvents = false;
+		TraceEvent event;
+		uint32_t count = threadCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			while (rings[i]->pop(event))
+			{
+				writeJSONEvent(i, event);
+				wroteEvents = true;
+			}
+		}
+		return wroteEvents;
+	}
+
+	/**
+	\brief
+	Writes one Chrome trace-event object
+
+	\param threadIndex ring index, used as the tid
+	\param event the event to write
+	*/
+	void SynthTracer::writeJSONEvent(uint32_t threadIndex, const TraceEvent& event)
+	{
+		if (event.type >= static_cast<uint32_t>(TraceEventType::kNumTraceEventTypes))
+			return;
+
+		char phase = traceEventPhases[event.type];
+		fprintf(traceFile, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u%s,\"args\":{\"arg0\":%u,\"arg1\":%u}}",
+			firstJSONEvent ? "" : ",\n",
+			traceEventNames[event.type], phase, ticksToMicroseconds(event.timestamp), threadIndex,
+			phase == 'i' ? ",\"s\":\"t\"" : "",
+			event.arg0, event.arg1);
+		firstJSONEvent = false;
+	}
+
+	/**
+	\brief
+	Converts a timestamp to microseconds since the start of the session
+
+	\param ticks readTraceClock( ) value
+	\return microseconds
+	*/
+	double SynthTracer::ticksToMicroseconds(uint64_t ticks)
+	{
+		if (ticks < startTicks) return 0.0;
+		return (double)(ticks - startTicks) / ticksPerMicrosecond;
+	}
+
+} // namespace
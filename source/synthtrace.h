@@ -0,0 +1,190 @@
+#ifndef __synthTrace_h__
+#define __synthTrace_h__
+
+// --- includes
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SYNTHLAB_TRACE_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define SYNTHLAB_TRACE_TSC 1
+#endif
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   synthtrace.h
+\author Will Pirkle
+\brief  Real-time safe tracing of engine activity with Chrome trace-event JSON export
+- compile with SYNTHLAB_TRACING defined to enable the SYNTHLAB_TRACE_EVENT( ) macro;
+otherwise the macro compiles to nothing
+- open the resulting .json file with chrome://tracing or https://ui.perfetto.dev
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\enum TraceEventType
+	\ingroup Constants-Enums
+	\brief
+	Binary trace event types; Begin/End pairs become duration slices, all others are instants
+	*/
+	enum class TraceEventType : uint32_t
+	{
+		kBlockBegin,		///< arg0 = samples in block
+		kBlockEnd,
+		kVoiceRenderBegin,	///< arg0 = voice index
+		kVoiceRenderEnd,	///< arg0 = voice index
+		kNoteOn,			///< arg0 = MIDI note, arg1 = velocity
+		kNoteOff,			///< arg0 = MIDI note, arg1 = velocity
+		kVoiceSteal,		///< arg0 = voice index, arg1 = MIDI note
+		kCoreSwap,			///< arg0 = new core index, arg1 = module type
+		kDatabaseMiss,		///< arg0 = 0 for wavetable, 1 for PCM sample database; arg1 = table index, if known
+		kNumTraceEventTypes
+	};
+
+	/**
+	\struct TraceEvent
+	\ingroup SynthStructures
+	\brief
+	Fixed size binary trace event; no strings are formatted on the writing thread
+	*/
+	struct TraceEvent
+	{
+		uint64_t timestamp = 0;	///< readTraceClock( ) ticks
+		uint32_t type = 0;		///< TraceEventType
+		uint32_t arg0 = 0;		///< event specific
+		uint32_t arg1 = 0;		///< event specific
+		uint32_t reserved = 0;	///< pad to 24 bytes
+	};
+
+	/**
+	\brief
+	Reads the trace timestamp clock
+	- the TSC on x86/x64, which costs a few nanoseconds
+	- falls back to std::chrono::steady_clock nanoseconds elsewhere
+	- ticks are converted to microseconds on the drainer thread only
+
+	\return the current tick count
+	*/
+	inline uint64_t readTraceClock()
+	{
+#ifdef SYNTHLAB_TRACE_TSC
+		return __rdtsc();
+#else
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	/**
+	\class TraceRingBuffer
+	\ingroup SynthObjects
+	\brief
+	Single-producer, single-consumer lock-free ring of TraceEvents
+	- the owning thread is the only writer, the drainer thread is the only reader
+	- never allocates or blocks after construction; events are dropped (and counted) when full
+	*/
+	class TraceRingBuffer
+	{
+	public:
+		TraceRingBuffer(uint32_t _size);
+		~TraceRingBuffer() {}
+
+		bool push(const TraceEvent& event);	///< writer thread only
+		bool pop(TraceEvent& event);		///< drainer thread only
+		uint32_t getDroppedEvents() { return droppedEvents.load(std::memory_order_relaxed); }
+
+	protected:
+		std::unique_ptr<TraceEvent[]> events;	///< ring storage
+		uint32_t mask = 0;						///< size - 1; size is a power of 2
+		std::atomic<uint32_t> writeIndex;		///< next slot to write
+		std::atomic<uint32_t> readIndex;		///< next slot to read
+		std::atomic<uint32_t> droppedEvents;	///< overflow count
+	};
+
+	/**
+	\class SynthTracer
+	\ingroup SynthObjects
+	\brief
+	Process-wide trace recorder with one TraceRingBuffer per thread
+	- call registerThread( ) on the render thread before it starts rendering (this allocates its
+	ring); WorkerPool threads register themselves when they start
+	- events from a thread that never registered are dropped and counted, never registered late
+	- writeEvent( ) is wait-free: one relaxed atomic load when tracing is stopped, plus one
+	timestamp read and a ring write when it is running
+	- startSession( ) launches a background drainer that converts the events to
+	Chrome trace-event JSON; stopSession( ) flushes and closes the file
+	- Perfetto's UI imports the same JSON format
+
+	\author Will Pirkle http://www.willpirkle.com
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class SynthTracer
+	{
+	public:
+		static SynthTracer& getInstance();
+		~SynthTracer();
+
+		/** thread setup; NOT real-time safe */
+		int32_t registerThread(const char* threadName);
+
+		/** the real-time safe part */
+		void writeEvent(TraceEventType type, uint32_t arg0 = 0, uint32_t arg1 = 0);
+		bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+		/** session control; NOT real-time safe */
+		bool startSession(const char* jsonFilePath);
+		bool stopSession();
+		uint32_t getDroppedEvents();
+
+		static const uint32_t MAX_TRACE_THREADS = 32;	///< number of rings
+		static const uint32_t TRACE_RING_SIZE = 16384;	///< events per ring (power of 2)
+
+	protected:
+		SynthTracer();
+
+		void drainerThreadFunction();
+		bool drainRings();
+		void writeJSONEvent(uint32_t threadIndex, const TraceEvent& event);
+		double ticksToMicroseconds(uint64_t ticks);
+
+		std::unique_ptr<TraceRingBuffer> rings[MAX_TRACE_THREADS];	///< one per registered thread
+		std::string threadNames[MAX_TRACE_THREADS];					///< for the thread_name metadata
+		std::atomic<uint32_t> threadCount;							///< registered rings
+		std::atomic<uint32_t> unregisteredEvents;					///< dropped: thread has no ring
+		std::mutex registerMutex;									///< registration and session control
+
+		std::atomic<bool> enabled;		///< writeEvent( ) gate
+		std::atomic<bool> draining;		///< drainer thread run flag
+		std::thread drainerThread;		///< converts events to JSON
+		FILE* traceFile = nullptr;		///< JSON output
+		bool firstJSONEvent = true;		///< for comma separation
+
+		// --- tick -> usec conversion, calibrated at session start
+		uint64_t startTicks = 0;
+		double ticksPerMicrosecond = 1000.0;
+	};
+
+} // namespace
+
+// --- the trace macro; compiles to nothing unless SYNTHLAB_TRACING is defined
+#ifdef SYNTHLAB_TRACING
+#define SYNTHLAB_TRACE_EVENT(type, arg0, arg1) SynthLab::SynthTracer::getInstance().writeEvent(type, arg0, arg1)
+#else
+#define SYNTHLAB_TRACE_EVENT(type, arg0, arg1) ((void)0)
+#endif
+
+#endif /* defined(__synthTrace_h__) */
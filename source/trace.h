@@ -1,38 +1,71 @@
-#pragma once
-// TRACE macro for win32
-#ifndef __TRACE_H__850CE873
-#define __TRACE_H__850CE873
-
-#include <crtdbg.h>
-#include <stdarg.h>
-#include <stdio.h>
-#include <string.h>
-
-#ifdef _DEBUG
-#define TRACEMAXSTRING	1024
-
-static char szBuffer[TRACEMAXSTRING];
-inline void TRACE(const char* format,...)
-{
-	va_list args;
-	va_start(args,format);
-	int nBuf;
-	nBuf = _vsnprintf(szBuffer,
-				   TRACEMAXSTRING,
-				   format,
-				   args);
-	va_end(args);
-
-	_RPT0(_CRT_WARN,szBuffer);
-}
-#define TRACEF _snprintf(szBuffer,TRACEMAXSTRING,"%s(%d): ", \
-				&strrchr(__FILE__,'\\')[1],__LINE__); \
-				_RPT0(_CRT_WARN,szBuffer); \
-				TRACE
-#else
-// Remove for release mode
-#define TRACE  ((void)0)
-#define TRACEF ((void)0)
-#endif
-
+#pragma once
+// TRACE macro for win32; prints to stderr on other platforms
+// NOTE: formats strings, so do not use on the audio thread -- see synthtrace.h
+#ifndef __TRACE_H__850CE873
+#define __TRACE_H__850CE873
+
+#ifdef _WIN32
+#include <crtdbg.h>
+#endif
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _DEBUG
+#define TRACEMAXSTRING	1024
+
+static char szBuffer[TRACEMAXSTRING];
+
+// --- file name without the path, for either separator
+inline const char* TRACEFILENAME(const char* path)
+{
+	const char* name = strrchr(path, '\\');
+	if (!name) name = strrchr(path, '/');
+	return name ? name + 1 : path;
+}
+
+// --- platform wrappers kept local so that no CRT names are redefined for includers
+inline void TRACEOUTPUT(const char* msg)
+{
+#ifdef _WIN32
+	_RPT0(_CRT_WARN, msg);
+#else
+	fputs(msg, stderr);
+#endif
+}
+
+inline void TRACEVFORMAT(const char* format, va_list args)
+{
+#ifdef _WIN32
+	_vsnprintf(szBuffer, TRACEMAXSTRING, format, args);
+#else
+	vsnprintf(szBuffer, TRACEMAXSTRING, format, args);
+#endif
+	szBuffer[TRACEMAXSTRING - 1] = 0;
+}
+
+inline void TRACE(const char* format,...)
+{
+	va_list args;
+	va_start(args,format);
+	TRACEVFORMAT(format, args);
+	va_end(args);
+
+	TRACEOUTPUT(szBuffer);
+}
+
+// --- prints the "file(line): " prefix for TRACEF
+inline void TRACEPREFIX(const char* file, int line)
+{
+	TRACE("%s(%d): ", TRACEFILENAME(file), line);
+}
+
+#define TRACEF TRACEPREFIX(__FILE__,__LINE__); \
+				TRACE
+#else
+// Remove for release mode
+#define TRACE  ((void)0)
+#define TRACEF ((void)0)
+#endif
+
 #endif // __TRACE_H__850CE873
\ No newline at end of file
@@ -86,6 +86,9 @@ namespace SynthLab
 		// --- OPTIONAL flag for dual mono operation (conserves CPU)
 		forceDualMonoFilters = processInfo.midiInputData->getAuxDAWDataUINT(kDualMonoFilters) == 1;
 
+		// --- the filters were reset; recalculate on the next update
+		updateDetector.invalidate();
+
 		return true;
 	}
 
@@ -139,143 +142,151 @@ namespace SynthLab
 		// --- sum modulations
 		double fcModSSemis = bpFmodSemitones + egFmodSemitones + ktFmodSemotones;
 
-		// --- multiply by pitch shift factor
-		fc *= pow(2.0, fcModSSemis / 12.0);
-		boundValue(fc, freqModLow, freqModHigh);
-
-		// --- output amplitude
-		outputAmp = pow(20.0, parameters->filterOutputGain_dB / 20.0);
+		// --- change detection: skip the fc and gain calculations and the coefficient
+		//     updates when none of their inputs moved
+		double updateKey[] = { fc, fcModSSemis, parameters->Q, parameters->filterOutputGain_dB,
+			(double)parameters->filterIndex, parameters->analogFGN ? 1.0 : 0.0 };
 
-		// --- decision tree for type and index
-		if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kLPF1))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF1;
-			else
-				outputIndex = LPF1;
-
-			selectedModel = FilterModel::kFirstOrder;
-			va1[LEFT].setFilterParams(fc, parameters->Q);
-			va1[LEFT].copyCoeffs(va1[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kHPF1))
-		{
-			outputIndex = HPF1;
-			selectedModel = FilterModel::kFirstOrder;
-			va1[LEFT].setFilterParams(fc, parameters->Q);
-			va1[LEFT].copyCoeffs(va1[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kAPF1))
-		{
-			outputIndex = APF1;
-			selectedModel = FilterModel::kFirstOrder;
-			va1[LEFT].setFilterParams(fc, parameters->Q);
-			va1[LEFT].copyCoeffs(va1[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_LP))
+		if (updateDetector.hasChanged(updateKey))
 		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF2;
-			else
-				outputIndex = LPF2;
-
-			selectedModel = FilterModel::kSVF;
-			svf[LEFT].setFilterParams(fc, parameters->Q);
-			svf[LEFT].copyCoeffs(svf[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_HP))
-		{
-			outputIndex = HPF2;
-			selectedModel = FilterModel::kSVF;
-			svf[LEFT].setFilterParams(fc, parameters->Q);
-			svf[LEFT].copyCoeffs(svf[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_BP))
-		{
-			outputIndex = BPF2;
-			selectedModel = FilterModel::kSVF;
-			svf[LEFT].setFilterParams(fc, parameters->Q);
-			svf[LEFT].copyCoeffs(svf[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_BS))
-		{
-			outputIndex = BSF2;
-			selectedModel = FilterModel::kSVF;
-			svf[LEFT].setFilterParams(fc, parameters->Q);
-			svf[LEFT].copyCoeffs(svf[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kKorg35_LP))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF2;
-			else
-				outputIndex = LPF2;
-
-			selectedModel = FilterModel::kKorg35;
-			korg35[LEFT].setFilterParams(fc, parameters->Q);
-			korg35[LEFT].copyCoeffs(korg35[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kKorg35_HP))
-		{
-			outputIndex = HPF2;
-			selectedModel = FilterModel::kKorg35;
-			korg35[LEFT].setFilterParams(fc, parameters->Q);
-			korg35[LEFT].copyCoeffs(korg35[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP1))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF1;
-			else
-				outputIndex = LPF1;
-
-			selectedModel = FilterModel::kMoog;
-			moog[LEFT].setFilterParams(fc, parameters->Q);
-			moog[LEFT].copyCoeffs(moog[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP2))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF2;
-			else
-				outputIndex = LPF2;
-
-			selectedModel = FilterModel::kMoog;
-			moog[LEFT].setFilterParams(fc, parameters->Q);
-			moog[LEFT].copyCoeffs(moog[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP3))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF3;
-			else
-				outputIndex = LPF3;
-
-			selectedModel = FilterModel::kMoog;
-			moog[LEFT].setFilterParams(fc, parameters->Q);
-			moog[LEFT].copyCoeffs(moog[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP4))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF4;
-			else
-				outputIndex = LPF4;
-
-			selectedModel = FilterModel::kMoog;
-			moog[LEFT].setFilterParams(fc, parameters->Q);
-			moog[LEFT].copyCoeffs(moog[RIGHT]);
-		}
-		else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kDiode_LP4))
-		{
-			if (parameters->analogFGN)
-				outputIndex = ANM_LPF4;
-			else
-				outputIndex = LPF4;
-
-			selectedModel = FilterModel::kDiode;
-			diode[LEFT].setFilterParams(fc, parameters->Q);
-			diode[LEFT].copyCoeffs(diode[RIGHT]);
+			// --- multiply by pitch shift factor
+			fc *= pow(2.0, fcModSSemis / 12.0);
+			boundValue(fc, freqModLow, freqModHigh);
+
+			// --- output amplitude
+			outputAmp = pow(20.0, parameters->filterOutputGain_dB / 20.0);
+
+			// --- decision tree for type and index
+			if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kLPF1))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF1;
+				else
+					outputIndex = LPF1;
+
+				selectedModel = FilterModel::kFirstOrder;
+				va1[LEFT].setFilterParams(fc, parameters->Q);
+				va1[LEFT].copyCoeffs(va1[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kHPF1))
+			{
+				outputIndex = HPF1;
+				selectedModel = FilterModel::kFirstOrder;
+				va1[LEFT].setFilterParams(fc, parameters->Q);
+				va1[LEFT].copyCoeffs(va1[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kAPF1))
+			{
+				outputIndex = APF1;
+				selectedModel = FilterModel::kFirstOrder;
+				va1[LEFT].setFilterParams(fc, parameters->Q);
+				va1[LEFT].copyCoeffs(va1[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_LP))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF2;
+				else
+					outputIndex = LPF2;
+
+				selectedModel = FilterModel::kSVF;
+				svf[LEFT].setFilterParams(fc, parameters->Q);
+				svf[LEFT].copyCoeffs(svf[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_HP))
+			{
+				outputIndex = HPF2;
+				selectedModel = FilterModel::kSVF;
+				svf[LEFT].setFilterParams(fc, parameters->Q);
+				svf[LEFT].copyCoeffs(svf[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_BP))
+			{
+				outputIndex = BPF2;
+				selectedModel = FilterModel::kSVF;
+				svf[LEFT].setFilterParams(fc, parameters->Q);
+				svf[LEFT].copyCoeffs(svf[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kSVF_BS))
+			{
+				outputIndex = BSF2;
+				selectedModel = FilterModel::kSVF;
+				svf[LEFT].setFilterParams(fc, parameters->Q);
+				svf[LEFT].copyCoeffs(svf[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kKorg35_LP))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF2;
+				else
+					outputIndex = LPF2;
+
+				selectedModel = FilterModel::kKorg35;
+				korg35[LEFT].setFilterParams(fc, parameters->Q);
+				korg35[LEFT].copyCoeffs(korg35[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kKorg35_HP))
+			{
+				outputIndex = HPF2;
+				selectedModel = FilterModel::kKorg35;
+				korg35[LEFT].setFilterParams(fc, parameters->Q);
+				korg35[LEFT].copyCoeffs(korg35[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP1))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF1;
+				else
+					outputIndex = LPF1;
+
+				selectedModel = FilterModel::kMoog;
+				moog[LEFT].setFilterParams(fc, parameters->Q);
+				moog[LEFT].copyCoeffs(moog[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP2))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF2;
+				else
+					outputIndex = LPF2;
+
+				selectedModel = FilterModel::kMoog;
+				moog[LEFT].setFilterParams(fc, parameters->Q);
+				moog[LEFT].copyCoeffs(moog[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP3))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF3;
+				else
+					outputIndex = LPF3;
+
+				selectedModel = FilterModel::kMoog;
+				moog[LEFT].setFilterParams(fc, parameters->Q);
+				moog[LEFT].copyCoeffs(moog[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kMoog_LP4))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF4;
+				else
+					outputIndex = LPF4;
+
+				selectedModel = FilterModel::kMoog;
+				moog[LEFT].setFilterParams(fc, parameters->Q);
+				moog[LEFT].copyCoeffs(moog[RIGHT]);
+			}
+			else if (parameters->filterIndex == enumToInt(VAFilterAlgorithm::kDiode_LP4))
+			{
+				if (parameters->analogFGN)
+					outputIndex = ANM_LPF4;
+				else
+					outputIndex = LPF4;
+
+				selectedModel = FilterModel::kDiode;
+				diode[LEFT].setFilterParams(fc, parameters->Q);
+				diode[LEFT].copyCoeffs(diode[RIGHT]);
+			}
 		}
 
 		return true;
@@ -377,6 +388,7 @@ namespace SynthLab
 	{
 		// --- save note pitch for key tracking
 		midiPitch = processInfo.noteEvent.midiPitch;
+		updateDetector.invalidate();
 
 		return true;
 	}
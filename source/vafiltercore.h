@@ -79,6 +79,10 @@ namespace SynthLab
 	- MOD_KNOB_C = "EG Int"
 	- MOD_KNOB_D = "BP Int"
 
+	Update:
+	- the cutoff, output gain and coefficient calculations are skipped when none of their
+	inputs changed since the last update (see UpdateChangeDetector)
+
 	Render:
 	- renders into the output buffer using pointers in the CoreProcData argument to the render function
 	- processes one block of audio input into one block of audio output per render cycle
@@ -90,7 +94,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class VAFilterCore : public ModuleCore
+	class VAFilterCore : public MemoryAccounted<VAFilterCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -105,6 +109,7 @@ namespace SynthLab
 		virtual bool render(CoreProcData& processInfo) override;
 		virtual bool doNoteOn(CoreProcData& processInfo) override;
 		virtual bool doNoteOff(CoreProcData& processInfo) override;
+		virtual void addUpdateCounters(UpdateCounters& counters) override { counters.add(updateDetector.getCounters()); }
 
 	protected:
 		// --- our member filters
@@ -125,6 +130,9 @@ namespace SynthLab
 
 		// --- for key track
 		double midiPitch = 440.0;		///< key tracking
+
+		// --- change detection
+		UpdateChangeDetector<6> updateDetector;	///< fc, Q, gain and type inputs of update( )
 	};
 
 
@@ -80,7 +80,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class VAOCore : public ModuleCore
+	class VAOCore : public MemoryAccounted<VAOCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
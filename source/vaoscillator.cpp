@@ -1,4 +1,5 @@
 #include "vaoscillator.h"
+#include "additivecore.h"
 
 
 // -----------------------------
@@ -27,7 +28,7 @@ namespace SynthLab
 	VAOscillator::VAOscillator(std::shared_ptr<MidiInputData> _midiInputData,
 		std::shared_ptr<VAOscParameters> _parameters, 
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -45,11 +46,14 @@ namespace SynthLab
 		coreProcessData.moduleParameters = parameters.get();
 		coreProcessData.midiInputData = midiInputData->getIMIDIInputData();
 
-		// --- setup the cores: VA has only one core
+		// --- setup the cores: the BLEP core, plus the additive core built on first selection
 		if (midiInputData->getAuxDAWDataUINT(kDMBuild) == 0)
 		{
 			std::shared_ptr<VAOCore> defaultCore = std::make_shared<VAOCore>();
 			addModuleCore(std::static_pointer_cast<ModuleCore>(defaultCore));
+
+			// Core 1:
+			addModuleCoreFactory(createModuleCore<AdditiveCore>, 1, "Additive");
 		}
 
 	}	/* C-TOR */
@@ -111,36 +115,24 @@ namespace SynthLab
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool VAOscillator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		coreProcessData.unisonStartPhase = unisonStartPhase; 
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool VAOscillator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 
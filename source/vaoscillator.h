@@ -27,7 +27,7 @@ namespace SynthLab
 
 	The cores include (zero-indexed):
 	0. VAOCore: uses BLEP to synthesize sawtooth and square waveforms
-	1. --- EMPTY ---
+	1. AdditiveCore: 64 to 512 partials from a vectorized bank of recursive sine oscillators
 	2. --- EMPTY ---
 	3. --- EMPTY ---
 
@@ -101,7 +101,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class VAOscillator : public SynthModule
+	class VAOscillator : public MemoryAccounted<VAOscillator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
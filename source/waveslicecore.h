@@ -83,7 +83,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class WaveSliceCore : public ModuleCore
+	class WaveSliceCore : public MemoryAccounted<WaveSliceCore, ModuleCore>
 	{
 	public:
 		/** simple default constructor */
@@ -0,0 +1,515 @@
+#include "wavetableimporter.h"
+#include "pcmsample.h"
+#include "synthpatch.h"
+#include "workerpool.h"
+#include "fft.h"
+
+#include <fstream>
+#include <iterator>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   wavetableimporter.cpp
+\author Will Pirkle
+\brief  Runtime wavetable import from single-cycle and multi-frame WAV files
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	// --- wavetable pack: the binary patch container with its own variant ID and two chunks
+	static uint32_t getWavetablePackID() { return makePatchTag('S', 'L', 'W', 'T'); }
+	static const uint32_t kPackHeaderTag = makePatchTag('W', 'T', 'H', 'D');
+	static const uint32_t kPackTablesTag = makePatchTag('W', 'T', 'B', 'L');
+
+	// --- runs the jobs on the pool, or here if there is none
+	static void runJobs(WorkerPool* pool, uint32_t count, const std::function<void(uint32_t)>& job)
+	{
+		if (pool)
+		{
+			pool->parallelFor(count, job);
+			return;
+		}
+		for (uint32_t i = 0; i < count; i++)
+			job(i);
+	}
+
+	/**
+	\brief
+	Reads the frames of a WAV file with the PCMSample loader
+	- frameLength = 0: a file whose length is a multiple of WT_IMPORT_FRAME_LENGTH (and longer
+	than one frame) is a multi-frame wavetable, otherwise a file of up to WT_IMPORT_MAX_CYCLE_LENGTH
+	samples is one cycle
+	- stereo files are mixed to mono; frames past WT_IMPORT_MAX_FRAMES are ignored
+	- the frame layout is fixed by the first load, so that the frame sources can stay registered
+
+	\param wavFilePath fully qualified WAV file path
+	\param _frameLength samples per frame, or 0 to detect
+
+	\return true if sucessful
+	*/
+	bool ImportedWavetable::load(const char* wavFilePath, uint32_t _frameLength)
+	{
+		PCMSample sample;
+		if (!wavFilePath || !sample.loadPCMSample(wavFilePath) || sample.getNumChannels() == 0)
+			return false;
+
+		uint32_t channels = sample.getNumChannels();
+		uint32_t totalFrames = sample.getSampleCount() / channels;
+
+		if (_frameLength == 0)
+		{
+			if (totalFrames > WT_IMPORT_FRAME_LENGTH && totalFrames % WT_IMPORT_FRAME_LENGTH == 0)
+				_frameLength = WT_IMPORT_FRAME_LENGTH;
+			else if (totalFrames <= WT_IMPORT_MAX_CYCLE_LENGTH)
+				_frameLength = totalFrames;
+			else
+				return false;
+		}
+
+		if (_frameLength < 4 || _frameLength > totalFrames)
+			return false;
+
+		uint32_t _frameCount = std::min(totalFrames / _frameLength, WT_IMPORT_MAX_FRAMES);
+		if (!frameSources.empty() && _frameCount != frameCount)
+			return false;
+
+		frameLength = _frameLength;
+		frameCount = _frameCount;
+		sourcePath = wavFilePath;
+
+		// --- mix to mono
+		const float* samples = sample.getSampleBuffer();
+		frames.assign((size_t)frameCount * frameLength, 0.0);
+		for (size_t i = 0; i < frames.size(); i++)
+		{
+			double sum = 0.0;
+			for (uint32_t c = 0; c < channels; c++)
+				sum += samples[i * channels + c];
+			frames[i] = sum / channels;
+		}
+
+		// --- the spectra and tables are from the old frames
+		frameRe.clear();
+		frameIm.clear();
+		sampleRate = 0.0;
+		return true;
+	}
+
+	/**
+	\brief
+	Spectrum of one frame, bins 0 -> frameLength/2
+	- power-of-two frames use the FFT; others (e.g. 600 sample single-cycle files) a direct DFT,
+	which is exact for any length and cheap at single-cycle sizes
+
+	\param frame the frame index
+	*/
+	void ImportedWavetable::analyzeFrame(uint32_t frame)
+	{
+		uint32_t bins = frameLength / 2 + 1;
+		const double* input = &frames[(size_t)frame * frameLength];
+		double* re = &frameRe[(size_t)frame * bins];
+		double* im = &frameIm[(size_t)frame * bins];
+
+		FFT fft;
+		if (fft.init(frameLength))
+		{
+			fft.forward(input, re, im);
+			return;
+		}
+
+		// --- direct DFT with a one-cycle twiddle table; (k * n) mod N picks the angle
+		std::vector<double> cosTable(frameLength);
+		std::vector<double> sinTable(frameLength);
+		for (uint32_t n = 0; n < frameLength; n++)
+		{
+			cosTable[n] = cos(kTwoPi * n / frameLength);
+			sinTable[n] = sin(kTwoPi * n / frameLength);
+		}
+
+		for (uint32_t k = 0; k < bins; k++)
+		{
+			double sumRe = 0.0;
+			double sumIm = 0.0;
+			uint32_t angle = 0;
+			for (uint32_t n = 0; n < frameLength; n++)
+			{
+				sumRe += input[n] * cosTable[angle];
+				sumIm -= input[n] * sinTable[angle];
+				angle += k;
+				if (angle >= frameLength)
+					angle -= frameLength;
+			}
+			re[k] = sumRe;
+			im[k] = sumIm;
+		}
+	}
+
+	/**
+	\brief
+	Note ranges, harmonic limits and table lengths of the octave tables; the ranges are the
+	same as the FourierWTCore tables (A0 and below, then one octave each, the last to note 127)
+	- the highest harmonic stays below Nyquist at the top note of the range, raised by a half
+	semitone because the cores round the modulated pitch to the nearest note
+	- tables are at least 4x the highest harmonic long (for the linear interpolation), and at
+	least kDefaultWaveTableLength
+
+	\param _sampleRate the synth sample rate
+	*/
+	void ImportedWavetable::planMips(double _sampleRate)
+	{
+		uint32_t sourceHarmonics = (frameLength - 1) / 2;
+		double halfSemitone = pow(2.0, 0.5 / 12.0);
+
+		mips.assign((size_t)frameCount * WT_IMPORT_OCTAVE_TABLES, WavetableMip());
+		uint32_t startNote = 0;
+		uint32_t endNote = MIDI_NOTE_A0;
+		for (uint32_t octave = 0; octave < WT_IMPORT_OCTAVE_TABLES; octave++)
+		{
+			if (octave == WT_IMPORT_OCTAVE_TABLES - 1)
+				endNote = NUM_MIDI_NOTES - 1;
+
+			double topFrequency = midiNoteNumberToOscFrequency(endNote) * halfSemitone;
+			uint32_t harmonics = (uint32_t)ceil(0.5 * _sampleRate / topFrequency) - 1;
+			harmonics = std::max(1u, std::min(harmonics, sourceHarmonics));
+
+			uint32_t length = kDefaultWaveTableLength;
+			while (length < 4 * harmonics && length < WT_IMPORT_MAX_TABLE_LENGTH)
+				length *= 2;
+			harmonics = std::min(harmonics, length / 2 - 1);
+
+			for (uint32_t frame = 0; frame < frameCount; frame++)
+			{
+				WavetableMip& mip = mips[(size_t)frame * WT_IMPORT_OCTAVE_TABLES + octave];
+				mip.startNote = startNote;
+				mip.endNote = endNote;
+				mip.harmonics = harmonics;
+				mip.length = length;
+			}
+
+			startNote = endNote + 1;
+			endNote += 12;
+		}
+	}
+
+	/**
+	\brief
+	One octave table: the frame's harmonics 1 -> mip.harmonics, rescaled to the table length,
+	through the inverse FFT; DC and everything above the limit are zero
+
+	\param frame the frame index
+	\param octave the octave table index
+	*/
+	void ImportedWavetable::buildMip(uint32_t frame, uint32_t octave)
+	{
+		WavetableMip& mip = mips[(size_t)frame * WT_IMPORT_OCTAVE_TABLES + octave];
+		uint32_t bins = frameLength / 2 + 1;
+		const double* re = &frameRe[(size_t)frame * bins];
+		const double* im = &frameIm[(size_t)frame * bins];
+
+		FFT fft;
+		fft.init(mip.length);
+
+		// --- x[n] = (1/N) sum X[k] e^(2pi i kn/N): the same waveform at length L has bins X[k] L/N
+		double scale = (double)mip.length / (double)frameLength;
+		std::vector<double> tableRe(mip.length / 2 + 1, 0.0);
+		std::vector<double> tableIm(mip.length / 2 + 1, 0.0);
+		for (uint32_t k = 1; k <= mip.harmonics; k++)
+		{
+			tableRe[k] = re[k] * scale;
+			tableIm[k] = im[k] * scale;
+		}
+
+		mip.table.reset(new double[mip.length], std::default_delete<double[]>());
+		fft.inverse(tableRe.data(), tableIm.data(), mip.table.get());
+	}
+
+	/**
+	\brief
+	Makes the band-limited tables for a sample rate and hands them to the frame sources
+	- loads the wavetable pack instead if it was built from the same frames at the same rate;
+	otherwise builds the tables (in parallel if a pool is given) and writes the pack
+	- NOT real-time safe
+
+	\param _sampleRate the synth sample rate
+	\param pool worker threads, or nullptr to build on the calling thread
+
+	\return true if sucessful
+	*/
+	bool ImportedWavetable::build(double _sampleRate, WorkerPool* pool)
+	{
+		if (frameCount == 0 || _sampleRate <= 0.0)
+			return false;
+
+		if (_sampleRate == sampleRate)
+			return true;
+
+		loadedFromPack = false;
+		std::string packPath = sourcePath + ".slwt";
+		if (!sourcePath.empty() && loadPack(packPath, _sampleRate))
+		{
+			loadedFromPack = true;
+			sampleRate = _sampleRate;
+			fillSources();
+			return true;
+		}
+
+		// --- spectra do not depend on the rate; only made once per load
+		if (frameRe.empty())
+		{
+			uint32_t bins = frameLength / 2 + 1;
+			frameRe.assign((size_t)frameCount * bins, 0.0);
+			frameIm.assign((size_t)frameCount * bins, 0.0);
+			runJobs(pool, frameCount, [&](uint32_t frame) { analyzeFrame(frame); });
+		}
+
+		// --- every frame x octave table is independent
+		planMips(_sampleRate);
+		runJobs(pool, frameCount * WT_IMPORT_OCTAVE_TABLES, [&](uint32_t job)
+		{
+			buildMip(job / WT_IMPORT_OCTAVE_TABLES, job % WT_IMPORT_OCTAVE_TABLES);
+		});
+
+		// --- one gain for all tables, so the frames keep their relative levels and the octaves
+		//     do not jump in level; the fullest tables (octave 0) set the peak
+		double peak = 0.0;
+		for (uint32_t frame = 0; frame < frameCount; frame++)
+		{
+			const WavetableMip& mip = mips[(size_t)frame * WT_IMPORT_OCTAVE_TABLES];
+			for (uint32_t i = 0; i < mip.length; i++)
+				peak = std::max(peak, fabs(mip.table.get()[i]));
+		}
+		if (peak > 0.0)
+		{
+			double gain = 1.0 / peak;
+			for (WavetableMip& mip : mips)
+			{
+				for (uint32_t i = 0; i < mip.length; i++)
+					mip.table.get()[i] *= gain;
+			}
+		}
+
+		sampleRate = _sampleRate;
+		fillSources();
+
+		// --- a pack that cannot be written only costs a rebuild next time
+		if (!sourcePath.empty())
+			savePack(packPath);
+		return true;
+	}
+
+	/**
+	\brief
+	Creates the frame sources on the first call, then adds the octave tables of each frame
+	across their note ranges; tables replaced by a rebuild are released when the sources
+	let go of them
+	*/
+	void ImportedWavetable::fillSources()
+	{
+		if (frameSources.empty())
+		{
+			// --- names first: the sources keep pointers to them
+			frameNames.resize(frameCount);
+			for (uint32_t frame = 0; frame < frameCount; frame++)
+				frameNames[frame] = frameCount == 1 ? name : name + " " + std::to_string(frame + 1);
+
+			for (uint32_t frame = 0; frame < frameCount; frame++)
+				frameSources.push_back(std::unique_ptr<DynamicTableSource>(new DynamicTableSource));
+		}
+
+		for (uint32_t frame = 0; frame < frameCount; frame++)
+		{
+			for (uint32_t octave = 0; octave < WT_IMPORT_OCTAVE_TABLES; octave++)
+			{
+				const WavetableMip& mip = mips[(size_t)frame * WT_IMPORT_OCTAVE_TABLES + octave];
+				frameSources[frame]->addWavetable(mip.startNote, mip.endNote, mip.table, mip.length, frameNames[frame].c_str());
+			}
+		}
+	}
+
+	/**
+	\brief
+	Adds the frame sources to a wavetable database under the frame names
+	- a name that is already registered to this wavetable's source is skipped
+	- replace: a name that another source has (a built-in waveform) is taken over with
+	IWavetableDatabase::replaceTableSource( ); the cores switch to the frame on their next update
+
+	\param wavetableDatabase the database, usually the engine's
+	\param replace true to take over names that other sources have
+
+	\return false if not built yet, or if another source already has one of the names and it
+	could not be replaced
+	*/
+	bool ImportedWavetable::registerSources(IWavetableDatabase* wavetableDatabase, bool replace)
+	{
+		if (!wavetableDatabase || frameSources.empty())
+			return false;
+
+		bool registered = true;
+		for (uint32_t frame = 0; frame < frameCount; frame++)
+		{
+			const char* frameName = frameNames[frame].c_str();
+			IWavetableSource* existing = wavetableDatabase->getTableSource(frameName);
+			if (existing == frameSources[frame].get())
+				continue;
+
+			uint32_t uniqueIndex = 0;
+			if (replace)
+			{
+				if (!wavetableDatabase->replaceTableSource(frameName, frameSources[frame].get(), uniqueIndex))
+					registered = false;
+			}
+			else if (existing || !wavetableDatabase->addTableSource(frameName, frameSources[frame].get(), uniqueIndex))
+				registered = false;
+		}
+		return registered;
+	}
+
+	/**
+	\brief
+	Hash of the frame length and samples; a pack built from other frames is not used
+
+	\return the fingerprint
+	*/
+	uint32_t ImportedWavetable::getFingerprint()
+	{
+		uint32_t hash = 2166136261u;
+		auto add = [&hash](const void* data, size_t bytes)
+		{
+			const uint8_t* p = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < bytes; i++)
+			{
+				hash ^= p[i];
+				hash *= 16777619u;
+			}
+		};
+		add(&frameLength, sizeof(frameLength));
+		add(frames.data(), frames.size() * sizeof(double));
+		return hash;
+	}
+
+	/**
+	\brief
+	Writes the built tables as a wavetable pack: the binary patch container (see synthpatch.h)
+	with a header chunk (rate, frame layout, fingerprint) and one chunk with every table
+
+	\param packPath file to write
+
+	\return true if sucessful
+	*/
+	bool ImportedWavetable::savePack(const std::string& packPath)
+	{
+		if (sampleRate <= 0.0 || mips.empty())
+			return false;
+
+		PatchWriter writer(getWavetablePackID());
+
+		uint32_t fingerprint = getFingerprint();
+		uint32_t octaves = WT_IMPORT_OCTAVE_TABLES;
+		writer.beginChunk(kPackHeaderTag, kPatchChunkVersion);
+		writer.value(sampleRate);
+		writer.value(frameLength);
+		writer.value(frameCount);
+		writer.value(octaves);
+		writer.value(fingerprint);
+		writer.endChunk();
+
+		writer.beginChunk(kPackTablesTag, kPatchChunkVersion);
+		for (WavetableMip& mip : mips)
+		{
+			writer.value(mip.startNote);
+			writer.value(mip.endNote);
+			writer.value(mip.harmonics);
+			writer.value(mip.length);
+			for (uint32_t i = 0; i < mip.length; i++)
+				writer.value(mip.table.get()[i]);
+		}
+		writer.endChunk();
+
+		std::ofstream packFile(packPath.c_str(), std::ios::binary | std::ios::trunc);
+		if (!packFile)
+			return false;
+
+		const std::vector<uint8_t>& data = writer.getData();
+		packFile.write(reinterpret_cast<const char*>(data.data()), data.size());
+		return packFile.good();
+	}
+
+	/**
+	\brief
+	Reads the tables from a wavetable pack if it was built from these frames at this rate
+
+	\param packPath file to read
+	\param _sampleRate the synth sample rate
+
+	\return true if the pack matched and was read completely
+	*/
+	bool ImportedWavetable::loadPack(const std::string& packPath, double _sampleRate)
+	{
+		std::ifstream packFile(packPath.c_str(), std::ios::binary);
+		if (!packFile)
+			return false;
+
+		std::vector<uint8_t> data((std::istreambuf_iterator<char>(packFile)), std::istreambuf_iterator<char>());
+
+		PatchReader reader;
+		PatchChunkReader header;
+		if (!reader.open(data.data(), (uint32_t)data.size(), getWavetablePackID()) || !reader.findChunk(kPackHeaderTag, header))
+			return false;
+
+		double packRate = 0.0;
+		uint32_t packFrameLength = 0;
+		uint32_t packFrameCount = 0;
+		uint32_t packOctaves = 0;
+		uint32_t packFingerprint = 0;
+		if (!header.value(packRate) || !header.value(packFrameLength) || !header.value(packFrameCount) ||
+			!header.value(packOctaves) || !header.value(packFingerprint))
+			return false;
+
+		if (packRate != _sampleRate || packFrameLength != frameLength || packFrameCount != frameCount ||
+			packOctaves != WT_IMPORT_OCTAVE_TABLES || packFingerprint != getFingerprint())
+			return false;
+
+		PatchChunkReader tables;
+		if (!reader.findChunk(kPackTablesTag, tables))
+			return false;
+
+		std::vector<WavetableMip> packMips((size_t)frameCount * WT_IMPORT_OCTAVE_TABLES);
+		for (WavetableMip& mip : packMips)
+		{
+			if (!tables.value(mip.startNote) || !tables.value(mip.endNote) || !tables.value(mip.harmonics) || !tables.value(mip.length))
+				return false;
+			if (mip.length == 0 || mip.length > WT_IMPORT_MAX_TABLE_LENGTH || (mip.length & (mip.length - 1)) != 0 ||
+				mip.startNote > mip.endNote || mip.endNote >= NUM_MIDI_NOTES)
+				return false;
+
+			mip.table.reset(new double[mip.length], std::default_delete<double[]>());
+			for (uint32_t i = 0; i < mip.length; i++)
+			{
+				if (!tables.value(mip.table.get()[i]))
+					return false;
+			}
+		}
+
+		mips.swap(packMips);
+		return true;
+	}
+
+	/**
+	\brief
+	Memory accounting
+
+	\return bytes of the frames, spectra and tables
+	*/
+	uint64_t ImportedWavetable::getAllocatedBytes()
+	{
+		uint64_t bytes = (frames.capacity() + frameRe.capacity() + frameIm.capacity()) * sizeof(double);
+		for (const WavetableMip& mip : mips)
+			bytes += (uint64_t)mip.length * sizeof(double);
+		return bytes;
+	}
+
+} // namespace
@@ -0,0 +1,152 @@
+#ifndef __wavetableImporter_h__
+#define __wavetableImporter_h__
+
+// --- includes
+#include "synthbase.h"
+#include "synthfunctions.h"
+#include "dynamictablesource.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   wavetableimporter.h
+\author Will Pirkle
+\brief  Runtime wavetable import from single-cycle and multi-frame WAV files
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	class WorkerPool;
+
+	//@{
+	/**
+	\ingroup Constants-Enums
+	Constants for the wavetable importer
+	*/
+	const uint32_t WT_IMPORT_FRAME_LENGTH = 2048;		///< default frame size of multi-frame WAVs
+	const uint32_t WT_IMPORT_MAX_CYCLE_LENGTH = 8192;	///< longer WAVs are split into frames
+	const uint32_t WT_IMPORT_MAX_FRAMES = 256;			///< frames per wavetable
+	const uint32_t WT_IMPORT_MAX_TABLE_LENGTH = 4096;	///< longest mip table
+	const uint32_t WT_IMPORT_OCTAVE_TABLES = 9;			///< mip tables per frame, one per octave
+	//@}
+
+	/**
+	\struct WavetableMip
+	\ingroup SynthStructures
+	\brief
+	One band-limited table of one frame, used over a range of MIDI notes
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	struct WavetableMip
+	{
+		uint32_t startNote = 0;		///< first MIDI note
+		uint32_t endNote = 0;		///< last MIDI note
+		uint32_t harmonics = 0;		///< highest harmonic kept
+		uint32_t length = 0;		///< table length, a power of two
+		std::shared_ptr<double> table = nullptr;	///< the table (shared with the DynamicTableSource)
+	};
+
+	/**
+	\class ImportedWavetable
+	\ingroup SynthObjects
+	\brief
+	A wavetable imported at runtime from a WAV file, exposed as one IWavetableSource per frame
+	- load( ) reads a single-cycle WAV, or a multi-frame WAV of equal length frames (2048 samples
+	by default), with the PCMSample loader; stereo files are mixed to mono
+	- build( ) takes the spectrum of each frame (FFT for power-of-two frames, otherwise a direct
+	DFT of the harmonics) and makes one band-limited table per octave: each keeps the harmonics
+	that stay below Nyquist at the top of its note range (plus a half semitone of tuning) at the
+	synth's sample rate. Tables are re-synthesized with the inverse FFT, DC is removed and every
+	frame is scaled by the same gain so that the loudest frame peaks at 1.0
+	- the frames and octaves are built in parallel on a WorkerPool, if one is given
+	- the built tables are stored in a wavetable pack next to the WAV (<file>.slwt) with the
+	sample rate and a fingerprint of the frames; build( ) loads the pack instead of building
+	when they match
+	- the frame sources are created once; build( ) at a new sample rate refills them in place,
+	so the pointers held by the wavetable database and the cores stay valid
+
+	Frame names: the wavetable name for a single-cycle WAV; "name 1", "name 2" ... for multi-frame WAVs
+
+	NOT real-time safe: load, build and register from a loader thread or before reset( );
+	build( ) at a new rate must not run while the audio thread renders
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class ImportedWavetable
+	{
+	public:
+		ImportedWavetable(const char* _name) : name(_name) {}
+		~ImportedWavetable() {}
+
+		/** read the frames; frameLength = 0 detects single-cycle vs. WT_IMPORT_FRAME_LENGTH frames */
+		bool load(const char* wavFilePath, uint32_t frameLength = 0);
+
+		/** band-limited tables for a sample rate, from the pack if it matches; pool may be null */
+		bool build(double sampleRate, WorkerPool* pool = nullptr);
+
+		/** add the frame sources to a database; false if a name is already taken, unless replace
+		    puts them in place of the sources that have the names (see IWavetableDatabase::replaceTableSource( )) */
+		bool registerSources(IWavetableDatabase* wavetableDatabase, bool replace = false);
+
+		/** wavetable pack: the built tables and what they were built from */
+		bool savePack(const std::string& packPath);
+		bool loadPack(const std::string& packPath, double sampleRate);
+
+		const std::string& getName() { return name; }
+		uint32_t getFrameCount() { return frameCount; }
+		uint32_t getFrameLength() { return frameLength; }
+		double getSampleRate() { return sampleRate; }
+		bool wasLoadedFromPack() { return loadedFromPack; }
+		IWavetableSource* getFrameSource(uint32_t frame) { return frame < frameSources.size() ? frameSources[frame].get() : nullptr; }
+		const char* getFrameName(uint32_t frame) { return frame < frameNames.size() ? frameNames[frame].c_str() : nullptr; }
+
+		/** memory accounting: frames, spectra and tables */
+		uint64_t getAllocatedBytes();
+
+	protected:
+		/** spectrum of one frame into frameRe/frameIm */
+		void analyzeFrame(uint32_t frame);
+
+		/** one octave table of one frame */
+		void buildMip(uint32_t frame, uint32_t octave);
+
+		/** note ranges and harmonic limits of the octave tables */
+		void planMips(double sampleRate);
+
+		/** hand the tables to the frame sources */
+		void fillSources();
+
+		/** FNV-1a hash of the frame samples, stored in the pack */
+		uint32_t getFingerprint();
+
+		std::string name;				///< wavetable name
+		std::string sourcePath;			///< WAV file
+		uint32_t frameLength = 0;		///< samples per frame
+		uint32_t frameCount = 0;		///< frames
+		double sampleRate = 0.0;		///< rate of the built tables; 0 = not built
+		bool loadedFromPack = false;	///< last build( ) used the pack
+
+		std::vector<double> frames;		///< frameCount x frameLength samples
+		std::vector<double> frameRe;	///< frameCount x (frameLength/2 + 1) bins
+		std::vector<double> frameIm;	///< frameCount x (frameLength/2 + 1) bins
+		std::vector<WavetableMip> mips;	///< frameCount x WT_IMPORT_OCTAVE_TABLES, frame-major
+
+		std::vector<std::string> frameNames;						///< storage for the waveform names
+		std::vector<std::unique_ptr<DynamicTableSource>> frameSources;	///< one source per frame
+	};
+
+} // namespace
+
+#endif /* defined(__wavetableImporter_h__) */
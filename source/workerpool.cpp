@@ -0,0 +1,141 @@
+#include "workerpool.h"
+#include "synthtrace.h"
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   workerpool.cpp
+\author Will Pirkle
+\brief  A small pool of persistent worker threads
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\brief
+	Construction: starts the threads, which sleep until the first parallelFor( )
+
+	\param threadCount number of worker threads; 0 runs all jobs on the caller
+	*/
+	WorkerPool::WorkerPool(uint32_t threadCount)
+	{
+		for (uint32_t i = 0; i < threadCount; i++)
+			threads.emplace_back(&WorkerPool::workerLoop, this);
+	}
+
+	/**
+	\brief
+	Destruction: stops and joins the threads
+	*/
+	WorkerPool::~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(poolMutex);
+			quit = true;
+		}
+		startCondition.notify_all();
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	/**
+	\brief
+	One worker per hardware thread, less the one that calls parallelFor( )
+
+	\return the thread count; 0 if the hardware concurrency is unknown
+	*/
+	uint32_t WorkerPool::getDefaultThreadCount()
+	{
+		uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	/**
+	\brief
+	Runs a batch of jobs and waits for all of them
+
+	\param count number of jobs
+	\param _job called once for each index in [0, count)
+	*/
+	void WorkerPool::parallelFor(uint32_t count, const std::function<void(uint32_t)>& _job)
+	{
+		if (count == 0)
+			return;
+
+		// --- not worth waking anybody
+		if (threads.empty() || count == 1)
+		{
+			for (uint32_t i = 0; i < count; i++)
+				_job(i);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(poolMutex);
+			job = &_job;
+			jobCount = count;
+			nextJob = 0;
+			busyWorkers = (uint32_t)threads.size();
+			batch++;
+		}
+		startCondition.notify_all();
+
+		// --- help out
+		runJobs();
+
+		// --- wait for the workers; they must all leave the batch before job goes out of scope
+		std::unique_lock<std::mutex> lock(poolMutex);
+		doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+		job = nullptr;
+		jobCount = 0;
+	}
+
+	/**
+	\brief
+	Claims and runs jobs until there are none left
+	*/
+	void WorkerPool::runJobs()
+	{
+		while (true)
+		{
+			uint32_t index = nextJob.fetch_add(1);
+			if (index >= jobCount)
+				return;
+			(*job)(index);
+		}
+	}
+
+	/**
+	\brief
+	Worker thread: sleep, run a batch, report, repeat
+	*/
+	void WorkerPool::workerLoop()
+	{
+#ifdef SYNTHLAB_TRACING
+		// --- before any job can write an event
+		SynthTracer::getInstance().registerThread("worker");
+#endif
+		uint64_t lastBatch = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(poolMutex);
+				startCondition.wait(lock, [&] { return quit || batch != lastBatch; });
+				if (quit)
+					return;
+				lastBatch = batch;
+			}
+
+			runJobs();
+
+			std::lock_guard<std::mutex> lock(poolMutex);
+			if (--busyWorkers == 0)
+				doneCondition.notify_all();
+		}
+	}
+
+} // namespace
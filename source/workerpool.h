@@ -0,0 +1,79 @@
+#ifndef __workerPool_h__
+#define __workerPool_h__
+
+// --- includes
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// -----------------------------
+//	--- SynthLab SDK File --- //
+//  ----------------------------
+/**
+\file   workerpool.h
+\author Will Pirkle
+\brief  A small pool of persistent worker threads for splitting non-real-time work
+(e.g. resetting the voices after a sample rate change) across the CPU cores
+\date   20-April-2021
+- http://www.willpirkle.com
+*/
+// -----------------------------------------------------------------------------
+namespace SynthLab
+{
+	/**
+	\class WorkerPool
+	\ingroup SynthObjects
+	\brief
+	Persistent worker threads that run the jobs of a parallelFor( ) call
+	- the threads are created once and sleep between calls
+	- the calling thread runs jobs too, so a pool with zero threads runs everything serially
+	- NOT real-time safe: parallelFor( ) blocks until every job is done; never call it from
+	the audio thread
+	- one parallelFor( ) at a time; the owner serializes calls
+
+	\author Will Pirkle http://www.willpirkle.com
+	\remark This object is included and described in further detail in
+	Designing Software Synthesizer Plugins in C++ 2nd Ed. by Will Pirkle
+	\version Revision : 1.0
+	\date Date : 2021 / 04 / 26
+	*/
+	class WorkerPool
+	{
+	public:
+		/** starts the threads */
+		WorkerPool(uint32_t threadCount);
+		~WorkerPool();
+
+		/** runs job(0) ... job(count - 1) on the workers and the calling thread and returns
+		    when all are done; jobs may run in any order */
+		void parallelFor(uint32_t count, const std::function<void(uint32_t)>& job);
+
+		/** number of worker threads (not counting the caller) */
+		uint32_t getThreadCount() { return (uint32_t)threads.size(); }
+
+		/** one worker per hardware thread, less the caller's */
+		static uint32_t getDefaultThreadCount();
+
+	protected:
+		void workerLoop();
+		void runJobs();
+
+		std::vector<std::thread> threads;			///< the workers
+		std::mutex poolMutex;						///< guards everything below except nextJob
+		std::condition_variable startCondition;		///< signals a new batch (or quit)
+		std::condition_variable doneCondition;		///< signals the last worker finishing
+		const std::function<void(uint32_t)>* job = nullptr;	///< current batch
+		uint32_t jobCount = 0;						///< jobs in the current batch
+		std::atomic<uint32_t> nextJob{ 0 };			///< next unclaimed job
+		uint32_t busyWorkers = 0;					///< workers still in the current batch
+		uint64_t batch = 0;							///< batch counter; wakes the workers
+		bool quit = false;							///< stops the workers
+	};
+
+} // namespace
+
+#endif /* defined(__workerPool_h__) */
@@ -32,7 +32,7 @@ namespace SynthLab
 		std::shared_ptr<WSOscParameters> _parameters,
 		std::shared_ptr<WavetableDatabase> _waveTableDatabase,
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- create our audio buffers
@@ -54,10 +54,60 @@ namespace SynthLab
 		waveSeqOsc[1].reset(new WTOscillator(_midiInputData, waveSeqParams[1], _waveTableDatabase, blockSize));
 		waveSeqOsc[2].reset(new WTOscillator(_midiInputData, waveSeqParams[2], _waveTableDatabase, blockSize));
 		waveSeqOsc[3].reset(new WTOscillator(_midiInputData, waveSeqParams[3], _waveTableDatabase, blockSize));
-	
+
+		// --- the sequence can step to a waveform of any core, and the steps select cores on
+		//     the audio thread, so every core is built here rather than lazily
+		for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
+		{
+			for (uint32_t core = 0; core < NUM_MODULE_CORES; core++)
+				waveSeqOsc[i]->instantiateModuleCore(core);
+		}
 	}	/* C-TOR */
 
 
+	/**
+	\brief Memory accounting: adds the four wavetable oscillators as children of the module's report
+
+	\param report the node for this module
+	*/
+	void WSOscillator::getMemoryReport(MemoryReport& report)
+	{
+		SynthModule::getMemoryReport(report);
+		for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
+		{
+			if (waveSeqOsc[i])
+				waveSeqOsc[i]->getMemoryReport(report.addChild("WT Osc " + std::to_string(i + 1)));
+		}
+	}
+
+	/**
+	\brief Residency: any of the four wavetable oscillators may be sequenced
+
+	\param sources the list to add to
+	*/
+	void WSOscillator::addReachableSources(ReachableSources& sources)
+	{
+		for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
+		{
+			if (waveSeqOsc[i])
+				waveSeqOsc[i]->addReachableSources(sources);
+		}
+	}
+
+	/**
+	\brief Change detection: the counters of the four wavetable oscillators' cores
+
+	\param counters the sum to add to
+	*/
+	void WSOscillator::addUpdateCounters(UpdateCounters& counters)
+	{
+		for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
+		{
+			if (waveSeqOsc[i])
+				waveSeqOsc[i]->addUpdateCounters(counters);
+		}
+	}
+
 	/**
 	\brief Resets object to initialized state
 	- call once during initialization
@@ -132,6 +182,13 @@ namespace SynthLab
 		uint32_t wave_AIndex = getModulationInput()->getModValue(kWaveSeqWaveIndex_AMod);
         uint32_t wave_BIndex = getModulationInput()->getModValue(kWaveSeqWaveIndex_BMod);
 
+		// --- the lane values and the solo index come from the patch; stay inside the wave list
+		if (waveStringFinder.empty())
+			return false;
+		uint32_t lastWave = (uint32_t)waveStringFinder.size() - 1;
+		boundUIntValue(wave_AIndex, 0, lastWave);
+		boundUIntValue(wave_BIndex, 0, lastWave);
+
 		double oscAMixCoeff = getModulationInput()->getModValue(kWaveSeqWave_AGainMod);
 		double oscBMixCoeff = getModulationInput()->getModValue(kWaveSeqWave_BGainMod);
 
@@ -149,8 +206,8 @@ namespace SynthLab
 		// --- soloing?
 		if (parameters->soloWaveWSIndex >= 0)
 		{
-			wave_AIndex = parameters->soloWaveWSIndex;
-			wave_BIndex = parameters->soloWaveWSIndex;
+			wave_AIndex = std::min((uint32_t)parameters->soloWaveWSIndex, lastWave);
+			wave_BIndex = wave_AIndex;
 
 			if (currSoloWave != wave_AIndex) // new solo
 			{
@@ -219,40 +276,40 @@ namespace SynthLab
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores on all four internal oscillators
-	so that they will be running during the round-robin render phase
+	\brief Records the note on all four internal oscillators without delivering it
+	- the round-robin selects the core of an oscillator when it activates it (see setNewOscWaveA( )
+	and setNewOscWaveB( )) and the selected core gets the note then; the two active oscillators
+	are set up at the first update after the note-on and the dormant ones when the sequence reaches them
 
 	\returns true if successful, false otherwise
 	*/
 	bool WSOscillator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		// --- select each core and call noteOn so all cores
-		//     of all oscillators will have the messages;
-		//     NOTE: the oscillators do NOT need to all be running
+		// --- NOTE: the oscillators do NOT need to all be running
 		//     only the two "active oscillators" will be running
-		for (uint32_t core = 0; core < NUM_MODULE_CORES; core++)
-		{
-			for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
-			{
-				waveSeqOsc[i]->selectModuleCore(core);
-				waveSeqOsc[i]->doNoteOn(noteEvent);
-			}
-		}
+		for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
+			waveSeqOsc[i]->deferNoteOn(noteEvent);
 
 		initRoundRobin = true;
 		return true;
 	}
 
 	/**
-	\brief Calls the note-off handler on four internal oscillators
+	\brief Records the note-off on the four internal oscillators; the active pair gets it now, the
+	dormant ones when the round-robin activates them
 
 	\returns true if successful, false otherwise
 	*/
 	bool WSOscillator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
 		for (uint32_t i = 0; i < NUM_WS_OSCILLATORS; i++)
+			waveSeqOsc[i]->deferNoteOff(noteEvent);
+
+		// --- the active pair now, unless the round-robin has not started yet
+		if (!initRoundRobin)
 		{
-			waveSeqOsc[i]->doNoteOff(noteEvent);
+			waveSeqOsc[activeOsc[0]]->catchUpSelectedCore();
+			waveSeqOsc[activeOsc[1]]->catchUpSelectedCore();
 		}
 		return true;
 	}
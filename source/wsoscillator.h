@@ -106,7 +106,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class WSOscillator : public SynthModule
+	class WSOscillator : public MemoryAccounted<WSOscillator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */
@@ -117,6 +117,9 @@ namespace SynthLab
 
 		/** Destructor is empty: all resources are smart pointers */
 		virtual ~WSOscillator() {}/* D-TOR */
+		virtual void getMemoryReport(MemoryReport& report) override;
+		virtual void addReachableSources(ReachableSources& sources) override;
+		virtual void addUpdateCounters(UpdateCounters& counters) override;
 
 		/** SynthModule Overrides */
 		virtual bool reset(double _sampleRate) override;
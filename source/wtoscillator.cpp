@@ -34,7 +34,7 @@ namespace SynthLab
 		std::shared_ptr<WTOscParameters> _parameters, 
 		std::shared_ptr<WavetableDatabase> _waveTableDatabase,
 		uint32_t blockSize)
-		: SynthModule(_midiInputData)
+		: MemoryAccounted(_midiInputData)
 		, parameters(_parameters)
 	{
 		// --- standalone ONLY: parameters
@@ -62,25 +62,22 @@ namespace SynthLab
 		// --- setup the cores if not DM
 		if (midiInputData->getAuxDAWDataUINT(kDMBuild) == 0)
 		{
+			// --- cores are built on first selection; the morphing core in particular
+			//     carries large bank descriptors that most oscillators never need
 			// Core 0:
-			std::shared_ptr<ClassicWTCore> classicCore = std::make_shared<ClassicWTCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(classicCore));
+			addModuleCoreFactory(createModuleCore<ClassicWTCore>, 0, "Classic WT");
 
 			// Core 1:
-			std::shared_ptr<MorphWTCore> morphCore = std::make_shared<MorphWTCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(morphCore));
+			addModuleCoreFactory(createModuleCore<MorphWTCore>, 1, "Morph WT");
 
 			// Core 2:
-			std::shared_ptr<FourierWTCore> fourierCore = std::make_shared<FourierWTCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(fourierCore));
+			addModuleCoreFactory(createModuleCore<FourierWTCore>, 2, "Fourier WT");
 
 			// Core 3: Choose One:
 			//  for DM this needs to be empty (at least one?)
-			std::shared_ptr<SFXWTCore> sfxCore = std::make_shared<SFXWTCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(sfxCore));
+			addModuleCoreFactory(createModuleCore<SFXWTCore>, 3, "SFX WT");
 
-			/*	std::shared_ptr<DrumWTCore> drumCore = std::make_shared<DrumWTCore>();
-			addModuleCore(std::static_pointer_cast<ModuleCore>(drumCore));*/
+			/*	addModuleCoreFactory(createModuleCore<DrumWTCore>, 3, "Drum WT");*/
 		}
 
 
@@ -144,37 +141,24 @@ namespace SynthLab
 	}
 
 	/**
-	\brief Calls the note-on handler for all cores.
+	\brief Calls the note-on handler for the selected core; the other cores get the note when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool WTOscillator::doNoteOn(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		coreProcessData.unisonStartPhase = unisonStartPhase;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOn(coreProcessData);
-		}
-		
-		return true;
+		// --- the selected core now, the others when they are selected
+		return doSelectedCoreNoteOn(noteEvent);
 	}
 
 	/**
-	\brief Calls the note-off handler for all cores.
+	\brief Calls the note-off handler for the selected core; the other cores get it when they are selected.
 
 	\returns true if successful, false otherwise
 	*/
 	bool WTOscillator::doNoteOff(MIDINoteEvent& noteEvent)
 	{
-		coreProcessData.noteEvent = noteEvent;
-		for (uint32_t i = 0; i < NUM_MODULE_CORES; i++)
-		{
-			if (moduleCores[i])
-				moduleCores[i]->doNoteOff(coreProcessData);
-		}
-		return true;
+		return doSelectedCoreNoteOff(noteEvent);
 	}
 
 
@@ -122,7 +122,7 @@ namespace SynthLab
 	\version Revision : 1.0
 	\date Date : 2021 / 04 / 26
 	*/
-	class WTOscillator : public SynthModule
+	class WTOscillator : public MemoryAccounted<WTOscillator, SynthModule>
 	{
 	public:
 		/** One and only specialized constructor; pointers may be null for stanalone */